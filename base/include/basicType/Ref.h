@@ -0,0 +1,265 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  basicType/Ref.h                                                                             *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Intrusive smart pointer of RefCountObj, which holds one reference, moves don't touch the    *
+ *                counter.                                                                                    *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _BASIC_TYPE_REF_H
+#define _BASIC_TYPE_REF_H
+
+// Standard includes
+#include <stddef.h>
+
+/*!
+ * @brief Holder of one reference of a RefCountObj (or any class with ref()/deref()).
+ *
+ * @remarks
+ *   1. A new object has one reference already, adopt() takes it over, retain() adds one of its own:
+ *          Ref<Decoder> decoder = adoptRef(new Decoder());
+ *          pool.executeTaskItem(std::move(decoder));
+ *   2. Copies ref(), destruction and reset() deref(), moves and release() don't touch the counter.  So passing
+ *      a Ref<Runnable>&& to executeTaskItem() transfers the reference, instead of ref() there and deref() here.
+ *   3. Ref<Derived> converts to Ref<Base>.
+ *   4. Like a raw pointer, a Ref is not thread-safe, only the counter of the object is.
+ */
+template <class T>
+class Ref
+{
+  public:
+    Ref(void);
+    Ref(const Ref &other);
+    Ref(Ref &&other);
+    template <class U>
+    Ref(const Ref<U> &other);
+    template <class U>
+    Ref(Ref<U> &&other);
+
+    /*!
+     * Destructor.
+     */
+    ~Ref();
+
+    Ref &operator=(const Ref &other);
+    Ref &operator=(Ref &&other);
+
+    // Take over the reference which the caller owns, e.g. the one of a new object.
+    static Ref adopt(T *obj);
+    // ref() for a reference of its own, obj can be 0.
+    static Ref retain(T *obj);
+
+    T *get(void) const;
+    T *operator->(void) const;
+    T &operator*(void) const;
+    explicit operator bool(void) const;
+
+    // Give the reference to the caller, w/o deref().
+    T *release(void);
+    // deref() if any, and hold nothing.
+    void reset(void);
+    void swap(Ref &other);
+
+  private:
+    T *obj;
+
+    explicit Ref(T *_obj);
+
+    template <class U>
+    friend class Ref;
+};
+
+template <class T>
+Ref<T> adoptRef(T *obj);
+template <class T>
+Ref<T> retainRef(T *obj);
+
+template <class T, class U>
+bool operator==(const Ref<T> &left, const Ref<U> &right);
+template <class T, class U>
+bool operator!=(const Ref<T> &left, const Ref<U> &right);
+
+/* Implementation for Ref */
+
+template <class T>
+Ref<T>::Ref(void) : obj(0)
+{
+}
+
+template <class T>
+Ref<T>::Ref(T *_obj) : obj(_obj)
+{
+}
+
+template <class T>
+Ref<T>::Ref(const Ref &other) : obj(other.obj)
+{
+    if(obj)
+    {
+        obj->ref();
+    }
+}
+
+template <class T>
+Ref<T>::Ref(Ref &&other) : obj(other.obj)
+{
+    other.obj = 0;
+}
+
+template <class T>
+template <class U>
+Ref<T>::Ref(const Ref<U> &other) : obj(other.obj)
+{
+    if(obj)
+    {
+        obj->ref();
+    }
+}
+
+template <class T>
+template <class U>
+Ref<T>::Ref(Ref<U> &&other) : obj(other.obj)
+{
+    other.obj = 0;
+}
+
+template <class T>
+Ref<T>::~Ref()
+{
+    if(obj)
+    {
+        obj->deref();
+    }
+}
+
+template <class T>
+Ref<T> &Ref<T>::operator=(const Ref &other)
+{
+    // ref() first, for self assignment.
+    if(other.obj)
+    {
+        other.obj->ref();
+    }
+    T *old = obj;
+    obj = other.obj;
+    if(old)
+    {
+        old->deref();
+    }
+    return *this;
+}
+
+template <class T>
+Ref<T> &Ref<T>::operator=(Ref &&other)
+{
+    if(this != &other)
+    {
+        T *old = obj;
+        obj = other.obj;
+        other.obj = 0;
+        if(old)
+        {
+            old->deref();
+        }
+    }
+    return *this;
+}
+
+template <class T>
+Ref<T> Ref<T>::adopt(T *obj)
+{
+    return Ref(obj);
+}
+
+template <class T>
+Ref<T> Ref<T>::retain(T *obj)
+{
+    if(obj)
+    {
+        obj->ref();
+    }
+    return Ref(obj);
+}
+
+template <class T>
+T *Ref<T>::get(void) const
+{
+    return obj;
+}
+
+template <class T>
+T *Ref<T>::operator->(void) const
+{
+    return obj;
+}
+
+template <class T>
+T &Ref<T>::operator*(void) const
+{
+    return *obj;
+}
+
+template <class T>
+Ref<T>::operator bool(void) const
+{
+    return obj != 0;
+}
+
+template <class T>
+T *Ref<T>::release(void)
+{
+    T *released = obj;
+    obj = 0;
+    return released;
+}
+
+template <class T>
+void Ref<T>::reset(void)
+{
+    T *old = obj;
+    obj = 0;
+    if(old)
+    {
+        old->deref();
+    }
+}
+
+template <class T>
+void Ref<T>::swap(Ref &other)
+{
+    T *mine = obj;
+    obj = other.obj;
+    other.obj = mine;
+}
+
+template <class T>
+Ref<T> adoptRef(T *obj)
+{
+    return Ref<T>::adopt(obj);
+}
+
+template <class T>
+Ref<T> retainRef(T *obj)
+{
+    return Ref<T>::retain(obj);
+}
+
+template <class T, class U>
+bool operator==(const Ref<T> &left, const Ref<U> &right)
+{
+    return left.get() == right.get();
+}
+
+template <class T, class U>
+bool operator!=(const Ref<T> &left, const Ref<U> &right)
+{
+    return left.get() != right.get();
+}
+
+#endif//_BASIC_TYPE_REF_H
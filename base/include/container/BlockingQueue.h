@@ -0,0 +1,309 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/BlockingQueue.h                                                                   *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Blocking push/pop over SpscRing, MpscQueue and MpmcRing, waiting on futex.               *
+ *                2. A side enters the kernel only when the queue is empty/full, and the other side calls     *
+ *                   futex only when someone waits, otherwise it costs one memory fence per push/pop.         *
+ *                3. The thread rules of the queue still apply, e.g. one consumer for BlockingMpscQueue.      *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_BLOCKING_QUEUE_H
+#define _CONTAINER_BLOCKING_QUEUE_H
+
+// Standard includes
+#include <limits.h>
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+// POSIX includes
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <container/MpmcRing.h>
+#include <container/MpscQueue.h>
+#include <container/SpscRing.h>
+
+// Waiters take a key, check their condition again, and sleep until a notify after the key.
+class _ContainerEventCount
+{
+  public:
+    _ContainerEventCount(void);
+
+    // The caller must check its condition after it, then call either cancelWait() or wait().
+    uint32_t prepareWait(void);
+    void cancelWait(void);
+    // Return false if deadlineNS (CLOCK_MONOTONIC, 0 for no deadline) is passed.
+    bool wait(uint32_t key, int64_t deadlineNS);
+    // The caller must have made the condition true before it.
+    void notifyOne(void);
+    void notifyAll(void);
+
+    static int64_t deadlineOf(int timeoutMS);
+
+  private:
+    std::atomic<uint32_t> epoch;
+    std::atomic<int> waiterCount;
+
+    void notify(int count);
+};
+
+template <class T, class Q>
+class BlockingQueue
+{
+  public:
+    // For the unbounded MpscQueue.
+    BlockingQueue(void);
+    // For the rings, capacity is rounded up to power of 2.
+    explicit BlockingQueue(int capacity);
+    ~BlockingQueue();
+
+    // 1. Wait while it is full, timeoutMS <= 0 for no timeout.
+    // 2. Return MIO_GENERAL_OK, MIO_ERR_TIMEOUT, or MIO_ERR_IO_CLOSED after close().
+    int push(const T &obj, int timeoutMS = 0);
+    // 1. Wait while it is empty, timeoutMS <= 0 for no timeout.
+    // 2. Return MIO_GENERAL_OK, MIO_ERR_TIMEOUT, or MIO_ERR_IO_CLOSED after close() and no item is left.
+    int pop(T &objHolder, int timeoutMS = 0);
+    // Never wait, and wake up a waiting side on success.
+    bool tryPush(const T &obj);
+    bool tryPop(T &objHolder);
+
+    // Fail later pushes and wake up all waiters, pops still get the items left.
+    void close(void);
+    bool isClosed(void) const;
+    // The rings only, approximate value.
+    int size(void) const;
+
+  private:
+    Q queue;
+    std::atomic<bool> closed;
+    char _pad0[CONTAINER_CACHE_LINE_SIZE];
+    _ContainerEventCount notEmpty;
+    char _pad1[CONTAINER_CACHE_LINE_SIZE];
+    _ContainerEventCount notFull;
+    char _pad2[CONTAINER_CACHE_LINE_SIZE];
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    BlockingQueue(const BlockingQueue &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    BlockingQueue &operator=(const BlockingQueue &);
+};
+
+// One producer thread and one consumer thread, bounded.
+template <class T>
+using BlockingSpscRing = BlockingQueue<T, SpscRing<T> >;
+// Any producer thread and one consumer thread, unbounded, push never waits.
+template <class T>
+using BlockingMpscQueue = BlockingQueue<T, MpscQueue<T> >;
+// Any producer and consumer threads, bounded.
+template <class T>
+using BlockingMpmcRing = BlockingQueue<T, MpmcRing<T> >;
+
+/* Implementation for _ContainerEventCount */
+
+inline _ContainerEventCount::_ContainerEventCount(void) : epoch(0), waiterCount(0)
+{
+}
+
+inline uint32_t _ContainerEventCount::prepareWait(void)
+{
+    waiterCount.fetch_add(1);
+    // Paired with the fence of notify(), either the condition check sees the notifier's change, or the
+    // notifier sees this waiter.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return epoch.load();
+}
+
+inline void _ContainerEventCount::cancelWait(void)
+{
+    waiterCount.fetch_sub(1);
+}
+
+inline bool _ContainerEventCount::wait(uint32_t key, int64_t deadlineNS)
+{
+    bool isInTime = true;
+    while(epoch.load() == key)
+    {
+        struct timespec timeout;
+        struct timespec *timeoutPtr = 0;
+        if(deadlineNS > 0)
+        {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            int64_t leftNS = deadlineNS - (now.tv_sec * 1000000000LL + now.tv_nsec);
+            if(leftNS <= 0)
+            {
+                isInTime = false;
+                break;
+            }
+            timeout.tv_sec = leftNS / 1000000000LL;
+            timeout.tv_nsec = leftNS % 1000000000LL;
+            timeoutPtr = &timeout;
+        }
+        // It returns at once if epoch is not key any more.
+        syscall(SYS_futex, (int *) &epoch, FUTEX_WAIT_PRIVATE, (int) key, timeoutPtr, 0, 0);
+    }
+    waiterCount.fetch_sub(1);
+    return isInTime;
+}
+
+inline void _ContainerEventCount::notifyOne(void)
+{
+    notify(1);
+}
+
+inline void _ContainerEventCount::notifyAll(void)
+{
+    notify(INT_MAX);
+}
+
+inline void _ContainerEventCount::notify(int count)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(waiterCount.load(std::memory_order_relaxed) > 0)
+    {
+        epoch.fetch_add(1);
+        syscall(SYS_futex, (int *) &epoch, FUTEX_WAKE_PRIVATE, count, 0, 0, 0);
+    }
+}
+
+inline int64_t _ContainerEventCount::deadlineOf(int timeoutMS)
+{
+    if(timeoutMS <= 0)
+    {
+        return 0;
+    }
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec + timeoutMS * 1000000LL;
+}
+
+/* Implementation for BlockingQueue */
+
+template <class T, class Q>
+BlockingQueue<T, Q>::BlockingQueue(void) : closed(false)
+{
+}
+
+template <class T, class Q>
+BlockingQueue<T, Q>::BlockingQueue(int capacity) : queue(capacity), closed(false)
+{
+}
+
+template <class T, class Q>
+BlockingQueue<T, Q>::~BlockingQueue()
+{
+}
+
+template <class T, class Q>
+int BlockingQueue<T, Q>::push(const T &obj, int timeoutMS)
+{
+    int64_t deadlineNS = _ContainerEventCount::deadlineOf(timeoutMS);
+    while(true)
+    {
+        if(closed.load(std::memory_order_acquire))
+        {
+            return MIO_ERR_IO_CLOSED;
+        }
+        if(tryPush(obj))
+        {
+            return MIO_GENERAL_OK;
+        }
+        uint32_t key = notFull.prepareWait();
+        if(closed.load(std::memory_order_acquire))
+        {
+            notFull.cancelWait();
+            return MIO_ERR_IO_CLOSED;
+        }
+        if(tryPush(obj))
+        {
+            notFull.cancelWait();
+            return MIO_GENERAL_OK;
+        }
+        if(!notFull.wait(key, deadlineNS))
+        {
+            return MIO_ERR_TIMEOUT;
+        }
+    }
+}
+
+template <class T, class Q>
+int BlockingQueue<T, Q>::pop(T &objHolder, int timeoutMS)
+{
+    int64_t deadlineNS = _ContainerEventCount::deadlineOf(timeoutMS);
+    while(true)
+    {
+        if(tryPop(objHolder))
+        {
+            return MIO_GENERAL_OK;
+        }
+        uint32_t key = notEmpty.prepareWait();
+        if(tryPop(objHolder))
+        {
+            notEmpty.cancelWait();
+            return MIO_GENERAL_OK;
+        }
+        if(closed.load(std::memory_order_acquire))
+        {
+            notEmpty.cancelWait();
+            // A push may have landed between the last try and close().
+            return tryPop(objHolder) ? MIO_GENERAL_OK : MIO_ERR_IO_CLOSED;
+        }
+        if(!notEmpty.wait(key, deadlineNS))
+        {
+            return MIO_ERR_TIMEOUT;
+        }
+    }
+}
+
+template <class T, class Q>
+bool BlockingQueue<T, Q>::tryPush(const T &obj)
+{
+    if(!queue.tryPush(obj))
+    {
+        return false;
+    }
+    notEmpty.notifyOne();
+    return true;
+}
+
+template <class T, class Q>
+bool BlockingQueue<T, Q>::tryPop(T &objHolder)
+{
+    if(!queue.tryPop(objHolder))
+    {
+        return false;
+    }
+    notFull.notifyOne();
+    return true;
+}
+
+template <class T, class Q>
+void BlockingQueue<T, Q>::close(void)
+{
+    closed.store(true, std::memory_order_release);
+    notEmpty.notifyAll();
+    notFull.notifyAll();
+}
+
+template <class T, class Q>
+bool BlockingQueue<T, Q>::isClosed(void) const
+{
+    return closed.load(std::memory_order_acquire);
+}
+
+template <class T, class Q>
+int BlockingQueue<T, Q>::size(void) const
+{
+    return queue.size();
+}
+
+#endif //_CONTAINER_BLOCKING_QUEUE_H
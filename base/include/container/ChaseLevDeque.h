@@ -0,0 +1,210 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/ChaseLevDeque.h                                                                   *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Lock-free work-stealing deque (Chase-Lev, with the C11 memory orders of Le et al. 2013).     *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_CHASE_LEV_DEQUE_H
+#define _CONTAINER_CHASE_LEV_DEQUE_H
+
+// Standard includes
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+// libBase includes
+#include <container/List.h>
+#include <container/MpmcRing.h>
+
+/*!
+ * @brief Single-owner deque, the owner pushes and pops at the bottom (LIFO), others steal from the top (FIFO).
+ *
+ * @remarks
+ *   1. T should be trivially copyable and small, pointers usually.
+ *   2. push() grows the array when it is full, old arrays are kept until the deque is destructed, since
+ *      stealers may still read them.  Memory is bounded by 2 * the largest capacity.
+ *   3. push()/pop() must be called by the owner thread only, steal() by any thread.
+ */
+template <class T>
+class ChaseLevDeque
+{
+  public:
+    // capacity is rounded up to power of 2, and at least 2.
+    ChaseLevDeque(int capacity = 256);
+    ~ChaseLevDeque();
+
+    // Approximate value when other threads are stealing.
+    int size(void) const;
+    bool isEmpty(void) const;
+
+    // Owner only.
+    void push(const T &obj);
+    // Owner only, the most recently pushed one.
+    bool pop(T &objHolder);
+    // Any thread, the least recently pushed one.  It may fail spuriously when racing with others, callers
+    // usually move on to other deques.
+    bool steal(T &objHolder);
+
+  private:
+    struct Array
+    {
+        const int64_t mask;
+        std::atomic<T> *cells;
+
+        Array(int64_t capacity) : mask(capacity - 1), cells(new std::atomic<T>[capacity])
+        {
+        }
+
+        ~Array()
+        {
+            delete[] cells;
+        }
+
+        int64_t capacity(void) const
+        {
+            return mask + 1;
+        }
+
+        T get(int64_t ndx) const
+        {
+            return cells[ndx & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t ndx, const T &obj)
+        {
+            cells[ndx & mask].store(obj, std::memory_order_relaxed);
+        }
+    };
+
+    char _pad0[CONTAINER_CACHE_LINE_SIZE];
+    std::atomic<int64_t> top;
+    char _pad1[CONTAINER_CACHE_LINE_SIZE];
+    std::atomic<int64_t> bottom;
+    std::atomic<Array *> array;
+    char _pad2[CONTAINER_CACHE_LINE_SIZE];
+    // Replaced arrays, owner only.
+    List<Array *> retiredArrays;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    ChaseLevDeque(const ChaseLevDeque &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    ChaseLevDeque &operator=(const ChaseLevDeque &);
+
+    Array *grow(Array *old, int64_t topNdx, int64_t bottomNdx);
+};
+
+template <class T>
+ChaseLevDeque<T>::ChaseLevDeque(int capacity) : top(0), bottom(0)
+{
+    int64_t rounded = 2;
+    while(rounded < capacity)
+    {
+        rounded <<= 1;
+    }
+    array.store(new Array(rounded), std::memory_order_relaxed);
+}
+
+template <class T>
+ChaseLevDeque<T>::~ChaseLevDeque()
+{
+    delete array.load(std::memory_order_relaxed);
+    for(int i = 0; i < retiredArrays.size(); ++i)
+    {
+        delete retiredArrays.get(i);
+    }
+}
+
+template <class T>
+int ChaseLevDeque<T>::size(void) const
+{
+    int64_t size = bottom.load(std::memory_order_relaxed) - top.load(std::memory_order_relaxed);
+    return (size > 0) ? (int) size : 0;
+}
+
+template <class T>
+bool ChaseLevDeque<T>::isEmpty(void) const
+{
+    return size() == 0;
+}
+
+template <class T>
+void ChaseLevDeque<T>::push(const T &obj)
+{
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    Array *a = array.load(std::memory_order_relaxed);
+    if(b - t > a->capacity() - 1)
+    {
+        a = grow(a, t, b);
+    }
+    a->put(b, obj);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+template <class T>
+bool ChaseLevDeque<T>::pop(T &objHolder)
+{
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    Array *a = array.load(std::memory_order_relaxed);
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+    if(t > b)
+    {
+        // Empty.
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+    objHolder = a->get(b);
+    if(t == b)
+    {
+        // The last one, race with stealers for it.
+        bool isWon = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return isWon;
+    }
+    return true;
+}
+
+template <class T>
+bool ChaseLevDeque<T>::steal(T &objHolder)
+{
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+    if(t >= b)
+    {
+        return false;
+    }
+    // Consume ordering in the paper, acquire is the portable equivalent.
+    Array *a = array.load(std::memory_order_acquire);
+    T obj = a->get(t);
+    if(!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return false;
+    }
+    objHolder = obj;
+    return true;
+}
+
+template <class T>
+typename ChaseLevDeque<T>::Array *ChaseLevDeque<T>::grow(Array *old, int64_t topNdx, int64_t bottomNdx)
+{
+    Array *a = new Array(old->capacity() * 2);
+    for(int64_t i = topNdx; i < bottomNdx; ++i)
+    {
+        a->put(i, old->get(i));
+    }
+    retiredArrays.addWithoutCheck(old);
+    array.store(a, std::memory_order_release);
+    return a;
+}
+
+#endif//_CONTAINER_CHASE_LEV_DEQUE_H
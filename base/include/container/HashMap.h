@@ -0,0 +1,222 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/HashMap.h                                                                         *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Open-addressing hash map, O(1) put()/get()/remove().                                     *
+ *                2. Reference Java HashMap<K, V> for most methods.                                           *
+ *                3. Not multi-thread-safe.                                                                   *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_HASH_MAP_H
+#define _CONTAINER_HASH_MAP_H
+
+// libBase includes
+#include <container/HashTable.h>
+#include <container/List.h>
+
+template <class K, class V>
+struct _HashMapEntry
+{
+    K key;
+    V value;
+
+    _HashMapEntry(const K &_key, const V &_value) : key(_key), value(_value)
+    {
+    }
+    _HashMapEntry(_HashMapEntry &&other) : key(std::move(other.key)), value(std::move(other.value))
+    {
+    }
+};
+
+template <class K, class V>
+struct _HashMapKeyOf
+{
+    static const K &key(const _HashMapEntry<K, V> &entry)
+    {
+        return entry.key;
+    }
+};
+
+// 1. K should be copy constructible, and comparable by operator==.  V should be copy constructible and
+//    assignable.
+// 2. H hashes K, equal keys should have the same hash, see Hash<T>.
+template <class K, class V, class H = Hash<K> >
+class HashMap
+{
+  public:
+    HashMap(void);
+
+    int size(void) const;
+    bool isEmpty(void) const;
+    bool containsKey(const K &key) const;
+    // Return false if key doesn't exist, and valueHolder is not changed.
+    bool get(const K &key, V &valueHolder) const;
+    // 1. Return the value of key, or 0 if key doesn't exist.
+    // 2. Valid until the next put()/remove(), which may move values.
+    V *getPtr(const K &key);
+    const V *getPtr(const K &key) const;
+    // Return false if key exists already, and its value is replaced.
+    bool put(const K &key, const V &value);
+    // Return false if key exists already, and its value is kept.
+    bool putIfAbsent(const K &key, const V &value);
+    // Return false if key doesn't exist.
+    bool remove(const K &key);
+    void clear(void);
+    // Keep it from growing until it has count keys.
+    void reserve(int count);
+    // visitor(const K &, V &) for each key, in no particular order, w/o putting new keys or removing meanwhile.
+    template <class F>
+    void forEach(F visitor);
+    template <class F>
+    void forEach(F visitor) const;
+    // Append all keys to keysHolder, in no particular order.
+    void keys(List<K> &keysHolder) const;
+
+  private:
+    _HashTable<_HashMapEntry<K, V>, K, _HashMapKeyOf<K, V>, H> table;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    HashMap(const HashMap &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    HashMap &operator=(const HashMap &);
+};
+
+/* Implementation for HashMap */
+
+template <class K, class V, class H>
+HashMap<K, V, H>::HashMap(void)
+{
+}
+
+template <class K, class V, class H>
+int HashMap<K, V, H>::size(void) const
+{
+    return table.size();
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::isEmpty(void) const
+{
+    return table.size() == 0;
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::containsKey(const K &key) const
+{
+    return table.find(key) >= 0;
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::get(const K &key, V &valueHolder) const
+{
+    int slot = table.find(key);
+    if(slot < 0)
+    {
+        return false;
+    }
+    valueHolder = table.at(slot).value;
+    return true;
+}
+
+template <class K, class V, class H>
+V *HashMap<K, V, H>::getPtr(const K &key)
+{
+    int slot = table.find(key);
+    return (slot < 0) ? 0 : &table.at(slot).value;
+}
+
+template <class K, class V, class H>
+const V *HashMap<K, V, H>::getPtr(const K &key) const
+{
+    int slot = table.find(key);
+    return (slot < 0) ? 0 : &table.at(slot).value;
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::put(const K &key, const V &value)
+{
+    bool isAdded;
+    int slot = table.findOrAdd(key, value, isAdded);
+    if(!isAdded)
+    {
+        table.at(slot).value = value;
+    }
+    return isAdded;
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::putIfAbsent(const K &key, const V &value)
+{
+    bool isAdded;
+    table.findOrAdd(key, value, isAdded);
+    return isAdded;
+}
+
+template <class K, class V, class H>
+bool HashMap<K, V, H>::remove(const K &key)
+{
+    return table.remove(key);
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::clear(void)
+{
+    table.clear();
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::reserve(int count)
+{
+    table.reserve(count);
+}
+
+template <class K, class V, class H>
+template <class F>
+void HashMap<K, V, H>::forEach(F visitor)
+{
+    int capacity = table.capacity();
+    for(int slot = 0; slot < capacity; ++slot)
+    {
+        if(table.isUsed(slot))
+        {
+            _HashMapEntry<K, V> &entry = table.at(slot);
+            visitor((const K &) entry.key, entry.value);
+        }
+    }
+}
+
+template <class K, class V, class H>
+template <class F>
+void HashMap<K, V, H>::forEach(F visitor) const
+{
+    int capacity = table.capacity();
+    for(int slot = 0; slot < capacity; ++slot)
+    {
+        if(table.isUsed(slot))
+        {
+            const _HashMapEntry<K, V> &entry = table.at(slot);
+            visitor(entry.key, entry.value);
+        }
+    }
+}
+
+template <class K, class V, class H>
+void HashMap<K, V, H>::keys(List<K> &keysHolder) const
+{
+    int capacity = table.capacity();
+    for(int slot = 0; slot < capacity; ++slot)
+    {
+        if(table.isUsed(slot))
+        {
+            keysHolder.addWithoutCheck(table.at(slot).key);
+        }
+    }
+}
+
+#endif //_CONTAINER_HASH_MAP_H
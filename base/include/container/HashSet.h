@@ -0,0 +1,156 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/HashSet.h                                                                         *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Open-addressing hash set, O(1) add()/contains()/remove(), instead of List<T> scans.      *
+ *                2. Reference Java HashSet<T> for most methods.                                              *
+ *                3. Not multi-thread-safe.                                                                   *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_HASH_SET_H
+#define _CONTAINER_HASH_SET_H
+
+// libBase includes
+#include <container/HashTable.h>
+#include <container/List.h>
+
+template <class T>
+struct _HashSetEntry
+{
+    T key;
+
+    _HashSetEntry(const T &_key, bool) : key(_key)
+    {
+    }
+    _HashSetEntry(_HashSetEntry &&other) : key(std::move(other.key))
+    {
+    }
+};
+
+template <class T>
+struct _HashSetKeyOf
+{
+    static const T &key(const _HashSetEntry<T> &entry)
+    {
+        return entry.key;
+    }
+};
+
+// 1. T should be copy constructible, and comparable by operator==, like List<T>.
+// 2. H hashes T, equal objects should have the same hash, see Hash<T>.
+template <class T, class H = Hash<T> >
+class HashSet
+{
+  public:
+    HashSet(void);
+
+    int size(void) const;
+    bool isEmpty(void) const;
+    bool contains(const T &obj) const;
+    // Return false if obj exists already.
+    bool add(const T &obj);
+    // Return false if obj doesn't exist.
+    bool remove(const T &obj);
+    void clear(void);
+    // Keep it from growing until it has count objects.
+    void reserve(int count);
+    // visitor(const T &) for each object, in no particular order, w/o adding or removing meanwhile.
+    template <class F>
+    void forEach(F visitor) const;
+    // Append all objects to listHolder, in no particular order.
+    void toList(List<T> &listHolder) const;
+
+  private:
+    _HashTable<_HashSetEntry<T>, T, _HashSetKeyOf<T>, H> table;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    HashSet(const HashSet &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    HashSet &operator=(const HashSet &);
+};
+
+/* Implementation for HashSet */
+
+template <class T, class H>
+HashSet<T, H>::HashSet(void)
+{
+}
+
+template <class T, class H>
+int HashSet<T, H>::size(void) const
+{
+    return table.size();
+}
+
+template <class T, class H>
+bool HashSet<T, H>::isEmpty(void) const
+{
+    return table.size() == 0;
+}
+
+template <class T, class H>
+bool HashSet<T, H>::contains(const T &obj) const
+{
+    return table.find(obj) >= 0;
+}
+
+template <class T, class H>
+bool HashSet<T, H>::add(const T &obj)
+{
+    bool isAdded;
+    table.findOrAdd(obj, true, isAdded);
+    return isAdded;
+}
+
+template <class T, class H>
+bool HashSet<T, H>::remove(const T &obj)
+{
+    return table.remove(obj);
+}
+
+template <class T, class H>
+void HashSet<T, H>::clear(void)
+{
+    table.clear();
+}
+
+template <class T, class H>
+void HashSet<T, H>::reserve(int count)
+{
+    table.reserve(count);
+}
+
+template <class T, class H>
+template <class F>
+void HashSet<T, H>::forEach(F visitor) const
+{
+    int capacity = table.capacity();
+    for(int slot = 0; slot < capacity; ++slot)
+    {
+        if(table.isUsed(slot))
+        {
+            visitor(table.at(slot).key);
+        }
+    }
+}
+
+template <class T, class H>
+void HashSet<T, H>::toList(List<T> &listHolder) const
+{
+    int capacity = table.capacity();
+    for(int slot = 0; slot < capacity; ++slot)
+    {
+        if(table.isUsed(slot))
+        {
+            listHolder.addWithoutCheck(table.at(slot).key);
+        }
+    }
+}
+
+#endif //_CONTAINER_HASH_SET_H
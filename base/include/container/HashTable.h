@@ -0,0 +1,289 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/HashTable.h                                                                       *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Hash functor of keys, and the open-addressing table shared by HashSet and HashMap.       *
+ *                2. Not multi-thread-safe.                                                                   *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_HASH_TABLE_H
+#define _CONTAINER_HASH_TABLE_H
+
+// Standard includes
+#include <stdint.h>
+#include <new>
+#include <utility>
+// STL include
+#include <functional>
+
+// murmur3 finalizer, std::hash of integers and pointers is the identity, and tables index by the low bits.
+static inline uint32_t hashMix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb53fe63494c9ULL;
+    value ^= value >> 33;
+    return (uint32_t) value;
+}
+
+// 1. Default hash of HashSet/HashMap keys, std::hash<T> mixed by hashMix().
+// 2. Pointers (including char *) are hashed by address, the same as List<T> compares them.
+// 3. For other classes, specialize it, or give HashSet/HashMap a functor of the same form.
+template <class T>
+struct Hash
+{
+    uint32_t operator()(const T &obj) const
+    {
+        return hashMix((uint64_t) std::hash<T>()(obj));
+    }
+};
+
+/*!
+ * @brief Open-addressing hash table of E, whose key is got by KeyOf::key(E), for HashSet and HashMap.
+ *
+ * @remarks
+ *   1. Linear probing over a power-of-2 array, at most 3/4 full.  Removal shifts the following entries back,
+ *      so there is no tombstone, and lookups never slow down after many removals.
+ *   2. The hash of each entry is kept, so probing compares keys only on equal hashes, and growing doesn't
+ *      hash again.
+ *   3. Entries move when it grows or on removal, pointers to them are valid until the next add or remove.
+ */
+template <class E, class K, class KeyOf, class H>
+class _HashTable
+{
+  public:
+    _HashTable(void);
+    ~_HashTable();
+
+    int size(void) const;
+    // Return the slot of key, or -1.
+    int find(const K &key) const;
+    // 1. Return the slot of key, and isAdded is false, if it exists.
+    // 2. Otherwise, E(key, arg) is added, and isAdded is true.
+    template <class A>
+    int findOrAdd(const K &key, const A &arg, bool &isAdded);
+    void removeAt(int slot);
+    bool remove(const K &key);
+    void clear(void);
+    // Keep the table from growing until it has count entries.
+    void reserve(int count);
+
+    E &at(int slot);
+    const E &at(int slot) const;
+    // Slots from 0 to capacity() - 1, used or not.
+    int capacity(void) const;
+    bool isUsed(int slot) const;
+
+  private:
+    static const uint32_t MIN_CAPACITY = 8;
+    // Stored hashes have it set, so 0 means an empty slot.
+    static const uint32_t USED_BIT = 0x80000000;
+
+    E *entries;
+    uint32_t *hashes;
+    uint32_t mask;
+    int count;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    _HashTable(const _HashTable &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    _HashTable &operator=(const _HashTable &);
+
+    static uint32_t hashOf(const K &key);
+    void rehash(uint32_t newCapacity);
+};
+
+/* Implementation for _HashTable */
+
+template <class E, class K, class KeyOf, class H>
+_HashTable<E, K, KeyOf, H>::_HashTable(void) : entries(0), hashes(0), mask(0), count(0)
+{
+}
+
+template <class E, class K, class KeyOf, class H>
+_HashTable<E, K, KeyOf, H>::~_HashTable()
+{
+    clear();
+    ::operator delete(entries);
+    delete [] hashes;
+}
+
+template <class E, class K, class KeyOf, class H>
+int _HashTable<E, K, KeyOf, H>::size(void) const
+{
+    return count;
+}
+
+template <class E, class K, class KeyOf, class H>
+uint32_t _HashTable<E, K, KeyOf, H>::hashOf(const K &key)
+{
+    return H()(key) | USED_BIT;
+}
+
+template <class E, class K, class KeyOf, class H>
+int _HashTable<E, K, KeyOf, H>::find(const K &key) const
+{
+    if(count == 0)
+    {
+        return -1;
+    }
+    uint32_t hash = hashOf(key);
+    for(uint32_t slot = hash & mask; hashes[slot] != 0; slot = (slot + 1) & mask)
+    {
+        if((hashes[slot] == hash) && (KeyOf::key(entries[slot]) == key))
+        {
+            return (int) slot;
+        }
+    }
+    return -1;
+}
+
+template <class E, class K, class KeyOf, class H>
+template <class A>
+int _HashTable<E, K, KeyOf, H>::findOrAdd(const K &key, const A &arg, bool &isAdded)
+{
+    if((uint32_t) (count + 1) * 4 > (mask + 1) * 3)
+    {
+        rehash(hashes ? (mask + 1) * 2 : MIN_CAPACITY);
+    }
+    uint32_t hash = hashOf(key);
+    uint32_t slot = hash & mask;
+    for(; hashes[slot] != 0; slot = (slot + 1) & mask)
+    {
+        if((hashes[slot] == hash) && (KeyOf::key(entries[slot]) == key))
+        {
+            isAdded = false;
+            return (int) slot;
+        }
+    }
+    new(&entries[slot]) E(key, arg);
+    hashes[slot] = hash;
+    ++count;
+    isAdded = true;
+    return (int) slot;
+}
+
+template <class E, class K, class KeyOf, class H>
+void _HashTable<E, K, KeyOf, H>::removeAt(int slot)
+{
+    uint32_t hole = (uint32_t) slot;
+    entries[hole].~E();
+    for(uint32_t next = (hole + 1) & mask; hashes[next] != 0; next = (next + 1) & mask)
+    {
+        // Move next back into the hole, unless its home slot is between the hole and it (cyclically).
+        uint32_t home = hashes[next] & mask;
+        if(((next - home) & mask) >= ((next - hole) & mask))
+        {
+            new(&entries[hole]) E(std::move(entries[next]));
+            entries[next].~E();
+            hashes[hole] = hashes[next];
+            hole = next;
+        }
+    }
+    hashes[hole] = 0;
+    --count;
+}
+
+template <class E, class K, class KeyOf, class H>
+bool _HashTable<E, K, KeyOf, H>::remove(const K &key)
+{
+    int slot = find(key);
+    if(slot < 0)
+    {
+        return false;
+    }
+    removeAt(slot);
+    return true;
+}
+
+template <class E, class K, class KeyOf, class H>
+void _HashTable<E, K, KeyOf, H>::clear(void)
+{
+    if(count == 0)
+    {
+        return;
+    }
+    for(uint32_t slot = 0; slot <= mask; ++slot)
+    {
+        if(hashes[slot] != 0)
+        {
+            entries[slot].~E();
+            hashes[slot] = 0;
+        }
+    }
+    count = 0;
+}
+
+template <class E, class K, class KeyOf, class H>
+void _HashTable<E, K, KeyOf, H>::reserve(int reservedCount)
+{
+    uint32_t newCapacity = hashes ? (mask + 1) : MIN_CAPACITY;
+    while((uint32_t) reservedCount * 4 > newCapacity * 3)
+    {
+        newCapacity *= 2;
+    }
+    if(!hashes || (newCapacity != mask + 1))
+    {
+        rehash(newCapacity);
+    }
+}
+
+template <class E, class K, class KeyOf, class H>
+void _HashTable<E, K, KeyOf, H>::rehash(uint32_t newCapacity)
+{
+    E *oldEntries = entries;
+    uint32_t *oldHashes = hashes;
+    uint32_t oldCapacity = hashes ? (mask + 1) : 0;
+    entries = (E *) ::operator new(sizeof(E) * newCapacity);
+    hashes = new uint32_t[newCapacity]();
+    mask = newCapacity - 1;
+    for(uint32_t slot = 0; slot < oldCapacity; ++slot)
+    {
+        if(oldHashes[slot] != 0)
+        {
+            uint32_t newSlot = oldHashes[slot] & mask;
+            while(hashes[newSlot] != 0)
+            {
+                newSlot = (newSlot + 1) & mask;
+            }
+            new(&entries[newSlot]) E(std::move(oldEntries[slot]));
+            oldEntries[slot].~E();
+            hashes[newSlot] = oldHashes[slot];
+        }
+    }
+    ::operator delete(oldEntries);
+    delete [] oldHashes;
+}
+
+template <class E, class K, class KeyOf, class H>
+E &_HashTable<E, K, KeyOf, H>::at(int slot)
+{
+    return entries[slot];
+}
+
+template <class E, class K, class KeyOf, class H>
+const E &_HashTable<E, K, KeyOf, H>::at(int slot) const
+{
+    return entries[slot];
+}
+
+template <class E, class K, class KeyOf, class H>
+int _HashTable<E, K, KeyOf, H>::capacity(void) const
+{
+    return hashes ? (int) (mask + 1) : 0;
+}
+
+template <class E, class K, class KeyOf, class H>
+bool _HashTable<E, K, KeyOf, H>::isUsed(int slot) const
+{
+    return hashes[slot] != 0;
+}
+
+#endif //_CONTAINER_HASH_TABLE_H
@@ -0,0 +1,207 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/IndexedList.h                                                                     *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. List<T> of unique objects w/ a companion HashMap index, O(1) contains()/indexOf()/add(). *
+ *                2. Not multi-thread-safe.                                                                   *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_INDEXED_LIST_H
+#define _CONTAINER_INDEXED_LIST_H
+
+// libBase includes
+#include <container/HashMap.h>
+#include <container/List.h>
+
+/*!
+ * @brief List<T> which keeps the position of each object in a HashMap, for lists which need uniqueness.
+ *
+ * @remarks
+ *   1. List<T>::add() scans for duplication, and remove(obj)/indexOf() scan too, so building a unique list is
+ *      quadratic.  Here contains(), indexOf() and add() at the end are O(1).
+ *   2. remove(obj) keeps the order, so following positions are updated, O(n - ndx).  removeUnordered(obj) moves
+ *      the last object to the removed position, O(1), for lists whose order doesn't matter, e.g. listeners.
+ *   3. Objects are unique by nature, so there is no addWithoutCheck().
+ *   4. asList() is the List<T> itself, for APIs taking a List<T>, it should not be changed through it.
+ *   5. It's a companion, not a change of List<T>, whose layout is built in libBase.
+ */
+template <class T, class H = Hash<T> >
+class IndexedList
+{
+  public:
+    IndexedList(void);
+
+    int size(void) const;
+    const T &get(int ndx) const;
+    // Return false if obj is at another position already.
+    bool set(int ndx, const T &obj);
+    bool contains(const T &obj) const;
+    int indexOf(const T &obj) const;
+    // Return false if obj exists already.
+    bool add(const T &obj);
+    bool add(int pos, const T &obj);
+    bool remove(const T &obj);
+    bool removeUnordered(const T &obj);
+    void removeByIndex(int ndx);
+    void clear(void);
+    void reserve(int count);
+    const List<T> &asList(void) const;
+
+  private:
+    List<T> list;
+    // Object to its position in list.
+    HashMap<T, int, H> positions;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    IndexedList(const IndexedList &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    IndexedList &operator=(const IndexedList &);
+
+    // Positions from ndx on are re-indexed.
+    void reindexFrom(int ndx);
+};
+
+/* Implementation for IndexedList */
+
+template <class T, class H>
+IndexedList<T, H>::IndexedList(void)
+{
+}
+
+template <class T, class H>
+int IndexedList<T, H>::size(void) const
+{
+    return list.size();
+}
+
+template <class T, class H>
+const T &IndexedList<T, H>::get(int ndx) const
+{
+    return list.get(ndx);
+}
+
+template <class T, class H>
+bool IndexedList<T, H>::set(int ndx, const T &obj)
+{
+    const int *pos = positions.getPtr(obj);
+    if(pos)
+    {
+        return *pos == ndx;
+    }
+    positions.remove(list.get(ndx));
+    list._deque.at(ndx) = obj;
+    positions.put(obj, ndx);
+    return true;
+}
+
+template <class T, class H>
+bool IndexedList<T, H>::contains(const T &obj) const
+{
+    return positions.containsKey(obj);
+}
+
+template <class T, class H>
+int IndexedList<T, H>::indexOf(const T &obj) const
+{
+    const int *pos = positions.getPtr(obj);
+    return pos ? *pos : -1;
+}
+
+template <class T, class H>
+bool IndexedList<T, H>::add(const T &obj)
+{
+    if(!positions.putIfAbsent(obj, list.size()))
+    {
+        return false;
+    }
+    list.addWithoutCheck(obj);
+    return true;
+}
+
+template <class T, class H>
+bool IndexedList<T, H>::add(int pos, const T &obj)
+{
+    if(!positions.putIfAbsent(obj, pos))
+    {
+        return false;
+    }
+    list.addWithoutCheck(pos, obj);
+    reindexFrom(pos + 1);
+    return true;
+}
+
+template <class T, class H>
+bool IndexedList<T, H>::remove(const T &obj)
+{
+    int ndx = indexOf(obj);
+    if(ndx < 0)
+    {
+        return false;
+    }
+    removeByIndex(ndx);
+    return true;
+}
+
+template <class T, class H>
+bool IndexedList<T, H>::removeUnordered(const T &obj)
+{
+    int ndx = indexOf(obj);
+    if(ndx < 0)
+    {
+        return false;
+    }
+    positions.remove(obj);
+    int last = list.size() - 1;
+    if(ndx != last)
+    {
+        list._deque[ndx] = list._deque[last];
+        *positions.getPtr(list._deque[ndx]) = ndx;
+    }
+    list._deque.pop_back();
+    return true;
+}
+
+template <class T, class H>
+void IndexedList<T, H>::removeByIndex(int ndx)
+{
+    positions.remove(list.get(ndx));
+    list.removeByIndex(ndx);
+    reindexFrom(ndx);
+}
+
+template <class T, class H>
+void IndexedList<T, H>::clear(void)
+{
+    list.clear();
+    positions.clear();
+}
+
+template <class T, class H>
+void IndexedList<T, H>::reserve(int count)
+{
+    positions.reserve(count);
+}
+
+template <class T, class H>
+const List<T> &IndexedList<T, H>::asList(void) const
+{
+    return list;
+}
+
+template <class T, class H>
+void IndexedList<T, H>::reindexFrom(int ndx)
+{
+    int count = list.size();
+    for(; ndx < count; ++ndx)
+    {
+        *positions.getPtr(list._deque[ndx]) = ndx;
+    }
+}
+
+#endif //_CONTAINER_INDEXED_LIST_H
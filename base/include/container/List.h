@@ -37,6 +37,7 @@ class List
     const T &get(int ndx) const;
     T &get(int ndx);
     void set(int ndx, T &obj);
+    // contains()/indexOf()/add()/removeObj() scan the list, see IndexedList and HashSet for large unique lists.
     bool contains(const T &obj) const;
     int indexOf(const T &obj) const;
     bool add(const T &obj);
@@ -0,0 +1,234 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/MpmcRing.h                                                                        *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Bounded lock-free multi-producer/multi-consumer ring (sequence number per cell).         *
+ *                2. Multi-thread-safe w/o any lock, push/pop never block, and fail when full/empty.          *
+ *                3. T should be default constructible and assignable.                                        *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_MPMC_RING_H
+#define _CONTAINER_MPMC_RING_H
+
+// Standard includes
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#define CONTAINER_CACHE_LINE_SIZE   64
+
+template <class T>
+class MpmcRing
+{
+  public:
+    // capacity is rounded up to power of 2, and at least 2.
+    MpmcRing(int capacity);
+    ~MpmcRing();
+
+    int capacity(void) const;
+    // Approximate value when other threads are pushing/popping.
+    int size(void) const;
+    bool isEmpty(void) const;
+
+    bool tryPush(const T &obj);
+    bool tryPop(T &objHolder);
+    // 1. filler(T &) is called with the claimed cell, it is used to fill the cell directly w/o an extra copy.
+    // 2. filler should be short and should not push/pop this ring, other consumers of the claimed cell are
+    //    waiting for it.
+    template <class F>
+    bool tryPushWith(F filler);
+    // consumer(T &) is called with the claimed cell, the same restrictions of tryPushWith() are applied.
+    template <class F>
+    bool tryPopWith(F consumer);
+
+    // 1. Total claimed push/pop slots since construction, counters advance when a slot is claimed, before the
+    //    producer fills it or the consumer finishes with it.
+    // 2. Once poppedCount() >= a previous pushedCount(), all items pushed before are claimed by consumers, but
+    //    they may still be being consumed.  Barriers should count finished items by themselves, for example,
+    //    AsyncLogger compares pushedCount() with its own count of written records.
+    uint64_t pushedCount(void) const;
+    uint64_t poppedCount(void) const;
+
+  private:
+    struct Cell
+    {
+        std::atomic<uint64_t> sequence;
+        T data;
+    };
+
+    Cell *cells;
+    const uint64_t mask;
+    char _pad0[CONTAINER_CACHE_LINE_SIZE];
+    std::atomic<uint64_t> enqueuePos;
+    char _pad1[CONTAINER_CACHE_LINE_SIZE];
+    std::atomic<uint64_t> dequeuePos;
+    char _pad2[CONTAINER_CACHE_LINE_SIZE];
+
+    static uint64_t roundUpCapacity(int capacity);
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    MpmcRing(const MpmcRing &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    MpmcRing &operator=(const MpmcRing &);
+};
+
+template <class T>
+uint64_t MpmcRing<T>::roundUpCapacity(int capacity)
+{
+    uint64_t value = 2;
+    while(value < (uint64_t) capacity)
+    {
+        value <<= 1;
+    }
+    return value;
+}
+
+template <class T>
+MpmcRing<T>::MpmcRing(int capacity) : mask(roundUpCapacity(capacity) - 1), enqueuePos(0), dequeuePos(0)
+{
+    cells = new Cell[mask + 1];
+    for(uint64_t i = 0; i <= mask; ++i)
+    {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+MpmcRing<T>::~MpmcRing()
+{
+    delete [] cells;
+}
+
+template <class T>
+int MpmcRing<T>::capacity(void) const
+{
+    return (int) (mask + 1);
+}
+
+template <class T>
+int MpmcRing<T>::size(void) const
+{
+    uint64_t popped = dequeuePos.load(std::memory_order_acquire);
+    uint64_t pushed = enqueuePos.load(std::memory_order_acquire);
+    return (pushed > popped) ? (int) (pushed - popped) : 0;
+}
+
+template <class T>
+bool MpmcRing<T>::isEmpty(void) const
+{
+    return size() == 0;
+}
+
+template <class T>
+template <class F>
+bool MpmcRing<T>::tryPushWith(F filler)
+{
+    uint64_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Cell *cell;
+    for(;;)
+    {
+        cell = &cells[pos & mask];
+        uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+        int64_t diff = (int64_t) seq - (int64_t) pos;
+        if(diff == 0)
+        {
+            if(enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {
+            // Full.
+            return false;
+        }
+        else
+        {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    filler(cell->data);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+template <class F>
+bool MpmcRing<T>::tryPopWith(F consumer)
+{
+    uint64_t pos = dequeuePos.load(std::memory_order_relaxed);
+    Cell *cell;
+    for(;;)
+    {
+        cell = &cells[pos & mask];
+        uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+        int64_t diff = (int64_t) seq - (int64_t) (pos + 1);
+        if(diff == 0)
+        {
+            if(dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {
+            // Empty, or the producer of this cell is still filling it.
+            return false;
+        }
+        else
+        {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+    consumer(cell->data);
+    cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+struct _MpmcRingCopyIn
+{
+    const T &obj;
+    _MpmcRingCopyIn(const T &_obj) : obj(_obj) {}
+    void operator()(T &cell) { cell = obj; }
+};
+
+template <class T>
+struct _MpmcRingCopyOut
+{
+    T &objHolder;
+    _MpmcRingCopyOut(T &_objHolder) : objHolder(_objHolder) {}
+    void operator()(T &cell) { objHolder = cell; }
+};
+
+template <class T>
+bool MpmcRing<T>::tryPush(const T &obj)
+{
+    return tryPushWith(_MpmcRingCopyIn<T>(obj));
+}
+
+template <class T>
+bool MpmcRing<T>::tryPop(T &objHolder)
+{
+    return tryPopWith(_MpmcRingCopyOut<T>(objHolder));
+}
+
+template <class T>
+uint64_t MpmcRing<T>::pushedCount(void) const
+{
+    return enqueuePos.load(std::memory_order_acquire);
+}
+
+template <class T>
+uint64_t MpmcRing<T>::poppedCount(void) const
+{
+    return dequeuePos.load(std::memory_order_acquire);
+}
+
+#endif //_CONTAINER_MPMC_RING_H
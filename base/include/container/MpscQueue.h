@@ -0,0 +1,128 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/MpscQueue.h                                                                       *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Unbounded lock-free multi-producer/single-consumer linked queue (Vyukov).                *
+ *                2. Any thread can push, it is one atomic exchange plus a node allocation, it never fails.   *
+ *                   One consumer thread pops, it never blocks.                                               *
+ *                3. T should be default constructible and assignable.                                        *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_MPSC_QUEUE_H
+#define _CONTAINER_MPSC_QUEUE_H
+
+// Standard includes
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#ifndef CONTAINER_CACHE_LINE_SIZE
+#define CONTAINER_CACHE_LINE_SIZE   64
+#endif
+
+template <class T>
+class MpscQueue
+{
+  public:
+    MpscQueue(void);
+    // Items still queued are dropped.
+    ~MpscQueue();
+
+    // Any thread.
+    void push(const T &obj);
+    // The same as push(), it is never full, for the interface of the rings.
+    bool tryPush(const T &obj);
+    // 1. The consumer thread only.
+    // 2. Return false if it is empty, or the only pushing item is not linked by its producer yet, which takes
+    //    a few instructions.
+    bool tryPop(T &objHolder);
+    // The consumer thread only.
+    bool isEmpty(void) const;
+
+  private:
+    struct Node
+    {
+        std::atomic<Node *> next;
+        T data;
+    };
+
+    char _pad0[CONTAINER_CACHE_LINE_SIZE];
+    // The last pushed node, exchanged by producers.
+    std::atomic<Node *> tail;
+    char _pad1[CONTAINER_CACHE_LINE_SIZE];
+    // The consumer only, a stub node whose next is the first item.
+    Node *head;
+    char _pad2[CONTAINER_CACHE_LINE_SIZE];
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    MpscQueue(const MpscQueue &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    MpscQueue &operator=(const MpscQueue &);
+};
+
+template <class T>
+MpscQueue<T>::MpscQueue(void)
+{
+    Node *stub = new Node();
+    stub->next.store(0, std::memory_order_relaxed);
+    head = stub;
+    tail.store(stub, std::memory_order_relaxed);
+}
+
+template <class T>
+MpscQueue<T>::~MpscQueue()
+{
+    while(head)
+    {
+        Node *next = head->next.load(std::memory_order_relaxed);
+        delete head;
+        head = next;
+    }
+}
+
+template <class T>
+void MpscQueue<T>::push(const T &obj)
+{
+    Node *node = new Node();
+    node->next.store(0, std::memory_order_relaxed);
+    node->data = obj;
+    Node *previous = tail.exchange(node, std::memory_order_acq_rel);
+    // Between the exchange and the store, the consumer sees the queue ending at previous.
+    previous->next.store(node, std::memory_order_release);
+}
+
+template <class T>
+bool MpscQueue<T>::tryPush(const T &obj)
+{
+    push(obj);
+    return true;
+}
+
+template <class T>
+bool MpscQueue<T>::tryPop(T &objHolder)
+{
+    Node *next = head->next.load(std::memory_order_acquire);
+    if(!next)
+    {
+        return false;
+    }
+    // next becomes the stub, its data is not used any more.
+    objHolder = next->data;
+    delete head;
+    head = next;
+    return true;
+}
+
+template <class T>
+bool MpscQueue<T>::isEmpty(void) const
+{
+    return head->next.load(std::memory_order_acquire) == 0;
+}
+
+#endif //_CONTAINER_MPSC_QUEUE_H
@@ -0,0 +1,464 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/SmallList.h                                                                       *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Contiguous list w/ the first N objects stored inline, the same methods as List<T>.       *
+ *                2. Not multi-thread-safe.                                                                   *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_SMALL_LIST_H
+#define _CONTAINER_SMALL_LIST_H
+
+// Standard includes
+#include <stdlib.h>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/*!
+ * @brief List<T> for lists which usually hold a few objects, e.g. rules, filters and children.
+ *
+ * @remarks
+ *   1. Up to N objects are stored in the object itself, w/o any allocation.  std::deque of List<T> allocates its
+ *      block map and a block even for one object.
+ *   2. Beyond N, objects move to a heap array, which grows by double, and stays until destruction.
+ *   3. Objects are contiguous, begin()/end() iterate them by pointers, cache-friendly.  Pointers are valid until
+ *      the next add or remove.
+ *   4. Adding/removing in the middle moves the following objects, like std::vector.
+ */
+template <class T, int N>
+class SmallList
+{
+  public:
+    SmallList(void);
+    SmallList(const SmallList &other);
+    SmallList(SmallList &&other);
+    ~SmallList();
+
+    SmallList &operator=(const SmallList &other);
+    SmallList &operator=(SmallList &&other);
+
+    int size(void) const;
+    // N until it goes to the heap.
+    int capacity(void) const;
+    bool isInline(void) const;
+    const T &get(int ndx) const;
+    T &get(int ndx);
+    void set(int ndx, const T &obj);
+    bool contains(const T &obj) const;
+    int indexOf(const T &obj) const;
+    bool add(const T &obj);
+    bool add(int pos, const T &obj);
+    // The same as List<T>, for codes which promise no duplication by nature.
+    void addWithoutCheck(const T &obj);
+    void addWithoutCheck(int pos, const T &obj);
+    bool removeObj(const T &obj);
+    bool remove(const T &obj);
+    void removeByIndex(int ndx);
+    void remove(int ndx);
+    void clear(void);
+    void reserve(int count);
+    // 1. Only for T = "XXX *" (including void *)
+    // 2. free() is used, so, all items should be generated by alloc(), malloc(), strdup(), or whatever
+    //    free()-able functions.
+    void freeAllPtrItemsAndReset(void);
+    // 1. Only for T = "XXX *" and XXX is a class (or struct by new ...).
+    // 2. delete is used, so all objects should be created by new ....
+    void deleteAllObjsAndReset(void);
+
+    T *begin(void);
+    T *end(void);
+    const T *begin(void) const;
+    const T *end(void) const;
+
+  private:
+    T *items;
+    int count;
+    int cap;
+    alignas(T) unsigned char buffer[sizeof(T) * N];
+
+    T *inlineItems(void);
+    void checkIndex(int ndx) const;
+    // Move objects to a heap array of newCapacity.
+    void grow(int newCapacity);
+    void insertAt(int pos, const T &obj);
+    void eraseAt(int ndx);
+};
+
+/* Implementation for SmallList */
+
+template <class T, int N>
+T *SmallList<T, N>::inlineItems(void)
+{
+    return (T *) buffer;
+}
+
+template <class T, int N>
+SmallList<T, N>::SmallList(void) : items(inlineItems()), count(0), cap(N)
+{
+}
+
+template <class T, int N>
+SmallList<T, N>::SmallList(const SmallList &other) : items(inlineItems()), count(0), cap(N)
+{
+    reserve(other.count);
+    for(int i = 0; i < other.count; ++i)
+    {
+        new(&items[i]) T(other.items[i]);
+    }
+    count = other.count;
+}
+
+template <class T, int N>
+SmallList<T, N>::SmallList(SmallList &&other) : items(inlineItems()), count(0), cap(N)
+{
+    if(other.isInline())
+    {
+        for(int i = 0; i < other.count; ++i)
+        {
+            new(&items[i]) T(std::move(other.items[i]));
+        }
+        count = other.count;
+        other.clear();
+    }
+    else
+    {
+        items = other.items;
+        count = other.count;
+        cap = other.cap;
+        other.items = other.inlineItems();
+        other.count = 0;
+        other.cap = N;
+    }
+}
+
+template <class T, int N>
+SmallList<T, N>::~SmallList()
+{
+    clear();
+    if(!isInline())
+    {
+        ::operator delete(items);
+    }
+}
+
+template <class T, int N>
+SmallList<T, N> &SmallList<T, N>::operator=(const SmallList &other)
+{
+    if(this != &other)
+    {
+        clear();
+        reserve(other.count);
+        for(int i = 0; i < other.count; ++i)
+        {
+            new(&items[i]) T(other.items[i]);
+        }
+        count = other.count;
+    }
+    return *this;
+}
+
+template <class T, int N>
+SmallList<T, N> &SmallList<T, N>::operator=(SmallList &&other)
+{
+    if(this == &other)
+    {
+        return *this;
+    }
+    clear();
+    if(other.isInline())
+    {
+        for(int i = 0; i < other.count; ++i)
+        {
+            new(&items[i]) T(std::move(other.items[i]));
+        }
+        count = other.count;
+        other.clear();
+    }
+    else
+    {
+        if(!isInline())
+        {
+            ::operator delete(items);
+        }
+        items = other.items;
+        count = other.count;
+        cap = other.cap;
+        other.items = other.inlineItems();
+        other.count = 0;
+        other.cap = N;
+    }
+    return *this;
+}
+
+template <class T, int N>
+int SmallList<T, N>::size(void) const
+{
+    return count;
+}
+
+template <class T, int N>
+int SmallList<T, N>::capacity(void) const
+{
+    return cap;
+}
+
+template <class T, int N>
+bool SmallList<T, N>::isInline(void) const
+{
+    return items == (const T *) buffer;
+}
+
+template <class T, int N>
+void SmallList<T, N>::checkIndex(int ndx) const
+{
+    // The same as std::deque::at() of List<T>.
+    if((unsigned) ndx >= (unsigned) count)
+    {
+        throw std::out_of_range("SmallList");
+    }
+}
+
+template <class T, int N>
+const T &SmallList<T, N>::get(int ndx) const
+{
+    checkIndex(ndx);
+    return items[ndx];
+}
+
+template <class T, int N>
+T &SmallList<T, N>::get(int ndx)
+{
+    checkIndex(ndx);
+    return items[ndx];
+}
+
+template <class T, int N>
+void SmallList<T, N>::set(int ndx, const T &obj)
+{
+    checkIndex(ndx);
+    items[ndx] = obj;
+}
+
+template <class T, int N>
+bool SmallList<T, N>::contains(const T &obj) const
+{
+    return indexOf(obj) >= 0;
+}
+
+template <class T, int N>
+int SmallList<T, N>::indexOf(const T &obj) const
+{
+    for(int i = 0; i < count; ++i)
+    {
+        if(items[i] == obj)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+template <class T, int N>
+bool SmallList<T, N>::add(const T &obj)
+{
+    if(contains(obj))
+    {
+        return false;
+    }
+    insertAt(count, obj);
+    return true;
+}
+
+template <class T, int N>
+bool SmallList<T, N>::add(int pos, const T &obj)
+{
+    if(contains(obj))
+    {
+        return false;
+    }
+    insertAt(pos, obj);
+    return true;
+}
+
+template <class T, int N>
+void SmallList<T, N>::addWithoutCheck(const T &obj)
+{
+    insertAt(count, obj);
+}
+
+template <class T, int N>
+void SmallList<T, N>::addWithoutCheck(int pos, const T &obj)
+{
+    insertAt(pos, obj);
+}
+
+template <class T, int N>
+bool SmallList<T, N>::removeObj(const T &obj)
+{
+    int ndx = indexOf(obj);
+    if(ndx < 0)
+    {
+        return false;
+    }
+    eraseAt(ndx);
+    return true;
+}
+
+template <class T, int N>
+bool SmallList<T, N>::remove(const T &obj)
+{
+    return removeObj(obj);
+}
+
+template <class T, int N>
+void SmallList<T, N>::removeByIndex(int ndx)
+{
+    checkIndex(ndx);
+    eraseAt(ndx);
+}
+
+template <class T, int N>
+void SmallList<T, N>::remove(int ndx)
+{
+    removeByIndex(ndx);
+}
+
+template <class T, int N>
+void SmallList<T, N>::clear(void)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        items[i].~T();
+    }
+    count = 0;
+}
+
+template <class T, int N>
+void SmallList<T, N>::reserve(int reservedCount)
+{
+    if(reservedCount > cap)
+    {
+        int newCapacity = cap * 2;
+        while(newCapacity < reservedCount)
+        {
+            newCapacity *= 2;
+        }
+        grow(newCapacity);
+    }
+}
+
+template <class T, int N>
+void SmallList<T, N>::freeAllPtrItemsAndReset(void)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        free((void *) items[i]);
+    }
+    clear();
+}
+
+template <class T, int N>
+void SmallList<T, N>::deleteAllObjsAndReset(void)
+{
+    for(int i = 0; i < count; ++i)
+    {
+        delete items[i];
+    }
+    clear();
+}
+
+template <class T, int N>
+T *SmallList<T, N>::begin(void)
+{
+    return items;
+}
+
+template <class T, int N>
+T *SmallList<T, N>::end(void)
+{
+    return items + count;
+}
+
+template <class T, int N>
+const T *SmallList<T, N>::begin(void) const
+{
+    return items;
+}
+
+template <class T, int N>
+const T *SmallList<T, N>::end(void) const
+{
+    return items + count;
+}
+
+template <class T, int N>
+void SmallList<T, N>::grow(int newCapacity)
+{
+    T *newItems = (T *) ::operator new(sizeof(T) * newCapacity);
+    for(int i = 0; i < count; ++i)
+    {
+        new(&newItems[i]) T(std::move(items[i]));
+        items[i].~T();
+    }
+    if(!isInline())
+    {
+        ::operator delete(items);
+    }
+    items = newItems;
+    cap = newCapacity;
+}
+
+template <class T, int N>
+void SmallList<T, N>::insertAt(int pos, const T &obj)
+{
+    if((unsigned) pos > (unsigned) count)
+    {
+        throw std::out_of_range("SmallList");
+    }
+    if((pos == count) && (count < cap))
+    {
+        new(&items[count]) T(obj);
+        ++count;
+        return;
+    }
+    // obj may be one of the objects, which move below.
+    T copy(obj);
+    if(count == cap)
+    {
+        grow(cap * 2);
+    }
+    if(pos == count)
+    {
+        new(&items[count]) T(std::move(copy));
+    }
+    else
+    {
+        new(&items[count]) T(std::move(items[count - 1]));
+        for(int i = count - 1; i > pos; --i)
+        {
+            items[i] = std::move(items[i - 1]);
+        }
+        items[pos] = std::move(copy);
+    }
+    ++count;
+}
+
+template <class T, int N>
+void SmallList<T, N>::eraseAt(int ndx)
+{
+    for(int i = ndx + 1; i < count; ++i)
+    {
+        items[i - 1] = std::move(items[i]);
+    }
+    --count;
+    items[count].~T();
+}
+
+#endif //_CONTAINER_SMALL_LIST_H
@@ -0,0 +1,208 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  container/SpscRing.h                                                                        *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Bounded lock-free single-producer/single-consumer ring, head/tail on own cache lines.    *
+ *                2. One producer thread and one consumer thread, push/pop never block, and fail when         *
+ *                   full/empty.                                                                              *
+ *                3. T should be default constructible and assignable.                                        *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _CONTAINER_SPSC_RING_H
+#define _CONTAINER_SPSC_RING_H
+
+// Standard includes
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#ifndef CONTAINER_CACHE_LINE_SIZE
+#define CONTAINER_CACHE_LINE_SIZE   64
+#endif
+
+template <class T>
+class SpscRing
+{
+  public:
+    // capacity is rounded up to power of 2, and at least 2.
+    SpscRing(int capacity);
+    ~SpscRing();
+
+    int capacity(void) const;
+    // Approximate value when the other side is pushing/popping.
+    int size(void) const;
+    bool isEmpty(void) const;
+
+    // The producer thread only.
+    bool tryPush(const T &obj);
+    // 1. The producer thread only.
+    // 2. filler(T &) is called with the free cell, it is used to fill the cell directly w/o an extra copy.
+    template <class F>
+    bool tryPushWith(F filler);
+    // The consumer thread only.
+    bool tryPop(T &objHolder);
+    // 1. The consumer thread only.
+    // 2. consumer(T &) is called with the cell, which is not reused by the producer until it returns.
+    template <class F>
+    bool tryPopWith(F consumer);
+
+    // Total pushed/popped items since construction.
+    uint64_t pushedCount(void) const;
+    uint64_t poppedCount(void) const;
+
+  private:
+    T *cells;
+    const uint64_t mask;
+    char _pad0[CONTAINER_CACHE_LINE_SIZE];
+    // Written by the producer.
+    std::atomic<uint64_t> tail;
+    // The producer's copy of head, refreshed only when the ring looks full.
+    uint64_t cachedHead;
+    char _pad1[CONTAINER_CACHE_LINE_SIZE];
+    // Written by the consumer.
+    std::atomic<uint64_t> head;
+    // The consumer's copy of tail, refreshed only when the ring looks empty.
+    uint64_t cachedTail;
+    char _pad2[CONTAINER_CACHE_LINE_SIZE];
+
+    static uint64_t roundUpCapacity(int capacity);
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    SpscRing(const SpscRing &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    SpscRing &operator=(const SpscRing &);
+};
+
+template <class T>
+uint64_t SpscRing<T>::roundUpCapacity(int capacity)
+{
+    uint64_t value = 2;
+    while(value < (uint64_t) capacity)
+    {
+        value <<= 1;
+    }
+    return value;
+}
+
+template <class T>
+SpscRing<T>::SpscRing(int capacity) :
+    mask(roundUpCapacity(capacity) - 1), tail(0), cachedHead(0), head(0), cachedTail(0)
+{
+    cells = new T[mask + 1];
+}
+
+template <class T>
+SpscRing<T>::~SpscRing()
+{
+    delete [] cells;
+}
+
+template <class T>
+int SpscRing<T>::capacity(void) const
+{
+    return (int) (mask + 1);
+}
+
+template <class T>
+int SpscRing<T>::size(void) const
+{
+    uint64_t popped = head.load(std::memory_order_acquire);
+    uint64_t pushed = tail.load(std::memory_order_acquire);
+    return (pushed > popped) ? (int) (pushed - popped) : 0;
+}
+
+template <class T>
+bool SpscRing<T>::isEmpty(void) const
+{
+    return size() == 0;
+}
+
+template <class T>
+template <class F>
+bool SpscRing<T>::tryPushWith(F filler)
+{
+    uint64_t pos = tail.load(std::memory_order_relaxed);
+    if(pos - cachedHead > mask)
+    {
+        cachedHead = head.load(std::memory_order_acquire);
+        if(pos - cachedHead > mask)
+        {
+            return false;
+        }
+    }
+    filler(cells[pos & mask]);
+    tail.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+template <class F>
+bool SpscRing<T>::tryPopWith(F consumer)
+{
+    uint64_t pos = head.load(std::memory_order_relaxed);
+    if(pos == cachedTail)
+    {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if(pos == cachedTail)
+        {
+            return false;
+        }
+    }
+    consumer(cells[pos & mask]);
+    head.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+bool SpscRing<T>::tryPush(const T &obj)
+{
+    uint64_t pos = tail.load(std::memory_order_relaxed);
+    if(pos - cachedHead > mask)
+    {
+        cachedHead = head.load(std::memory_order_acquire);
+        if(pos - cachedHead > mask)
+        {
+            return false;
+        }
+    }
+    cells[pos & mask] = obj;
+    tail.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+bool SpscRing<T>::tryPop(T &objHolder)
+{
+    uint64_t pos = head.load(std::memory_order_relaxed);
+    if(pos == cachedTail)
+    {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if(pos == cachedTail)
+        {
+            return false;
+        }
+    }
+    objHolder = cells[pos & mask];
+    head.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+uint64_t SpscRing<T>::pushedCount(void) const
+{
+    return tail.load(std::memory_order_acquire);
+}
+
+template <class T>
+uint64_t SpscRing<T>::poppedCount(void) const
+{
+    return head.load(std::memory_order_acquire);
+}
+
+#endif //_CONTAINER_SPSC_RING_H
@@ -0,0 +1,458 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/AsyncLogger.h                                                                           *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Asynchronous SysLogger, log records are queued into a lock-free ring, and written to the    *
+ *                target SysLogger (FileBasedLogger, AutoSerialFileLogger, ConsoleLogger, ...) by one writer  *
+ *                thread.                                                                                     *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_ASYNC_LOGGER_H
+#define _LOG_ASYNC_LOGGER_H
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+// libBase includes
+#include <baseResultCode.h>
+#include <container/MpmcRing.h>
+#include <osal/OsalMutex.h>
+#include <osal/OsalCondVar.h>
+#include <task/RunnableBridge.h>
+#include <task/Thread.h>
+#include <util/SmartMutexLock.h>
+#include <util/TimeUtil.h>
+#include <log/BinaryLogRecord.h>
+#include <log/DelegateLogger.h>
+#include <log/logLineFormat.h>
+
+#define ASYNC_LOG_TAG_SIZE          32
+#define ASYNC_LOG_TEXT_SIZE         472
+// Max wait of the writer thread before re-checking the ring, it bounds the latency of any missed wake-up.
+#define ASYNC_LOG_WRITER_IDLE_MS    50
+
+/*!
+ * @brief What to do when the ring is full.
+ */
+enum AsyncLogOverflowPolicy
+{
+    //! Drop the message being logged, older queued messages are kept.
+    ASYNC_LOG_DROP_NEWEST,
+    //! Drop the oldest queued message to make room for the message being logged.
+    ASYNC_LOG_DROP_OLDEST
+};
+
+struct AsyncLogRecord
+{
+    LogLevel logLevel;
+    // Only for deferred formatting, text holds the arguments encoded by BinaryLogRecord::encodeArgs().
+    const char *formatStr;
+    int argsSize;
+    int threadID;
+    int64_t timestampMS;
+    char tag[ASYNC_LOG_TAG_SIZE];
+    // Formatted message (cut if longer than ASYNC_LOG_TEXT_SIZE - 1), or encoded arguments.
+    char text[ASYNC_LOG_TEXT_SIZE];
+};
+
+/*!
+ * @brief SysLogger decorator which moves the formatted message to a bounded lock-free ring, the target's
+ *        log() (and so the FILE * write) is only called by the writer thread.
+ *
+ * @remarks
+ *   1. Memory is bounded by maxRecords * sizeof(AsyncLogRecord), no allocation when logging.
+ *   2. Once records are dropped, one LOG_WARNING record with the dropped count is written to the target.
+ *   3. flush() and cut() are barriers, all records logged before are written to the target first.
+ *   4. The time and thread ID of each message are captured by log(), the message order is kept.  If the target
+ *      is a LogLineSink (RingBufferLogger, PreallocatedFileLogger, BinaryFileLogger), lines are written by them.
+ *      Other targets (FileBasedLogger, ...) get the message only, and stamp lines with the time and thread ID
+ *      of the writer thread.
+ *   5. With deferred formatting, log() only captures raw arguments, and the writer thread formats them.  If the
+ *      target is a BinaryLogSink (for example, BinaryFileLogger), records are passed w/o formatting, with the
+ *      original time and thread ID.
+ */
+class AsyncLogger : public DelegateLogger
+{
+  public:
+    /*!
+     * Constructor.
+     *
+     * @param target The SysLogger really writes messages, see DelegateLogger for its lifetime.
+     * @param maxRecords Capacity of the ring, rounded up to power of 2.
+     * @param policy What to do when the ring is full.
+     */
+    AsyncLogger(SysLogger *target, int maxRecords = 512, AsyncLogOverflowPolicy policy = ASYNC_LOG_DROP_NEWEST);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~AsyncLogger();
+
+    // Total dropped records since constructed.
+    uint64_t totalDroppedRecords(void);
+
+    // 1. Default is false.  Should be set before started.
+    // 2. Format strings are referenced by pointers until written, so, they should be string literals (or live
+    //    longer than this logger).  Arguments (including strings) are copied.
+    // 3. Formats which cannot be captured (see BinaryLogRecord::encodeArgs()) are formatted by log() directly.
+    void setDeferredFormatting(bool deferred);
+
+  protected:
+    /* Implementation for SysLogger */
+    // Target is started first, and then the writer thread.
+    virtual int start(void);
+    // All queued records are written, and then the target is stopped.
+    virtual void stop(void);
+    virtual void log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList);
+    virtual void flush(void);
+    virtual void cut(void);
+    virtual size_t currentSize(void);
+
+  private:
+    MpmcRing<AsyncLogRecord> ring;
+    const AsyncLogOverflowPolicy policy;
+    BinaryLogSink *const binaryTarget;
+    LogLineSink *const lineTarget;
+    bool deferredFormatting = false;
+    // Serialize all target calls, between the writer thread and LogSystem's control calls.
+    OsalMutex targetMutex;
+    // Protect writer sleep/wake-up and flush barrier waits.
+    OsalMutex wakeMutex;
+    OsalCondVar condVarWake;
+    OsalCondVar condVarDrained;
+    int drainWaiters = 0;
+    std::atomic<bool> writerSleeping;
+    std::atomic<bool> running;
+    // Records before this ring position are written (or dropped).
+    std::atomic<uint64_t> drainedPos;
+    std::atomic<uint64_t> pendingDropped;
+    std::atomic<uint64_t> totalDropped;
+    Thread *writerThread = 0;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    AsyncLogger(const AsyncLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    AsyncLogger &operator=(const AsyncLogger &);
+
+    void countDropped(void);
+    void wakeWriter(void);
+    void waitDrained(void);
+    void reportDropped(void);
+    void write(AsyncLogRecord &record);
+    // Write a formatted message of record, by its time and thread ID.
+    void writeLine(const AsyncLogRecord &record, const char *text);
+    void drain(void);
+    void stopWriter(void);
+    int writerLoop(void);
+    static int _writerLoop(void *context);
+};
+
+struct _AsyncLogFiller
+{
+    const char *tag;
+    LogLevel logLevel;
+    const char *formatStr;
+    va_list *variableArgList;
+    bool deferred;
+
+    void operator()(AsyncLogRecord &record)
+    {
+        record.logLevel = logLevel;
+        strncpy(record.tag, tag ? tag : "", ASYNC_LOG_TAG_SIZE - 1);
+        record.tag[ASYNC_LOG_TAG_SIZE - 1] = '\0';
+        record.formatStr = 0;
+        record.threadID = BinaryLogRecord::currentThreadID();
+        record.timestampMS = TimeUtil::now();
+        if(deferred)
+        {
+            va_list argList;
+            va_copy(argList, *variableArgList);
+            record.argsSize = BinaryLogRecord::encodeArgs(record.text, ASYNC_LOG_TEXT_SIZE, formatStr, argList);
+            va_end(argList);
+            if(record.argsSize >= 0)
+            {
+                record.formatStr = formatStr;
+                return;
+            }
+        }
+        if(vsnprintf(record.text, ASYNC_LOG_TEXT_SIZE, formatStr, *variableArgList) < 0)
+        {
+            record.text[0] = '\0';
+        }
+    }
+};
+
+struct _AsyncLogDiscarder
+{
+    void operator()(AsyncLogRecord &)
+    {
+    }
+};
+
+inline AsyncLogger::AsyncLogger(SysLogger *target, int maxRecords, AsyncLogOverflowPolicy _policy) :
+    DelegateLogger(target), ring(maxRecords), policy(_policy), binaryTarget(dynamic_cast<BinaryLogSink *>(target)),
+    lineTarget(dynamic_cast<LogLineSink *>(target)), writerSleeping(false), running(false),
+    drainedPos(0), pendingDropped(0), totalDropped(0)
+{
+}
+
+inline AsyncLogger::~AsyncLogger()
+{
+    stopWriter();
+    drain();
+}
+
+inline uint64_t AsyncLogger::totalDroppedRecords(void)
+{
+    return totalDropped.load(std::memory_order_relaxed);
+}
+
+inline void AsyncLogger::setDeferredFormatting(bool deferred)
+{
+    deferredFormatting = deferred;
+}
+
+inline int AsyncLogger::start(void)
+{
+    int result;
+    {
+        SmartMutexLock lock(targetMutex);
+        result = delegateStart();
+    }
+    if((result < 0) || writerThread)
+    {
+        return result;
+    }
+    RunnableBridge *bridge = new RunnableBridge(_writerLoop, this);
+    writerThread = new Thread(bridge);
+    bridge->deref();
+    running.store(true);
+    if(writerThread->start() < 0)
+    {
+        // Fallback to synchronous writes by log().
+        running.store(false);
+        writerThread->deref();
+        writerThread = 0;
+    }
+    return result;
+}
+
+inline void AsyncLogger::stop(void)
+{
+    stopWriter();
+    drain();
+    SmartMutexLock lock(targetMutex);
+    delegateStop();
+}
+
+inline void AsyncLogger::log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList)
+{
+    // Copy is required, va_list parameter may be an array type which cannot be addressed portably.
+    va_list argList;
+    va_copy(argList, variableArgList);
+    _AsyncLogFiller filler = { tag, logLevel, formatStr, &argList, deferredFormatting };
+    if(!ring.tryPushWith(filler))
+    {
+        bool pushed = false;
+        if(policy == ASYNC_LOG_DROP_OLDEST)
+        {
+            // Few retries are enough, other producers may take the freed cell.
+            for(int i = 0; (i < 4) && !pushed; ++i)
+            {
+                if(ring.tryPopWith(_AsyncLogDiscarder()))
+                {
+                    countDropped();
+                }
+                pushed = ring.tryPushWith(filler);
+            }
+        }
+        if(!pushed)
+        {
+            countDropped();
+        }
+    }
+    va_end(argList);
+    if(running.load(std::memory_order_relaxed))
+    {
+        wakeWriter();
+    }
+    else
+    {
+        drain();
+    }
+}
+
+inline void AsyncLogger::flush(void)
+{
+    waitDrained();
+    SmartMutexLock lock(targetMutex);
+    delegateFlush();
+}
+
+inline void AsyncLogger::cut(void)
+{
+    waitDrained();
+    SmartMutexLock lock(targetMutex);
+    delegateCut();
+}
+
+inline size_t AsyncLogger::currentSize(void)
+{
+    SmartMutexLock lock(targetMutex);
+    return delegateCurrentSize();
+}
+
+inline void AsyncLogger::countDropped(void)
+{
+    pendingDropped.fetch_add(1, std::memory_order_relaxed);
+    totalDropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void AsyncLogger::wakeWriter(void)
+{
+    // Pair with the seq_cst store of writerSleeping in writerLoop(), the writer either sees the new record, or
+    // we see it sleeping.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(writerSleeping.load(std::memory_order_relaxed))
+    {
+        SmartMutexLock lock(wakeMutex);
+        condVarWake.signal();
+    }
+}
+
+inline void AsyncLogger::waitDrained(void)
+{
+    uint64_t ticket = ring.pushedCount();
+    if(running.load())
+    {
+        SmartMutexLock lock(wakeMutex);
+        ++drainWaiters;
+        while(running.load() && (drainedPos.load() < ticket))
+        {
+            condVarWake.signal();
+            condVarDrained.wait(wakeMutex, ASYNC_LOG_WRITER_IDLE_MS);
+        }
+        --drainWaiters;
+    }
+    if(!running.load())
+    {
+        drain();
+    }
+}
+
+inline void AsyncLogger::reportDropped(void)
+{
+    uint64_t dropped = pendingDropped.exchange(0, std::memory_order_relaxed);
+    if(dropped)
+    {
+        SmartMutexLock lock(targetMutex);
+        delegateLogFormatted("AsyncLogger", LOG_WARNING, "%llu log records dropped (ring full)",
+                                                                                   (unsigned long long) dropped);
+    }
+}
+
+inline void AsyncLogger::write(AsyncLogRecord &record)
+{
+    if(!record.formatStr)
+    {
+        writeLine(record, record.text);
+    }
+    else if(binaryTarget)
+    {
+        SmartMutexLock lock(targetMutex);
+        binaryTarget->logEncoded(record.tag, record.logLevel, record.timestampMS, record.threadID,
+                                 record.formatStr, record.text, record.argsSize);
+    }
+    else
+    {
+        char text[ASYNC_LOG_TEXT_SIZE * 2];
+        if(BinaryLogRecord::formatArgs(text, sizeof(text), record.formatStr, record.text, record.argsSize) < 0)
+        {
+            snprintf(text, sizeof(text), "(undecodable record of \"%s\")", record.formatStr);
+        }
+        writeLine(record, text);
+    }
+}
+
+inline void AsyncLogger::writeLine(const AsyncLogRecord &record, const char *text)
+{
+    if(lineTarget)
+    {
+        SmartMutexLock lock(targetMutex);
+        lineTarget->logLine(record.tag, record.logLevel, record.timestampMS, record.threadID, text);
+        return;
+    }
+    // The target puts its own prefix, so the line format of its files is kept.
+    SmartMutexLock lock(targetMutex);
+    delegateLogFormatted(record.tag, record.logLevel, "%s", text);
+}
+
+inline void AsyncLogger::drain(void)
+{
+    AsyncLogRecord record;
+    reportDropped();
+    while(ring.tryPop(record))
+    {
+        write(record);
+        reportDropped();
+    }
+}
+
+inline void AsyncLogger::stopWriter(void)
+{
+    if(!writerThread)
+    {
+        return;
+    }
+    {
+        SmartMutexLock lock(wakeMutex);
+        running.store(false);
+        condVarWake.signal();
+        condVarDrained.broadcast();
+    }
+    writerThread->join();
+    writerThread->deref();
+    writerThread = 0;
+}
+
+inline int AsyncLogger::writerLoop(void)
+{
+    for(;;)
+    {
+        drain();
+        wakeMutex.lock();
+        drainedPos.store(ring.poppedCount());
+        if(drainWaiters > 0)
+        {
+            condVarDrained.broadcast();
+        }
+        if(!running.load())
+        {
+            wakeMutex.unlock();
+            break;
+        }
+        writerSleeping.store(true);
+        if(ring.isEmpty() && (pendingDropped.load(std::memory_order_relaxed) == 0))
+        {
+            condVarWake.wait(wakeMutex, ASYNC_LOG_WRITER_IDLE_MS);
+        }
+        writerSleeping.store(false);
+        wakeMutex.unlock();
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline int AsyncLogger::_writerLoop(void *context)
+{
+    return ((AsyncLogger *) context)->writerLoop();
+}
+
+#endif//_LOG_ASYNC_LOGGER_H
@@ -0,0 +1,325 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/BinaryFileLogger.h                                                                      *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  AutoSerialFileLogger which writes binary log records (see log/BinaryLogRecord.h), messages  *
+ *                are not formatted, and files can be decoded to text by tools/BinaryLogDecoder.              *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_BINARY_FILE_LOGGER_H
+#define _LOG_BINARY_FILE_LOGGER_H
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+// libBase includes
+#include <util/SmartMutexLock.h>
+#include <util/TimeUtil.h>
+#include <log/AutoSerialFileLogger.h>
+#include <log/BinaryLogRecord.h>
+#include <log/logLineFormat.h>
+
+// Per file, once exceeded, messages of new formats are logged as text records.
+#define BINARY_LOG_MAX_FORMATS      1024
+#define BINARY_LOG_MAX_TAGS         256
+
+// Open addressing string -> ID table, per log file.  Not multi-thread-safe.
+class _BinaryLogDictionary
+{
+  public:
+    // 1. byPointer: key is the string pointer (format strings are usually literals), content is verified to
+    //    handle re-used buffers.  Otherwise, key is the string content.
+    // 2. maxItems should be power of 2.
+    _BinaryLogDictionary(int maxItems, bool byPointer);
+    ~_BinaryLogDictionary();
+
+    // 1. Return the ID, and *isNewHolder is set to true if it is just defined.
+    // 2. BINARY_LOG_NO_ID is returned if the dictionary is full.
+    uint16_t lookup(const char *str, bool *isNewHolder);
+    void reset(void);
+
+  private:
+    struct Item
+    {
+        const char *key;
+        char *str;
+        uint32_t hash;
+        uint16_t id;
+    };
+
+    Item *items;
+    const int mask;
+    const bool byPointer;
+    int nextID = 0;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    _BinaryLogDictionary(const _BinaryLogDictionary &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    _BinaryLogDictionary &operator=(const _BinaryLogDictionary &);
+};
+
+/*!
+ * @brief Binary AutoSerialFileLogger, file naming, cutting and cleanup are the same as AutoSerialFileLogger.
+ *
+ * @remarks
+ *   1. log() only captures raw arguments (no vsnprintf), and the record is usually several times smaller than
+ *      the text line.
+ *   2. Each file starts with BINARY_LOG_FILE_MAGIC, and format/tag strings are defined once per file, so files
+ *      can be decoded independently.  File names still end with ".log".
+ *   3. It is also a BinaryLogSink, AsyncLogger with deferred formatting passes its encoded records directly.
+ *      And a LogLineSink, formatted messages through AsyncLogger are text records of the original time and
+ *      thread ID.
+ */
+class BinaryFileLogger : public AutoSerialFileLogger, public BinaryLogSink, public LogLineSink
+{
+  public:
+    BinaryFileLogger(const char *fullLogDirPath, const char *baseName, int maxTotalSizeInMB = 10);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~BinaryFileLogger();
+
+    /* Implementation for BinaryLogSink */
+    virtual void logEncoded(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                            const char *formatStr, const void *args, int argsSize);
+
+    /* Implementation for LogLineSink */
+    // Written as a text record, cut to BINARY_LOG_MAX_ARGS_SIZE - 1.
+    virtual void logLine(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                         const char *logStr);
+
+  protected:
+    /* Implementation for SysLogger */
+    virtual void log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList);
+    // Called right before a new log file is opened (with file mutex locked).
+    virtual std::string generateNextFilename(void);
+
+  private:
+    _BinaryLogDictionary formats;
+    _BinaryLogDictionary tags;
+    // Protected by fileMutex().
+    bool isNewFile = true;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    BinaryFileLogger(const BinaryFileLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    BinaryFileLogger &operator=(const BinaryFileLogger &);
+
+    // Write file magic and reset dictionaries if the file is just opened.
+    void checkNewFile(FILE *fp);
+    uint16_t define(FILE *fp, _BinaryLogDictionary &dictionary, BinaryLogRecordType type, const char *str);
+    void writeEntry(FILE *fp, BinaryLogRecordType type, LogLevel logLevel, int64_t timestampMS, int threadID,
+                    uint16_t tagID, uint16_t formatID, const void *data, int dataSize);
+};
+
+inline _BinaryLogDictionary::_BinaryLogDictionary(int maxItems, bool _byPointer) :
+    mask(maxItems * 2 - 1), byPointer(_byPointer)
+{
+    items = (Item *) calloc(mask + 1, sizeof(Item));
+}
+
+inline _BinaryLogDictionary::~_BinaryLogDictionary()
+{
+    reset();
+    free(items);
+}
+
+inline uint16_t _BinaryLogDictionary::lookup(const char *str, bool *isNewHolder)
+{
+    uint32_t hash;
+    if(byPointer)
+    {
+        hash = (uint32_t) (((uintptr_t) str >> 3) * 2654435761u);
+    }
+    else
+    {
+        // FNV-1a.
+        hash = 2166136261u;
+        for(const unsigned char *ptr = (const unsigned char *) str; *ptr; ++ptr)
+        {
+            hash = (hash ^ *ptr) * 16777619u;
+        }
+    }
+    *isNewHolder = false;
+    for(int i = 0; i <= mask; ++i)
+    {
+        Item &item = items[(hash + i) & mask];
+        if(!item.str)
+        {
+            if(nextID > (mask >> 1))
+            {
+                return BINARY_LOG_NO_ID;
+            }
+            item.key = str;
+            item.str = strdup(str);
+            item.hash = hash;
+            item.id = (uint16_t) nextID++;
+            *isNewHolder = true;
+            return item.id;
+        }
+        if(byPointer ? (item.key == str) : ((item.hash == hash) && (strcmp(item.str, str) == 0)))
+        {
+            if(byPointer && (strcmp(item.str, str) != 0))
+            {
+                // Same buffer with another format, re-define it.
+                if(nextID > (mask >> 1))
+                {
+                    return BINARY_LOG_NO_ID;
+                }
+                free(item.str);
+                item.str = strdup(str);
+                item.id = (uint16_t) nextID++;
+                *isNewHolder = true;
+            }
+            return item.id;
+        }
+    }
+    return BINARY_LOG_NO_ID;
+}
+
+inline void _BinaryLogDictionary::reset(void)
+{
+    for(int i = 0; i <= mask; ++i)
+    {
+        free(items[i].str);
+    }
+    memset(items, 0, (mask + 1) * sizeof(Item));
+    nextID = 0;
+}
+
+inline BinaryFileLogger::BinaryFileLogger(const char *fullLogDirPath, const char *baseName, int maxTotalSizeInMB) :
+    AutoSerialFileLogger(fullLogDirPath, baseName, maxTotalSizeInMB), formats(BINARY_LOG_MAX_FORMATS, true),
+    tags(BINARY_LOG_MAX_TAGS, false)
+{
+}
+
+inline BinaryFileLogger::~BinaryFileLogger()
+{
+}
+
+inline void BinaryFileLogger::log(const char *tag, LogLevel logLevel, const char *formatStr,
+                                                                                       va_list variableArgList)
+{
+    char args[BINARY_LOG_MAX_ARGS_SIZE];
+    va_list argList;
+    va_copy(argList, variableArgList);
+    int argsSize = BinaryLogRecord::encodeArgs(args, sizeof(args), formatStr, argList);
+    va_end(argList);
+    if(argsSize >= 0)
+    {
+        logEncoded(tag, logLevel, TimeUtil::now(), BinaryLogRecord::currentThreadID(), formatStr, args, argsSize);
+        return;
+    }
+    // Cannot be captured, log as text.
+    if(vsnprintf(args, sizeof(args), formatStr, variableArgList) < 0)
+    {
+        args[0] = '\0';
+    }
+    logLine(tag, logLevel, TimeUtil::now(), BinaryLogRecord::currentThreadID(), args);
+}
+
+inline void BinaryFileLogger::logLine(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                                      const char *logStr)
+{
+    size_t len = strnlen(logStr, BINARY_LOG_MAX_ARGS_SIZE - 1);
+    SmartMutexLock lock(fileMutex());
+    FILE *fp = currentFile();
+    if(fp)
+    {
+        checkNewFile(fp);
+        writeEntry(fp, BINARY_LOG_RECORD_TEXT, logLevel, timestampMS, threadID,
+                   define(fp, tags, BINARY_LOG_RECORD_TAG, tag ? tag : ""), BINARY_LOG_NO_ID, logStr, (int) len);
+    }
+}
+
+inline void BinaryFileLogger::logEncoded(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                                         const char *formatStr, const void *args, int argsSize)
+{
+    SmartMutexLock lock(fileMutex());
+    FILE *fp = currentFile();
+    if(!fp)
+    {
+        return;
+    }
+    checkNewFile(fp);
+    uint16_t tagID = define(fp, tags, BINARY_LOG_RECORD_TAG, tag ? tag : "");
+    uint16_t formatID = define(fp, formats, BINARY_LOG_RECORD_FORMAT, formatStr);
+    if(formatID != BINARY_LOG_NO_ID)
+    {
+        writeEntry(fp, BINARY_LOG_RECORD_ENTRY, logLevel, timestampMS, threadID, tagID, formatID, args, argsSize);
+        return;
+    }
+    char text[BINARY_LOG_MAX_ARGS_SIZE];
+    int len = BinaryLogRecord::formatArgs(text, sizeof(text), formatStr, args, argsSize);
+    writeEntry(fp, BINARY_LOG_RECORD_TEXT, logLevel, timestampMS, threadID, tagID, BINARY_LOG_NO_ID, text,
+                                                                                           (len < 0) ? 0 : len);
+}
+
+inline std::string BinaryFileLogger::generateNextFilename(void)
+{
+    isNewFile = true;
+    return AutoSerialFileLogger::generateNextFilename();
+}
+
+inline void BinaryFileLogger::checkNewFile(FILE *fp)
+{
+    if(isNewFile)
+    {
+        formats.reset();
+        tags.reset();
+        fwrite(BINARY_LOG_FILE_MAGIC, 1, BINARY_LOG_FILE_MAGIC_SIZE, fp);
+        isNewFile = false;
+    }
+}
+
+inline uint16_t BinaryFileLogger::define(FILE *fp, _BinaryLogDictionary &dictionary, BinaryLogRecordType type,
+                                                                                                const char *str)
+{
+    bool isNew;
+    uint16_t id = dictionary.lookup(str, &isNew);
+    if(isNew)
+    {
+        size_t len = strlen(str);
+        if(len > 0xFFFF - sizeof(BinaryLogDefinition))
+        {
+            len = 0xFFFF - sizeof(BinaryLogDefinition);
+        }
+        BinaryLogRecordHeader header = { (uint8_t) type, 0, (uint16_t) (sizeof(BinaryLogDefinition) + len) };
+        BinaryLogDefinition definition = { id };
+        fwrite(&header, sizeof(header), 1, fp);
+        fwrite(&definition, sizeof(definition), 1, fp);
+        fwrite(str, 1, len, fp);
+    }
+    return id;
+}
+
+inline void BinaryFileLogger::writeEntry(FILE *fp, BinaryLogRecordType type, LogLevel logLevel,
+                                         int64_t timestampMS, int threadID, uint16_t tagID, uint16_t formatID,
+                                         const void *data, int dataSize)
+{
+    char record[sizeof(BinaryLogRecordHeader) + sizeof(BinaryLogEntry) + BINARY_LOG_MAX_ARGS_SIZE];
+    if(dataSize > BINARY_LOG_MAX_ARGS_SIZE)
+    {
+        dataSize = BINARY_LOG_MAX_ARGS_SIZE;
+    }
+    BinaryLogRecordHeader header = { (uint8_t) type, (uint8_t) logLevel,
+                                     (uint16_t) (sizeof(BinaryLogEntry) + dataSize) };
+    BinaryLogEntry entry = { timestampMS, (uint32_t) threadID, tagID, formatID };
+    memcpy(record, &header, sizeof(header));
+    memcpy(record + sizeof(header), &entry, sizeof(entry));
+    memcpy(record + sizeof(header) + sizeof(entry), data, dataSize);
+    // One fwrite() per record, records are never split by a file cut.
+    fwrite(record, 1, sizeof(header) + sizeof(entry) + dataSize, fp);
+}
+
+#endif//_LOG_BINARY_FILE_LOGGER_H
@@ -0,0 +1,532 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/BinaryLogRecord.h                                                                       *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Compact binary log records, printf() arguments are captured by raw values, and formatted    *
+ *                later by the writer thread, or offline by tools/BinaryLogDecoder.  No dependency to libBase *
+ *                binary, so offline tools can use it directly.                                               *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_BINARY_LOG_RECORD_H
+#define _LOG_BINARY_LOG_RECORD_H
+
+// Standard includes
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+// POSIX includes
+#include <sys/syscall.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <log/logLevel.h>
+
+/*
+Binary log file layout:
+1. File starts with BINARY_LOG_FILE_MAGIC.
+2. Then records, each is BinaryLogRecordHeader + payloadSize bytes (host endian, LP64):
+   - BINARY_LOG_RECORD_TAG/FORMAT: BinaryLogDefinition + string (w/o '\0').  Each file has its own IDs, and a
+     definition is always written before the first entry using it.
+   - BINARY_LOG_RECORD_ENTRY: BinaryLogEntry + arguments encoded by BinaryLogRecord::encodeArgs().
+   - BINARY_LOG_RECORD_TEXT: BinaryLogEntry + formatted text (w/o '\0'), for formats which cannot be
+     captured, for example, "%ls", "%m", or positional arguments.
+*/
+#define BINARY_LOG_FILE_MAGIC           "EVOBLOG1"
+#define BINARY_LOG_FILE_MAGIC_SIZE      8
+// Max encoded arguments per record, longer ones are logged as text records (cut if required).
+#define BINARY_LOG_MAX_ARGS_SIZE        1024
+#define BINARY_LOG_NO_ID                0xFFFF
+#define BINARY_LOG_NULL_STRING_LEN      0xFFFF
+
+enum BinaryLogRecordType
+{
+    BINARY_LOG_RECORD_ENTRY = 1,
+    BINARY_LOG_RECORD_TEXT = 2,
+    BINARY_LOG_RECORD_FORMAT = 3,
+    BINARY_LOG_RECORD_TAG = 4
+};
+
+struct BinaryLogRecordHeader
+{
+    uint8_t type;
+    uint8_t logLevel;
+    // Bytes after this header.
+    uint16_t payloadSize;
+};
+
+struct BinaryLogEntry
+{
+    int64_t timestampMS;
+    uint32_t threadID;
+    uint16_t tagID;
+    uint16_t formatID;
+};
+
+struct BinaryLogDefinition
+{
+    uint16_t id;
+};
+
+/*!
+ * @brief Implemented by SysLoggers which store encoded records directly, for example, BinaryFileLogger.  Then
+ *        AsyncLogger with deferred formatting hands records over w/o formatting them.
+ */
+class BinaryLogSink
+{
+  public:
+    virtual ~BinaryLogSink()
+    {
+    }
+
+    // args/argsSize are generated by BinaryLogRecord::encodeArgs(formatStr, ...).
+    virtual void logEncoded(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                            const char *formatStr, const void *args, int argsSize) = 0;
+};
+
+class BinaryLogRecord
+{
+  public:
+    // 1. Capture arguments of formatStr into buf by raw values, strings are copied.  Return the encoded size.
+    // 2. MIO_ERR_NOT_SUPPROTED is returned for conversions which cannot be captured, MIO_ERR_OUT_OF_RANGE is
+    //    returned if bufSize is not enough.  For both cases, clients should format the message directly.
+    // 3. variableArgList is consumed, va_copy() it first if it is required again.
+    static int encodeArgs(void *buf, int bufSize, const char *formatStr, va_list variableArgList);
+    // 1. Format arguments encoded by encodeArgs() into buf, buf is always null-terminated (cut if required).
+    // 2. Return the length written, or MIO_ERR_INVALID_DATA if args doesn't match formatStr.
+    static int formatArgs(char *buf, int bufSize, const char *formatStr, const void *args, int argsSize);
+    // Kernel thread ID (same as Thread::getCurrentThreadID()), cached per thread.
+    static int currentThreadID(void);
+};
+
+/* Implementation details, format spec parsing shared by encode/format */
+
+enum _BinaryLogArgType
+{
+    _BINARY_LOG_ARG_NONE,
+    _BINARY_LOG_ARG_INT,
+    _BINARY_LOG_ARG_INT64,
+    _BINARY_LOG_ARG_DOUBLE,
+    _BINARY_LOG_ARG_STRING,
+    _BINARY_LOG_ARG_POINTER,
+    // "%n", argument is consumed, nothing is stored.
+    _BINARY_LOG_ARG_SKIP,
+    _BINARY_LOG_ARG_UNSUPPORTED
+};
+
+struct _BinaryLogSpec
+{
+    char flags[8];
+    int lenFlags;
+    bool hasWidth;
+    bool widthByArg;
+    int width;
+    bool hasPrecision;
+    bool precisionByArg;
+    int precision;
+    // "", "hh", "h", "l", "ll", "L", "j", "z", "t".
+    char length[3];
+    char conversion;
+    _BinaryLogArgType argType;
+};
+
+// ptr points to the character right after '%', return the pointer after the conversion character.
+inline const char *_parseBinaryLogSpec(const char *ptr, _BinaryLogSpec &spec)
+{
+    memset(&spec, 0, sizeof(spec));
+    while(*ptr && strchr("-+ #0'I", *ptr) && (spec.lenFlags < (int) sizeof(spec.flags) - 1))
+    {
+        spec.flags[spec.lenFlags++] = *ptr++;
+    }
+    if(*ptr == '*')
+    {
+        spec.hasWidth = spec.widthByArg = true;
+        ++ptr;
+    }
+    else
+    {
+        for(; (*ptr >= '0') && (*ptr <= '9'); ++ptr)
+        {
+            spec.hasWidth = true;
+            spec.width = spec.width * 10 + (*ptr - '0');
+        }
+        if(*ptr == '$')
+        {
+            // Positional arguments.
+            spec.argType = _BINARY_LOG_ARG_UNSUPPORTED;
+            return ptr + 1;
+        }
+    }
+    if(*ptr == '.')
+    {
+        spec.hasPrecision = true;
+        if(*++ptr == '*')
+        {
+            spec.precisionByArg = true;
+            ++ptr;
+        }
+        else
+        {
+            for(; (*ptr >= '0') && (*ptr <= '9'); ++ptr)
+            {
+                spec.precision = spec.precision * 10 + (*ptr - '0');
+            }
+        }
+    }
+    // 'q' is treated as "ll", 'Z' as 'z'.
+    if(*ptr == 'q')
+    {
+        strcpy(spec.length, "ll");
+        ++ptr;
+    }
+    else
+    {
+        for(int lenLength = 0; *ptr && strchr("hlLjzZt", *ptr) && (lenLength < 2); ++ptr)
+        {
+            spec.length[lenLength++] = (*ptr == 'Z') ? 'z' : *ptr;
+        }
+    }
+    spec.conversion = *ptr;
+    if(*ptr)
+    {
+        ++ptr;
+    }
+    bool is64;
+    switch(spec.length[0])
+    {
+        case 'l':
+            is64 = (spec.length[1] == 'l') || (sizeof(long) == 8);
+            break;
+        case 'j':
+            is64 = true;
+            break;
+        case 'z':
+            is64 = (sizeof(size_t) == 8);
+            break;
+        case 't':
+            is64 = (sizeof(ptrdiff_t) == 8);
+            break;
+        default:
+            is64 = false;
+            break;
+    }
+    switch(spec.conversion)
+    {
+        case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+            spec.argType = is64 ? _BINARY_LOG_ARG_INT64 : _BINARY_LOG_ARG_INT;
+            break;
+        case 'c':
+            spec.argType = spec.length[0] ? _BINARY_LOG_ARG_UNSUPPORTED : _BINARY_LOG_ARG_INT;
+            break;
+        case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+            spec.argType = _BINARY_LOG_ARG_DOUBLE;
+            break;
+        case 's':
+            spec.argType = spec.length[0] ? _BINARY_LOG_ARG_UNSUPPORTED : _BINARY_LOG_ARG_STRING;
+            break;
+        case 'p':
+            spec.argType = _BINARY_LOG_ARG_POINTER;
+            break;
+        case 'n':
+            spec.argType = _BINARY_LOG_ARG_SKIP;
+            break;
+        case '%':
+            spec.argType = _BINARY_LOG_ARG_NONE;
+            break;
+        default:
+            spec.argType = _BINARY_LOG_ARG_UNSUPPORTED;
+            break;
+    }
+    return ptr;
+}
+
+inline int BinaryLogRecord::encodeArgs(void *buf, int bufSize, const char *formatStr, va_list variableArgList)
+{
+    char *out = (char *) buf;
+    char *outEnd = out + bufSize;
+    const char *ptr = formatStr;
+    _BinaryLogSpec spec;
+    while((ptr = strchr(ptr, '%')) != 0)
+    {
+        ptr = _parseBinaryLogSpec(ptr + 1, spec);
+        if(spec.argType == _BINARY_LOG_ARG_UNSUPPORTED)
+        {
+            return MIO_ERR_NOT_SUPPROTED;
+        }
+        // Worst case of fixed size values, 2 stars and one 8-byte value.
+        if(outEnd - out < 16)
+        {
+            return MIO_ERR_OUT_OF_RANGE;
+        }
+        if(spec.widthByArg)
+        {
+            int value = va_arg(variableArgList, int);
+            memcpy(out, &value, sizeof(value));
+            out += sizeof(value);
+        }
+        if(spec.precisionByArg)
+        {
+            int value = va_arg(variableArgList, int);
+            memcpy(out, &value, sizeof(value));
+            out += sizeof(value);
+            spec.precision = value;
+            spec.hasPrecision = (value >= 0);
+        }
+        switch(spec.argType)
+        {
+            case _BINARY_LOG_ARG_INT:
+            {
+                int value = va_arg(variableArgList, int);
+                memcpy(out, &value, sizeof(value));
+                out += sizeof(value);
+                break;
+            }
+            case _BINARY_LOG_ARG_INT64:
+            {
+                long long value = va_arg(variableArgList, long long);
+                memcpy(out, &value, sizeof(value));
+                out += sizeof(value);
+                break;
+            }
+            case _BINARY_LOG_ARG_DOUBLE:
+            {
+                double value = (spec.length[0] == 'L') ? (double) va_arg(variableArgList, long double) :
+                                                         va_arg(variableArgList, double);
+                memcpy(out, &value, sizeof(value));
+                out += sizeof(value);
+                break;
+            }
+            case _BINARY_LOG_ARG_POINTER:
+            {
+                uint64_t value = (uint64_t) (uintptr_t) va_arg(variableArgList, void *);
+                memcpy(out, &value, sizeof(value));
+                out += sizeof(value);
+                break;
+            }
+            case _BINARY_LOG_ARG_STRING:
+            {
+                const char *str = va_arg(variableArgList, const char *);
+                uint16_t len = BINARY_LOG_NULL_STRING_LEN;
+                size_t strLen = 0;
+                if(str)
+                {
+                    // Respect precision, the string may not be null-terminated.
+                    strLen = spec.hasPrecision ? strnlen(str, spec.precision) : strlen(str);
+                    if((strLen >= BINARY_LOG_NULL_STRING_LEN) || ((size_t) (outEnd - out) < strLen + 2))
+                    {
+                        return MIO_ERR_OUT_OF_RANGE;
+                    }
+                    len = (uint16_t) strLen;
+                }
+                memcpy(out, &len, sizeof(len));
+                out += sizeof(len);
+                // str may be null, and memcpy() needs valid pointers even if strLen is 0.
+                if(strLen > 0)
+                {
+                    memcpy(out, str, strLen);
+                    out += strLen;
+                }
+                break;
+            }
+            case _BINARY_LOG_ARG_SKIP:
+                (void) va_arg(variableArgList, void *);
+                break;
+            default:
+                break;
+        }
+    }
+    return (int) (out - (char *) buf);
+}
+
+inline int BinaryLogRecord::formatArgs(char *buf, int bufSize, const char *formatStr, const void *args,
+                                                                                                  int argsSize)
+{
+    const char *in = (const char *) args;
+    const char *inEnd = in + argsSize;
+    const char *ptr = formatStr;
+    int len = 0;
+    _BinaryLogSpec spec;
+    buf[0] = '\0';
+    while(*ptr && (len < bufSize - 1))
+    {
+        const char *next = strchr(ptr, '%');
+        int lenLiteral = next ? (int) (next - ptr) : (int) strlen(ptr);
+        if(lenLiteral > bufSize - 1 - len)
+        {
+            lenLiteral = bufSize - 1 - len;
+        }
+        memcpy(buf + len, ptr, lenLiteral);
+        len += lenLiteral;
+        buf[len] = '\0';
+        if(!next)
+        {
+            break;
+        }
+        ptr = _parseBinaryLogSpec(next + 1, spec);
+        if(spec.argType == _BINARY_LOG_ARG_UNSUPPORTED)
+        {
+            return MIO_ERR_INVALID_DATA;
+        }
+        if(spec.argType == _BINARY_LOG_ARG_NONE)
+        {
+            if(len < bufSize - 1)
+            {
+                buf[len++] = '%';
+                buf[len] = '\0';
+            }
+            continue;
+        }
+        if(spec.widthByArg)
+        {
+            if(inEnd - in < (int) sizeof(int))
+            {
+                return MIO_ERR_INVALID_DATA;
+            }
+            memcpy(&spec.width, in, sizeof(int));
+            in += sizeof(int);
+            if(spec.width < 0)
+            {
+                spec.flags[spec.lenFlags++] = '-';
+                spec.width = -spec.width;
+            }
+        }
+        if(spec.precisionByArg)
+        {
+            if(inEnd - in < (int) sizeof(int))
+            {
+                return MIO_ERR_INVALID_DATA;
+            }
+            memcpy(&spec.precision, in, sizeof(int));
+            in += sizeof(int);
+            spec.hasPrecision = (spec.precision >= 0);
+        }
+        // Rebuild the conversion w/o '*', the argument is passed with the type it is stored.
+        char specStr[48];
+        int lenSpec = snprintf(specStr, sizeof(specStr), "%%%.*s", spec.lenFlags, spec.flags);
+        if(spec.hasWidth)
+        {
+            lenSpec += snprintf(specStr + lenSpec, sizeof(specStr) - lenSpec, "%d", spec.width);
+        }
+        const char *str = 0;
+        uint16_t lenStr = 0;
+        if(spec.argType == _BINARY_LOG_ARG_STRING)
+        {
+            if(inEnd - in < (int) sizeof(lenStr))
+            {
+                return MIO_ERR_INVALID_DATA;
+            }
+            memcpy(&lenStr, in, sizeof(lenStr));
+            in += sizeof(lenStr);
+            if(lenStr == BINARY_LOG_NULL_STRING_LEN)
+            {
+                str = "(null)";
+                lenStr = 6;
+            }
+            else
+            {
+                if(inEnd - in < lenStr)
+                {
+                    return MIO_ERR_INVALID_DATA;
+                }
+                str = in;
+                in += lenStr;
+            }
+            // Stored strings are not null-terminated, precision limits the output to the stored length.
+            spec.hasPrecision = true;
+            spec.precision = lenStr;
+        }
+        if(spec.hasPrecision)
+        {
+            lenSpec += snprintf(specStr + lenSpec, sizeof(specStr) - lenSpec, ".%d", spec.precision);
+        }
+        int remaining = bufSize - len;
+        int result = 0;
+        switch(spec.argType)
+        {
+            case _BINARY_LOG_ARG_INT:
+            {
+                int value;
+                if(inEnd - in < (int) sizeof(value))
+                {
+                    return MIO_ERR_INVALID_DATA;
+                }
+                memcpy(&value, in, sizeof(value));
+                in += sizeof(value);
+                // Only "h"/"hh" are meaningful for int values.
+                snprintf(specStr + lenSpec, sizeof(specStr) - lenSpec, "%s%c",
+                                                     (spec.length[0] == 'h') ? spec.length : "", spec.conversion);
+                result = snprintf(buf + len, remaining, specStr, value);
+                break;
+            }
+            case _BINARY_LOG_ARG_INT64:
+            {
+                long long value;
+                if(inEnd - in < (int) sizeof(value))
+                {
+                    return MIO_ERR_INVALID_DATA;
+                }
+                memcpy(&value, in, sizeof(value));
+                in += sizeof(value);
+                snprintf(specStr + lenSpec, sizeof(specStr) - lenSpec, "ll%c", spec.conversion);
+                result = snprintf(buf + len, remaining, specStr, value);
+                break;
+            }
+            case _BINARY_LOG_ARG_DOUBLE:
+            {
+                double value;
+                if(inEnd - in < (int) sizeof(value))
+                {
+                    return MIO_ERR_INVALID_DATA;
+                }
+                memcpy(&value, in, sizeof(value));
+                in += sizeof(value);
+                snprintf(specStr + lenSpec, sizeof(specStr) - lenSpec, "%c", spec.conversion);
+                result = snprintf(buf + len, remaining, specStr, value);
+                break;
+            }
+            case _BINARY_LOG_ARG_POINTER:
+            {
+                uint64_t value;
+                if(inEnd - in < (int) sizeof(value))
+                {
+                    return MIO_ERR_INVALID_DATA;
+                }
+                memcpy(&value, in, sizeof(value));
+                in += sizeof(value);
+                snprintf(specStr + lenSpec, sizeof(specStr) - lenSpec, "p");
+                result = snprintf(buf + len, remaining, specStr, (void *) (uintptr_t) value);
+                break;
+            }
+            case _BINARY_LOG_ARG_STRING:
+                snprintf(specStr + lenSpec, sizeof(specStr) - lenSpec, "s");
+                result = snprintf(buf + len, remaining, specStr, str);
+                break;
+            default:
+                break;
+        }
+        if(result > 0)
+        {
+            len += (result < remaining) ? result : (remaining - 1);
+        }
+    }
+    return len;
+}
+
+inline int BinaryLogRecord::currentThreadID(void)
+{
+    static __thread int threadID = 0;
+    if(!threadID)
+    {
+        threadID = (int) syscall(SYS_gettid);
+    }
+    return threadID;
+}
+
+#endif//_LOG_BINARY_LOG_RECORD_H
@@ -0,0 +1,317 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/CompressingFileLogger.h                                                                 *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  AutoSerialFileLogger which compresses cut log files to ".log.lz" in background, and applies *
+ *                maxTotalSizeInMB to compressed bytes.                                                       *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_COMPRESSING_FILE_LOGGER_H
+#define _LOG_COMPRESSING_FILE_LOGGER_H
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+// POSIX includes
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <basicType/RefCountObj.h>
+#include <container/List.h>
+#include <osal/OsalFileSystem.h>
+#include <osal/OsalMutex.h>
+#include <util/LzCodec.h>
+#include <util/SmartMutexLock.h>
+#include <task/Thread.h>
+#include <log/AutoSerialFileLogger.h>
+
+#define COMPRESSED_LOG_EXT          ".lz"
+#define COMPRESSING_LOG_TMP_EXT     ".tmp"
+
+// Shared by the logger and its background job, the job may outlive the logger.
+class _LogCompressState : public RefCountObj
+{
+  public:
+    _LogCompressState(const char *_fullLogDirPath, const char *_baseName, size_t _maxTotalSize) :
+        fullLogDirPath(_fullLogDirPath), baseName(_baseName), maxTotalSize(_maxTotalSize)
+    {
+    }
+
+    OsalMutex mutex;
+    const std::string fullLogDirPath;
+    const std::string baseName;
+    const size_t maxTotalSize;
+    // Below are protected by mutex.
+    std::string activeFilename;
+    List<std::string> pendingFilenames;
+    bool isJobScheduled = false;
+
+  protected:
+    virtual ~_LogCompressState()
+    {
+    }
+};
+
+/*!
+ * @brief AutoSerialFileLogger which keeps more history in the same maxTotalSizeInMB budget.
+ *
+ * @remarks
+ *   1. Once a file is cut (or stopped), it is compressed by LzCodec into "<name>.log.lz" by a background thread,
+ *      then the ".log" file is removed.  Only one file is compressed at a time, with the lowest CPU (nice 19) and
+ *      I/O (idle class) priority.  The thread ends after the work, w/o restoring them, since w/o CAP_SYS_NICE a
+ *      nice can't be lowered again, which must not happen to a pooled thread of GlobalThreadPool.
+ *   2. Compression is by LZ_BLOCK_SIZE blocks, memory usage is about 150KB during the work.
+ *   3. Budget: after each compression, the oldest files (".log" or ".log.lz") of baseName are removed until the
+ *      total size, the active file included, is not larger than maxTotalSizeInMB.  AutoSerialFileLogger's own
+ *      cleanup is replaced.
+ *   4. ".log" files left by previous runs (except the active one) are compressed by the first work item.
+ *   5. Decompress by LzCodec::decompressFile(), or tools/LzDecompress.
+ */
+class CompressingFileLogger : public AutoSerialFileLogger
+{
+  public:
+    CompressingFileLogger(const char *fullLogDirPath, const char *baseName, int maxTotalSizeInMB = 10);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~CompressingFileLogger();
+
+  protected:
+    /* Implementation for FileBasedLogger */
+    virtual void cleanupOldFiles(int lastClosedFileSize);
+    // Called right before a new log file is opened (with file mutex locked).
+    virtual std::string generateNextFilename(void);
+
+  private:
+    _LogCompressState *state;
+    // The file most recently opened, it is the just closed one when cleanupOldFiles() is called.
+    std::string lastFilename;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    CompressingFileLogger(const CompressingFileLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    CompressingFileLogger &operator=(const CompressingFileLogger &);
+
+    void scheduleJob(void);
+    static int _compressJob(void *context);
+    static void compressFile(_LogCompressState *state, const std::string &filename);
+    static void applyBudget(_LogCompressState *state);
+    static bool isOwnLogFile(_LogCompressState *state, const std::string &filename, bool *isCompressed);
+};
+
+inline CompressingFileLogger::CompressingFileLogger(const char *fullLogDirPath, const char *baseName,
+                                                    int maxTotalSizeInMB) :
+    AutoSerialFileLogger(fullLogDirPath, baseName, maxTotalSizeInMB),
+    state(new _LogCompressState(fullLogDirPath, baseName, (size_t) maxTotalSizeInMB * 1024 * 1024))
+{
+    // Leftovers of previous runs.
+    scheduleJob();
+}
+
+inline CompressingFileLogger::~CompressingFileLogger()
+{
+    state->deref();
+}
+
+inline void CompressingFileLogger::cleanupOldFiles(int)
+{
+    if(!lastFilename.empty())
+    {
+        SmartMutexLock lock(state->mutex);
+        state->pendingFilenames.addWithoutCheck(lastFilename);
+    }
+    scheduleJob();
+}
+
+inline std::string CompressingFileLogger::generateNextFilename(void)
+{
+    lastFilename = AutoSerialFileLogger::generateNextFilename();
+    SmartMutexLock lock(state->mutex);
+    state->activeFilename = lastFilename;
+    return lastFilename;
+}
+
+inline void CompressingFileLogger::scheduleJob(void)
+{
+    {
+        SmartMutexLock lock(state->mutex);
+        if(state->isJobScheduled)
+        {
+            return;
+        }
+        state->isJobScheduled = true;
+    }
+    state->ref();
+    // Cuts are rare, a thread of its own costs little, and its priorities never need to be restored.
+    if(Thread::startThread(_compressJob, state) != MIO_GENERAL_OK)
+    {
+        SmartMutexLock lock(state->mutex);
+        state->isJobScheduled = false;
+        state->deref();
+    }
+}
+
+inline int CompressingFileLogger::_compressJob(void *context)
+{
+    _LogCompressState *state = (_LogCompressState *) context;
+    // Lowest priorities for this thread, it ends after the work.
+    int tid = (int) syscall(SYS_gettid);
+    setpriority(PRIO_PROCESS, tid, 19);
+    // IOPRIO_WHO_PROCESS = 1, IOPRIO_CLASS_IDLE = 3, IOPRIO_CLASS_SHIFT = 13.
+    syscall(SYS_ioprio_set, 1, tid, 3 << 13);
+
+    // Files left by previous runs, found by a directory scan.
+    List<std::string> filenames;
+    OsalFileSystem::scanFiles(state->fullLogDirPath.c_str(), filenames);
+    std::string activeFilename;
+    {
+        SmartMutexLock lock(state->mutex);
+        activeFilename = state->activeFilename;
+    }
+    for(int i = 0; i < filenames.size(); ++i)
+    {
+        bool isCompressed;
+        const std::string &filename = filenames.get(i);
+        if(isOwnLogFile(state, filename, &isCompressed) && !isCompressed && (filename != activeFilename))
+        {
+            compressFile(state, filename);
+        }
+    }
+
+    while(true)
+    {
+        std::string filename;
+        {
+            SmartMutexLock lock(state->mutex);
+            if(state->pendingFilenames.size() == 0)
+            {
+                state->isJobScheduled = false;
+                break;
+            }
+            filename = state->pendingFilenames.get(0);
+            state->pendingFilenames.removeByIndex(0);
+        }
+        compressFile(state, filename);
+    }
+    applyBudget(state);
+    state->deref();
+    return MIO_GENERAL_OK;
+}
+
+inline void CompressingFileLogger::compressFile(_LogCompressState *state, const std::string &filename)
+{
+    std::string srcPath = OsalFileSystem::generateFullFilePath(state->fullLogDirPath.c_str(), filename.c_str());
+    std::string dstPath = srcPath + COMPRESSED_LOG_EXT;
+    std::string tmpPath = dstPath + COMPRESSING_LOG_TMP_EXT;
+    // Into a temporary file first, so a ".log.lz" file is always complete.
+    if(LzCodec::compressFile(srcPath.c_str(), tmpPath.c_str()) == MIO_GENERAL_OK)
+    {
+        if(rename(tmpPath.c_str(), dstPath.c_str()) == 0)
+        {
+            unlink(srcPath.c_str());
+            return;
+        }
+    }
+    unlink(tmpPath.c_str());
+}
+
+inline bool CompressingFileLogger::isOwnLogFile(_LogCompressState *state, const std::string &filename,
+                                                                                              bool *isCompressed)
+{
+    // baseName + "-XXXXX-...log[.lz]".
+    const std::string &baseName = state->baseName;
+    if((filename.size() <= baseName.size() + 6) || (filename.compare(0, baseName.size(), baseName) != 0) ||
+       (filename[baseName.size()] != '-'))
+    {
+        return false;
+    }
+    for(size_t i = baseName.size() + 1; i < baseName.size() + 6; ++i)
+    {
+        if((filename[i] < '0') || (filename[i] > '9'))
+        {
+            return false;
+        }
+    }
+    static const char logExt[] = ".log";
+    static const char compressedExt[] = ".log" COMPRESSED_LOG_EXT;
+    size_t len = filename.size();
+    *isCompressed = (len >= sizeof(compressedExt) - 1) &&
+                    (filename.compare(len - (sizeof(compressedExt) - 1), std::string::npos, compressedExt) == 0);
+    return *isCompressed || ((len >= sizeof(logExt) - 1) &&
+                             (filename.compare(len - (sizeof(logExt) - 1), std::string::npos, logExt) == 0));
+}
+
+inline void CompressingFileLogger::applyBudget(_LogCompressState *state)
+{
+    struct LogFileInfo
+    {
+        std::string path;
+        time_t modifiedTime;
+        size_t size;
+        bool isActive;
+
+        bool operator<(const LogFileInfo &other) const
+        {
+            // Oldest first, names (with serial numbers) break ties.
+            if(modifiedTime != other.modifiedTime)
+            {
+                return modifiedTime < other.modifiedTime;
+            }
+            return path < other.path;
+        }
+    };
+
+    List<std::string> filenames;
+    OsalFileSystem::scanFiles(state->fullLogDirPath.c_str(), filenames);
+    std::string activeFilename;
+    {
+        SmartMutexLock lock(state->mutex);
+        activeFilename = state->activeFilename;
+    }
+    std::vector<LogFileInfo> files;
+    size_t totalSize = 0;
+    for(int i = 0; i < filenames.size(); ++i)
+    {
+        bool isCompressed;
+        struct stat fileStat;
+        LogFileInfo info;
+        if(!isOwnLogFile(state, filenames.get(i), &isCompressed))
+        {
+            continue;
+        }
+        info.path = OsalFileSystem::generateFullFilePath(state->fullLogDirPath.c_str(), filenames.get(i).c_str());
+        if(stat(info.path.c_str(), &fileStat) != 0)
+        {
+            continue;
+        }
+        info.modifiedTime = fileStat.st_mtime;
+        info.size = fileStat.st_size;
+        info.isActive = (filenames.get(i) == activeFilename);
+        totalSize += info.size;
+        files.push_back(info);
+    }
+    std::sort(files.begin(), files.end());
+    for(size_t i = 0; (i < files.size()) && (totalSize > state->maxTotalSize); ++i)
+    {
+        if(!files[i].isActive && (unlink(files[i].path.c_str()) == 0))
+        {
+            totalSize -= files[i].size;
+        }
+    }
+}
+
+#endif//_LOG_COMPRESSING_FILE_LOGGER_H
@@ -0,0 +1,168 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/DelegateLogger.h                                                                        *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Base class for SysLogger decorators, all SysLogger calls are forwarded to a target logger.  *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_DELEGATE_LOGGER_H
+#define _LOG_DELEGATE_LOGGER_H
+
+// Standard includes
+#include <stddef.h>
+#include <stdarg.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <log/SysLogger.h>
+
+/*!
+ * @brief SysLogger which forwards everything to another SysLogger (the target).  Child classes override the
+ *        methods they decorate, and use delegateXXX() to reach the target.
+ */
+class DelegateLogger : public SysLogger
+{
+  public:
+    /*!
+     * Constructor.
+     *
+     * @param target The SysLogger to forward to.  It is not owned, clients should keep it alive until this
+     *        logger is deleted, and delete it afterward.
+     */
+    DelegateLogger(SysLogger *target);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~DelegateLogger();
+
+    SysLogger *getTarget(void);
+
+  protected:
+    /* Implementation for SysLogger, forward to target by default */
+    virtual int start(void);
+    virtual void stop(void);
+    virtual void log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList);
+    virtual void flush(void);
+    virtual void cut(void);
+    virtual size_t currentSize(void);
+
+    /* Used by child classes to reach the target */
+    int delegateStart(void);
+    void delegateStop(void);
+    void delegateLog(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList);
+    // For already formatted messages, for example, delegateLogFormatted(tag, logLevel, "%s", logStr).
+    void delegateLogFormatted(const char *tag, LogLevel logLevel, const char *formatStr, ...);
+    void delegateFlush(void);
+    void delegateCut(void);
+    size_t delegateCurrentSize(void);
+
+  private:
+    SysLogger *const target;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    DelegateLogger(const DelegateLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    DelegateLogger &operator=(const DelegateLogger &);
+};
+
+inline DelegateLogger::DelegateLogger(SysLogger *_target) : target(_target)
+{
+}
+
+inline DelegateLogger::~DelegateLogger()
+{
+}
+
+inline SysLogger *DelegateLogger::getTarget(void)
+{
+    return target;
+}
+
+inline int DelegateLogger::start(void)
+{
+    return delegateStart();
+}
+
+inline void DelegateLogger::stop(void)
+{
+    delegateStop();
+}
+
+inline void DelegateLogger::log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList)
+{
+    delegateLog(tag, logLevel, formatStr, variableArgList);
+}
+
+inline void DelegateLogger::flush(void)
+{
+    delegateFlush();
+}
+
+inline void DelegateLogger::cut(void)
+{
+    delegateCut();
+}
+
+inline size_t DelegateLogger::currentSize(void)
+{
+    return delegateCurrentSize();
+}
+
+inline int DelegateLogger::delegateStart(void)
+{
+    return target ? target->start() : MIO_GENERAL_OK;
+}
+
+inline void DelegateLogger::delegateStop(void)
+{
+    if(target)
+    {
+        target->stop();
+    }
+}
+
+inline void DelegateLogger::delegateLog(const char *tag, LogLevel logLevel, const char *formatStr,
+                                                                                       va_list variableArgList)
+{
+    if(target)
+    {
+        target->log(tag, logLevel, formatStr, variableArgList);
+    }
+}
+
+inline void DelegateLogger::delegateLogFormatted(const char *tag, LogLevel logLevel, const char *formatStr, ...)
+{
+    va_list variableArgList;
+    va_start(variableArgList, formatStr);
+    delegateLog(tag, logLevel, formatStr, variableArgList);
+    va_end(variableArgList);
+}
+
+inline void DelegateLogger::delegateFlush(void)
+{
+    if(target)
+    {
+        target->flush();
+    }
+}
+
+inline void DelegateLogger::delegateCut(void)
+{
+    if(target)
+    {
+        target->cut();
+    }
+}
+
+inline size_t DelegateLogger::delegateCurrentSize(void)
+{
+    return target ? target->currentSize() : 0;
+}
+
+#endif//_LOG_DELEGATE_LOGGER_H
@@ -51,6 +51,11 @@ class FileBasedLogger : public SysLogger
 
     /* access by child classes */
     const char *fullLogDirPath(void);
+    // 1. Current opened log file, or 0 if no file is opened.
+    // 2. fileMutex() should be locked while using it, FileBasedLogger's own calls lock it too, so, they
+    //    cannot be called with fileMutex() locked.
+    FILE *currentFile(void);
+    OsalMutex &fileMutex(void);
 
   private:
     OsalMutex mutex;
@@ -58,4 +63,14 @@ class FileBasedLogger : public SysLogger
     FILE *fp;
 };
 
+inline FILE *FileBasedLogger::currentFile(void)
+{
+    return fp;
+}
+
+inline OsalMutex &FileBasedLogger::fileMutex(void)
+{
+    return mutex;
+}
+
 #endif//_LOG_FILE_BASED_LOGGER_H
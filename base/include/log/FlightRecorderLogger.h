@@ -0,0 +1,460 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/FlightRecorderLogger.h                                                                  *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Crash-surviving logger backed by a fixed-size mmap'ed ring file, and the reader which       *
+ *                replays the ring to another SysLogger (AutoSerialFileLogger) on next boot.                  *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_FLIGHT_RECORDER_LOGGER_H
+#define _LOG_FLIGHT_RECORDER_LOGGER_H
+
+// Standard includes
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+// POSIX includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <util/TimeUtil.h>
+#include <task/Thread.h>
+#include <task/WheelPeriodicTask.h>
+#include <log/DelegateLogger.h>
+#include <log/logLineFormat.h>
+
+#define FLIGHT_RECORDER_MAGIC           "EVOFLTR1"
+#define FLIGHT_RECORDER_VERSION         1
+// Slots start at this offset of the ring file.
+#define FLIGHT_RECORDER_HEADER_SIZE     4096
+// Default bytes per record (header included), longer messages are cut.
+#define FLIGHT_RECORDER_SLOT_SIZE       256
+#define FLIGHT_RECORDER_MAX_TAG_LEN     63
+
+enum FlightRecorderState
+{
+    FLIGHT_RECORDER_RUNNING = 1,
+    // stop() is called, nothing to recover.
+    FLIGHT_RECORDER_STOPPED = 2
+};
+
+// Ring file header, at offset 0.
+struct FlightRecorderHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t slotSize;
+    uint32_t slotCount;
+    uint32_t state;
+    // Sequence number of the last claimed slot, the first record is 1.
+    uint64_t lastSeq;
+    int64_t startTimestampMS;
+    uint32_t pid;
+    uint32_t reserved;
+};
+
+// Followed by tag (w/o '\0') and text (w/o '\0'), padded to 8 bytes.
+struct FlightRecorderSlot
+{
+    // 0 if the slot is empty or being written.
+    uint64_t seq;
+    int64_t timestampMS;
+    uint32_t threadID;
+    uint8_t logLevel;
+    uint8_t tagLen;
+    uint16_t textLen;
+    uint64_t checksum;
+};
+
+// A slot holds its header and 8 bytes of data at least.
+#define FLIGHT_RECORDER_MIN_SLOT_SIZE   (sizeof(FlightRecorderSlot) + 8)
+
+/*!
+ * @brief Logger which keeps the latest records in a ring file by mmap(MAP_SHARED), for the last seconds before a
+ *        crash, or a watchdog reset.
+ *
+ * @remarks
+ *   1. log() is lock-free, the record is formatted into its slot directly, no system call is made.
+ *   2. The kernel owns the pages, so records survive if the process is killed, or crashes (SIGSEGV, abort, ...).
+ *      For power loss and watchdog resets, only the pages written back survive, that is the reason of
+ *      syncIntervalMS (msync() periodically), and flush() (msync() at once).
+ *   3. If target is given, every call is forwarded to it too, so, it works with the normal file logger, for
+ *      example, "new FlightRecorderLogger(path, 256, autoSerialFileLogger)".
+ *   4. start() resets the ring, recover the ring of the previous run by FlightRecorderReader before that.
+ *      stop() marks the ring as stopped normally, FlightRecorderReader skips it.
+ *   5. The ring file should be on a persistent file system (not tmpfs).
+ */
+class FlightRecorderLogger : public DelegateLogger
+{
+  public:
+    /*!
+     * Constructor.
+     *
+     * @param ringFilePath The full path of the ring file, it is created if not existing.
+     * @param ringSizeInKB The size of all slots.
+     * @param target The SysLogger which messages are forwarded to, or 0.  It is not owned.
+     * @param syncIntervalMS Period to msync() the ring, 0 to leave it to the kernel writeback.
+     * @param slotSize Bytes per record, rounded up to multiple of 8.  If it is less than
+     *                 FLIGHT_RECORDER_MIN_SLOT_SIZE, or the ring cannot hold one slot, start() fails with
+     *                 MIO_ERR_ILLEGAL_PARAMETERS.
+     */
+    FlightRecorderLogger(const char *ringFilePath, int ringSizeInKB = 256, SysLogger *target = 0,
+                         int syncIntervalMS = 1000, int slotSize = FLIGHT_RECORDER_SLOT_SIZE);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~FlightRecorderLogger();
+
+  protected:
+    /* Implementation for SysLogger */
+    virtual int start(void);
+    virtual void stop(void);
+    virtual void log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList);
+    virtual void flush(void);
+
+  private:
+    char *ringFilePath;
+    const int slotSize;
+    const int slotCount;
+    const int syncIntervalMS;
+    FlightRecorderHeader *header = 0;
+    char *slots = 0;
+    size_t mappedSize = 0;
+    WheelPeriodicTask *syncTask = 0;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    FlightRecorderLogger(const FlightRecorderLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    FlightRecorderLogger &operator=(const FlightRecorderLogger &);
+
+    void unmap(void);
+    static int _sync(void *context);
+    // Rounded up to multiple of 8, or 0 if it is less than FLIGHT_RECORDER_MIN_SLOT_SIZE.
+    static int alignSlotSize(int slotSize);
+
+    friend class FlightRecorderReader;
+    static uint64_t checksum(uint64_t seq, const FlightRecorderSlot *slot);
+};
+
+/*!
+ * @brief Reconstruct the ring file of the previous run in order, and replay records to the target, normally the
+ *        AutoSerialFileLogger, which should be started already.
+ *
+ * @remarks
+ *   1. Each record is logged with tag FLIGHT_RECORDER_REPLAY_TAG and its original level, the text is the
+ *      original line, for example, "10/17 10:00:01.234 [INFO][1A2] muxer: ...".
+ *   2. Torn slots (the process died while writing them) are skipped.
+ */
+#define FLIGHT_RECORDER_REPLAY_TAG      "FlightRecorder"
+
+class FlightRecorderReader : public DelegateLogger
+{
+  public:
+    FlightRecorderReader(SysLogger *target);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~FlightRecorderReader();
+
+    // 1. Return the number of records replayed, MIO_ERR_NO_DATA if the ring file doesn't exist, or it is not a
+    //    valid ring, or MIO_ERR_IO_GENERAL.
+    // 2. If includeStopped is false, rings which were stopped normally are ignored (return 0).
+    int replay(const char *ringFilePath, bool includeStopped = false);
+
+  private:
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    FlightRecorderReader(const FlightRecorderReader &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    FlightRecorderReader &operator=(const FlightRecorderReader &);
+};
+
+inline FlightRecorderLogger::FlightRecorderLogger(const char *_ringFilePath, int ringSizeInKB, SysLogger *target,
+                                                  int _syncIntervalMS, int _slotSize) :
+    DelegateLogger(target), ringFilePath(strdup(_ringFilePath)), slotSize(alignSlotSize(_slotSize)),
+    slotCount(slotSize ? (ringSizeInKB * 1024 / slotSize) : 0), syncIntervalMS(_syncIntervalMS)
+{
+}
+
+inline FlightRecorderLogger::~FlightRecorderLogger()
+{
+    unmap();
+    free(ringFilePath);
+}
+
+inline int FlightRecorderLogger::start(void)
+{
+    int result = delegateStart();
+    if(header)
+    {
+        return result;
+    }
+    if(slotCount <= 0)
+    {
+        return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    int fd = open(ringFilePath, O_RDWR | O_CREAT, 0644);
+    if(fd < 0)
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    size_t size = FLIGHT_RECORDER_HEADER_SIZE + (size_t) slotSize * slotCount;
+    void *mapped = MAP_FAILED;
+    if(ftruncate(fd, size) == 0)
+    {
+        mapped = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    // The mapping keeps the file.
+    close(fd);
+    if(mapped == MAP_FAILED)
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+
+    // A new run, previous records are cleared, and the header is written last.
+    memset(mapped, 0, size);
+    mappedSize = size;
+    slots = (char *) mapped + FLIGHT_RECORDER_HEADER_SIZE;
+    FlightRecorderHeader *newHeader = (FlightRecorderHeader *) mapped;
+    newHeader->version = FLIGHT_RECORDER_VERSION;
+    newHeader->slotSize = slotSize;
+    newHeader->slotCount = slotCount;
+    newHeader->state = FLIGHT_RECORDER_RUNNING;
+    newHeader->startTimestampMS = TimeUtil::now();
+    newHeader->pid = getpid();
+    memcpy(newHeader->magic, FLIGHT_RECORDER_MAGIC, sizeof(newHeader->magic));
+    msync(mapped, size, MS_SYNC);
+    __atomic_store_n(&header, newHeader, __ATOMIC_RELEASE);
+
+    if(syncIntervalMS > 0)
+    {
+        syncTask = new WheelPeriodicTask(syncIntervalMS, _sync, this);
+        syncTask->start();
+    }
+    return result;
+}
+
+inline void FlightRecorderLogger::stop(void)
+{
+    if(header)
+    {
+        header->state = FLIGHT_RECORDER_STOPPED;
+    }
+    unmap();
+    delegateStop();
+}
+
+inline void FlightRecorderLogger::log(const char *tag, LogLevel logLevel, const char *formatStr,
+                                                                                       va_list variableArgList)
+{
+    FlightRecorderHeader *ring = __atomic_load_n(&header, __ATOMIC_ACQUIRE);
+    if(ring)
+    {
+        uint64_t seq = __atomic_add_fetch(&ring->lastSeq, 1, __ATOMIC_RELAXED);
+        FlightRecorderSlot *slot = (FlightRecorderSlot *) (slots + ((seq - 1) % slotCount) * slotSize);
+        // Mark it as being written, before any other stores.
+        __atomic_store_n(&slot->seq, 0, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+
+        char *data = (char *) (slot + 1);
+        int dataSize = slotSize - (int) sizeof(FlightRecorderSlot);
+        // Cut to the slot too, at least '\0' of the text follows it.
+        int tagLen = tag ? (int) strnlen(tag, FLIGHT_RECORDER_MAX_TAG_LEN) : 0;
+        if(tagLen > dataSize - 1)
+        {
+            tagLen = dataSize - 1;
+        }
+        if(tagLen > 0)
+        {
+            memcpy(data, tag, tagLen);
+        }
+        va_list argList;
+        va_copy(argList, variableArgList);
+        int textLen = vsnprintf(data + tagLen, dataSize - tagLen, formatStr, argList);
+        va_end(argList);
+        textLen = (textLen < 0) ? 0 : std::min(textLen, dataSize - tagLen - 1);
+        // Zero padding, for the checksum by 8 bytes.
+        int usedLen = tagLen + textLen;
+        memset(data + usedLen, 0, ((usedLen + 7) & ~7) - usedLen);
+
+        slot->timestampMS = TimeUtil::now();
+        slot->threadID = Thread::getCurrentThreadID();
+        slot->logLevel = (uint8_t) logLevel;
+        slot->tagLen = (uint8_t) tagLen;
+        slot->textLen = (uint16_t) textLen;
+        slot->checksum = checksum(seq, slot);
+        __atomic_store_n(&slot->seq, seq, __ATOMIC_RELEASE);
+    }
+    delegateLog(tag, logLevel, formatStr, variableArgList);
+}
+
+inline void FlightRecorderLogger::flush(void)
+{
+    if(header)
+    {
+        msync(header, mappedSize, MS_SYNC);
+    }
+    delegateFlush();
+}
+
+inline void FlightRecorderLogger::unmap(void)
+{
+    if(syncTask)
+    {
+        syncTask->stopAndJoin();
+        syncTask->deref();
+        syncTask = 0;
+    }
+    if(header)
+    {
+        void *mapped = header;
+        __atomic_store_n(&header, (FlightRecorderHeader *) 0, __ATOMIC_RELEASE);
+        msync(mapped, mappedSize, MS_SYNC);
+        munmap(mapped, mappedSize);
+        slots = 0;
+    }
+}
+
+inline int FlightRecorderLogger::_sync(void *context)
+{
+    FlightRecorderLogger *logger = (FlightRecorderLogger *) context;
+    FlightRecorderHeader *ring = __atomic_load_n(&logger->header, __ATOMIC_ACQUIRE);
+    if(ring)
+    {
+        msync(ring, logger->mappedSize, MS_SYNC);
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline int FlightRecorderLogger::alignSlotSize(int slotSize)
+{
+    if(slotSize < (int) FLIGHT_RECORDER_MIN_SLOT_SIZE)
+    {
+        return 0;
+    }
+    return (slotSize + 7) & ~7;
+}
+
+inline uint64_t FlightRecorderLogger::checksum(uint64_t seq, const FlightRecorderSlot *slot)
+{
+    // FNV-1a by 8 bytes, over seq, the slot fields and the padded data.
+    uint64_t hash = (14695981039346656037ull ^ seq) * 1099511628211ull;
+    hash = (hash ^ (uint64_t) slot->timestampMS) * 1099511628211ull;
+    hash = (hash ^ slot->threadID ^ ((uint64_t) slot->logLevel << 32) ^ ((uint64_t) slot->tagLen << 40) ^
+            ((uint64_t) slot->textLen << 48)) * 1099511628211ull;
+    const char *data = (const char *) (slot + 1);
+    int paddedLen = (slot->tagLen + slot->textLen + 7) & ~7;
+    for(int i = 0; i < paddedLen; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * 1099511628211ull;
+    }
+    return hash;
+}
+
+inline FlightRecorderReader::FlightRecorderReader(SysLogger *target) : DelegateLogger(target)
+{
+}
+
+inline FlightRecorderReader::~FlightRecorderReader()
+{
+}
+
+inline int FlightRecorderReader::replay(const char *ringFilePath, bool includeStopped)
+{
+    int fd = open(ringFilePath, O_RDONLY);
+    if(fd < 0)
+    {
+        return MIO_ERR_NO_DATA;
+    }
+    struct stat fileStat;
+    FlightRecorderHeader header;
+    if((fstat(fd, &fileStat) != 0) || (pread(fd, &header, sizeof(header), 0) != (ssize_t) sizeof(header)) ||
+       (memcmp(header.magic, FLIGHT_RECORDER_MAGIC, sizeof(header.magic)) != 0) ||
+       (header.version != FLIGHT_RECORDER_VERSION) || (header.slotSize < FLIGHT_RECORDER_MIN_SLOT_SIZE) ||
+       ((header.slotSize & 7) != 0) || (header.slotCount == 0) ||
+       ((off_t) (FLIGHT_RECORDER_HEADER_SIZE + (uint64_t) header.slotSize * header.slotCount) > fileStat.st_size))
+    {
+        close(fd);
+        return MIO_ERR_NO_DATA;
+    }
+    if((header.state == FLIGHT_RECORDER_STOPPED) && !includeStopped)
+    {
+        close(fd);
+        return 0;
+    }
+    size_t slotsSize = (size_t) header.slotSize * header.slotCount;
+    char *slots = (char *) malloc(slotsSize);
+    if(!slots)
+    {
+        close(fd);
+        return MIO_ERR_OUT_OF_MEMORY;
+    }
+    ssize_t readSize = pread(fd, slots, slotsSize, FLIGHT_RECORDER_HEADER_SIZE);
+    close(fd);
+    if(readSize != (ssize_t) slotsSize)
+    {
+        free(slots);
+        return MIO_ERR_IO_GENERAL;
+    }
+
+    // Valid slots, ordered by sequence number.
+    std::vector<std::pair<uint64_t, FlightRecorderSlot *> > records;
+    int maxDataLen = (int) header.slotSize - (int) sizeof(FlightRecorderSlot);
+    for(uint32_t i = 0; i < header.slotCount; ++i)
+    {
+        FlightRecorderSlot *slot = (FlightRecorderSlot *) (slots + (size_t) i * header.slotSize);
+        if((slot->seq == 0) || (slot->tagLen > FLIGHT_RECORDER_MAX_TAG_LEN) ||
+           (slot->tagLen + slot->textLen >= maxDataLen))
+        {
+            continue;
+        }
+        if(FlightRecorderLogger::checksum(slot->seq, slot) == slot->checksum)
+        {
+            records.push_back(std::make_pair(slot->seq, slot));
+        }
+    }
+    std::sort(records.begin(), records.end());
+
+    if(!records.empty())
+    {
+        delegateLogFormatted(FLIGHT_RECORDER_REPLAY_TAG, LOG_KEY_INFO,
+                             "%d records recovered from %s (pid %u), seq %llu ~ %llu of %llu",
+                             (int) records.size(), ringFilePath, header.pid,
+                             (unsigned long long) records.front().first, (unsigned long long) records.back().first,
+                             (unsigned long long) header.lastSeq);
+    }
+    char prefix[128];
+    for(size_t i = 0; i < records.size(); ++i)
+    {
+        FlightRecorderSlot *slot = records[i].second;
+        char *data = (char *) (slot + 1);
+        char tag[FLIGHT_RECORDER_MAX_TAG_LEN + 1];
+        memcpy(tag, data, slot->tagLen);
+        tag[slot->tagLen] = '\0';
+        data[slot->tagLen + slot->textLen] = '\0';
+        formatLogLinePrefix(prefix, sizeof(prefix), slot->timestampMS, (LogLevel) slot->logLevel,
+                            (int) slot->threadID, tag);
+        delegateLogFormatted(FLIGHT_RECORDER_REPLAY_TAG, (LogLevel) slot->logLevel, "%s%s", prefix,
+                             data + slot->tagLen);
+    }
+    free(slots);
+    return (int) records.size();
+}
+
+#endif//_LOG_FLIGHT_RECORDER_LOGGER_H
@@ -0,0 +1,256 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/LogRateLimiter.h                                                                        *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Lock-free token buckets for log rate limiting, per tag (by LogTagRegistry IDs) and per call *
+ *                site (see LOG_X_LIMITED() of log/logMacros.h).                                              *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_LOG_RATE_LIMITER_H
+#define _LOG_LOG_RATE_LIMITER_H
+
+// Standard includes
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+// libBase includes
+#include <log/LogTagRegistry.h>
+
+/*!
+ * @brief Token bucket, by GCRA (generic cell rate algorithm), so the state is one 64 bits "theoretical arrival
+ *        time" updated by CAS.
+ *
+ * @remarks
+ *   1. maxPerSecond messages per second in average, and up to burst messages at once.  0 is unlimited.
+ *   2. Suppressed messages are counted, and reported by the next accepted tryAcquire().
+ *   3. A check is about 10ns, much cheaper than formatting a message.
+ */
+class LogTokenBucket
+{
+  public:
+    LogTokenBucket(int maxPerSecond = 0, int burst = 0);
+
+    // It can be called while others are calling tryAcquire().
+    void setRate(int maxPerSecond, int burst);
+    bool isLimited(void) const;
+    // 1. Return true if the message is accepted.
+    // 2. If accepted, *suppressedHolder is the number of messages suppressed since the last accepted one.
+    bool tryAcquire(uint32_t *suppressedHolder);
+    // Give back the suppressed count of an accepted message which is dropped by a later check, so the next
+    // accepted tryAcquire() reports it.
+    void addSuppressed(uint32_t count);
+
+    // CLOCK_MONOTONIC_COARSE, a few ms resolution is enough for log rates, and it is much cheaper.
+    static int64_t monotonicNowNS(void);
+
+  private:
+    std::atomic<int64_t> intervalNS;
+    // Max distance between the theoretical arrival time and now, (burst * intervalNS).
+    std::atomic<int64_t> limitNS;
+    std::atomic<int64_t> theoreticalArrivalNS;
+    std::atomic<uint32_t> suppressed;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    LogTokenBucket(const LogTokenBucket &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    LogTokenBucket &operator=(const LogTokenBucket &);
+};
+
+/*!
+ * @brief Per-tag rate limits, a bucket per LogTagRegistry ID.
+ *
+ * @remarks
+ *   1. The check is a relaxed load only, if no limit is set.
+ *   2. Limits are set by exact tag names, and the default limit applies to other tags.
+ *   3. setTagLimit() interns its tag, tryAcquire(const char *) only looks tags up.  Tags which are not interned
+ *      share one bucket of the default limit, interned ones (see LogTag) have their own.
+ */
+class LogRateLimiter
+{
+  public:
+    static LogRateLimiter *getInstance(void);
+
+    // 0 to remove the limit of the tag (the default limit applies then).
+    void setTagLimit(const char *tag, int maxPerSecond, int burst);
+    // For tags w/o their own limits, 0 is unlimited (default).
+    void setDefaultLimit(int maxPerSecond, int burst);
+
+    // Same as LogTokenBucket::tryAcquire(), see remark 3 for tags which are not interned.
+    bool tryAcquire(const char *tag, uint32_t *suppressedHolder);
+    bool tryAcquire(int tagID, uint32_t *suppressedHolder);
+
+  private:
+    LogTokenBucket buckets[LOG_TAG_MAX_TAGS];
+    // Shared by tags which are not interned, it follows the default limit.
+    LogTokenBucket otherTagsBucket;
+    // Set by setTagLimit(), other buckets follow the default limit.
+    std::atomic<bool> hasOwnLimit[LOG_TAG_MAX_TAGS];
+    std::atomic<int> defaultMaxPerSecond;
+    std::atomic<int> defaultBurst;
+    // Any limit is set.
+    std::atomic<bool> isEnabled;
+    OsalMutex mutex;
+
+    LogRateLimiter(void);
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    LogRateLimiter(const LogRateLimiter &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    LogRateLimiter &operator=(const LogRateLimiter &);
+
+    // Called with mutex locked.
+    void updateEnabled(void);
+};
+
+inline LogTokenBucket::LogTokenBucket(int maxPerSecond, int burst) :
+    intervalNS(0), limitNS(0), theoreticalArrivalNS(0), suppressed(0)
+{
+    setRate(maxPerSecond, burst);
+}
+
+inline void LogTokenBucket::setRate(int maxPerSecond, int burst)
+{
+    int64_t interval = (maxPerSecond > 0) ? (1000000000LL / maxPerSecond) : 0;
+    limitNS.store(interval * ((burst > 0) ? burst : 1), std::memory_order_relaxed);
+    intervalNS.store(interval, std::memory_order_relaxed);
+}
+
+inline bool LogTokenBucket::isLimited(void) const
+{
+    return intervalNS.load(std::memory_order_relaxed) != 0;
+}
+
+inline bool LogTokenBucket::tryAcquire(uint32_t *suppressedHolder)
+{
+    int64_t interval = intervalNS.load(std::memory_order_relaxed);
+    if(interval != 0)
+    {
+        int64_t now = monotonicNowNS();
+        int64_t limit = limitNS.load(std::memory_order_relaxed);
+        int64_t arrival = theoreticalArrivalNS.load(std::memory_order_relaxed);
+        int64_t newArrival;
+        do
+        {
+            newArrival = ((arrival > now) ? arrival : now) + interval;
+            if(newArrival - now > limit)
+            {
+                suppressed.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        } while(!theoreticalArrivalNS.compare_exchange_weak(arrival, newArrival, std::memory_order_relaxed));
+    }
+    // Avoid the RMW in most cases.
+    *suppressedHolder = (suppressed.load(std::memory_order_relaxed) == 0) ? 0 :
+                                                            suppressed.exchange(0, std::memory_order_relaxed);
+    return true;
+}
+
+inline void LogTokenBucket::addSuppressed(uint32_t count)
+{
+    if(count > 0)
+    {
+        suppressed.fetch_add(count, std::memory_order_relaxed);
+    }
+}
+
+inline int64_t LogTokenBucket::monotonicNowNS(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+inline LogRateLimiter *LogRateLimiter::getInstance(void)
+{
+    // Never deleted, as LogTagRegistry.
+    static LogRateLimiter *limiter = new LogRateLimiter();
+    return limiter;
+}
+
+inline LogRateLimiter::LogRateLimiter(void) : defaultMaxPerSecond(0), defaultBurst(0), isEnabled(false)
+{
+    for(int i = 0; i < LOG_TAG_MAX_TAGS; ++i)
+    {
+        hasOwnLimit[i].store(false, std::memory_order_relaxed);
+    }
+}
+
+inline void LogRateLimiter::setTagLimit(const char *tag, int maxPerSecond, int burst)
+{
+    int tagID = LogTagRegistry::getInstance()->intern(tag);
+    if(tagID == LOG_TAG_INVALID_ID)
+    {
+        return;
+    }
+    SmartMutexLock lock(mutex);
+    if(maxPerSecond > 0)
+    {
+        hasOwnLimit[tagID].store(true, std::memory_order_relaxed);
+        buckets[tagID].setRate(maxPerSecond, burst);
+    }
+    else
+    {
+        hasOwnLimit[tagID].store(false, std::memory_order_relaxed);
+        buckets[tagID].setRate(defaultMaxPerSecond.load(std::memory_order_relaxed),
+                               defaultBurst.load(std::memory_order_relaxed));
+    }
+    updateEnabled();
+}
+
+inline void LogRateLimiter::setDefaultLimit(int maxPerSecond, int burst)
+{
+    SmartMutexLock lock(mutex);
+    defaultMaxPerSecond.store(maxPerSecond, std::memory_order_relaxed);
+    defaultBurst.store(burst, std::memory_order_relaxed);
+    otherTagsBucket.setRate(maxPerSecond, burst);
+    for(int i = 0; i < LOG_TAG_MAX_TAGS; ++i)
+    {
+        if(!hasOwnLimit[i].load(std::memory_order_relaxed))
+        {
+            buckets[i].setRate(maxPerSecond, burst);
+        }
+    }
+    updateEnabled();
+}
+
+inline bool LogRateLimiter::tryAcquire(const char *tag, uint32_t *suppressedHolder)
+{
+    if(!isEnabled.load(std::memory_order_relaxed))
+    {
+        *suppressedHolder = 0;
+        return true;
+    }
+    return tryAcquire(tag ? LogTagRegistry::getInstance()->find(tag) : LOG_TAG_INVALID_ID, suppressedHolder);
+}
+
+inline bool LogRateLimiter::tryAcquire(int tagID, uint32_t *suppressedHolder)
+{
+    if(!isEnabled.load(std::memory_order_relaxed))
+    {
+        *suppressedHolder = 0;
+        return true;
+    }
+    if((unsigned) tagID >= LOG_TAG_MAX_TAGS)
+    {
+        return otherTagsBucket.tryAcquire(suppressedHolder);
+    }
+    return buckets[tagID].tryAcquire(suppressedHolder);
+}
+
+inline void LogRateLimiter::updateEnabled(void)
+{
+    bool enabled = defaultMaxPerSecond.load(std::memory_order_relaxed) > 0;
+    for(int i = 0; (i < LOG_TAG_MAX_TAGS) && !enabled; ++i)
+    {
+        enabled = hasOwnLimit[i].load(std::memory_order_relaxed);
+    }
+    isEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+#endif//_LOG_LOG_RATE_LIMITER_H
@@ -67,6 +67,8 @@ class LogSystem
      *        will be logged by the logger.  Default is LOG_INFO.
      */
     void setLogLevel(LogLevel logLevel);
+    // Lock-free, for cheap checks before log arguments are evaluated (see log/logMacros.h).
+    LogLevel getLogLevel(void) const;
 
     // 1. This is used to simplify debug, not for regular usage.
     // 2. strTags are seperated by ',', for example, "main,usb", only logs with tag "main", "usb" are acceptable.
@@ -200,4 +202,9 @@ class LogSystem
     List<LogSystemFilterItem *> filterItems;
 };
 
+inline LogLevel LogSystem::getLogLevel(void) const
+{
+    return __atomic_load_n(&logLevelThreshold, __ATOMIC_RELAXED);
+}
+
 #endif//_LOG_LOG_SYSTEM_H
@@ -0,0 +1,539 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/LogTagRegistry.h                                                                        *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Interned log tags with per-tag log levels and filters, each tag gets a small integer ID and  *
+ *                the check is one array lookup.                                                              *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_LOG_TAG_REGISTRY_H
+#define _LOG_LOG_TAG_REGISTRY_H
+
+// Standard includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+// libBase includes
+#include <container/SmallList.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+#include <log/logLevel.h>
+#include <log/LogSystem.h>
+
+// Max interned tags, should be power of 2.  Once exceeded, intern() returns LOG_TAG_INVALID_ID.
+#define LOG_TAG_MAX_TAGS            1024
+#define LOG_TAG_INVALID_ID          (-1)
+// Effective level of tags which are filtered out.
+#define LOG_TAG_LEVEL_OFF           (-1)
+
+// Tag pattern with '*' wildcard at the start and/or end, same as LogSystem::setLogFilter().
+struct _LogTagPattern
+{
+    char *pattern;
+    int len;
+    bool isHeadWildcard;
+    bool isTailWildcard;
+    // For level rules only.
+    LogLevel logLevel;
+
+    _LogTagPattern(const char *str, int strLen, LogLevel _logLevel);
+    ~_LogTagPattern();
+    bool match(const char *tag, int tagLen) const;
+};
+
+/*!
+ * @brief System-wide registry of log tags.
+ *
+ * @remarks
+ *   1. A tag is interned once and gets an ID, in [0, LOG_TAG_MAX_TAGS).  Hot paths keep the ID (see LogTag),
+ *      then isLoggable(int, LogLevel) is one array lookup w/o lock.  isLoggable(const char *, LogLevel) only
+ *      finds the ID by hash, tags are interned by intern() (LogTag), and by setTagLevel()/setFilter() for
+ *      their tags w/o wildcards.  Other tags get the level of no rule, w/o lock, unless wildcard rules or
+ *      filters are set, then they are matched with the mutex locked (intern hot tags by LogTag).
+ *   2. Effective level of a tag = LOG_TAG_LEVEL_OFF if filtered out, else the level of the last matched
+ *      setTagLevel() rule, else the default level.  Effective levels are precomputed whenever rules change, or
+ *      a tag is interned.
+ *   3. LogSystem drops messages above its own threshold before they reach SysLoggers.  So, for tags with
+ *      higher levels than the default, bindLogSystem() keeps the threshold of the LogSystem at maxLevel(), and
+ *      TagFilterLogger does the per-tag check for LogSystem::l(), ::d(), ...
+ *   4. Tag names are never freed.
+ */
+class LogTagRegistry
+{
+  public:
+    static LogTagRegistry *getInstance(void);
+
+    // Return the ID of tag, which is interned if it is new.  LOG_TAG_INVALID_ID is returned if the registry is
+    // full, or tag is 0.
+    int intern(const char *tag);
+    // Same as intern(), but it is not interned if it is new.
+    int find(const char *tag) const;
+    // Return 0 for invalid IDs.
+    const char *getTagName(int tagID) const;
+    int getTagCount(void) const;
+
+    bool isLoggable(int tagID, LogLevel logLevel) const;
+    // The tag is not interned if it is new, see remark 1.
+    bool isLoggable(const char *tag, LogLevel logLevel) const;
+    // Return LOG_TAG_LEVEL_OFF or a LogLevel.
+    int getEffectiveLevel(int tagID) const;
+
+    // For tags w/o matched setTagLevel() rules.  Default is LOG_INFO, same as LogSystem.
+    void setDefaultLevel(LogLevel logLevel);
+    LogLevel getDefaultLevel(void) const;
+    // 1. tagPattern supports '*' wildcard at the start and/or end, as LogSystem::setLogFilter().
+    // 2. Later rules take priority.  The rule with the same pattern is replaced.
+    void setTagLevel(const char *tagPattern, LogLevel logLevel);
+    void resetTagLevels(void);
+    // 1. Same syntax as LogSystem::setLogFilter(), for example, "main,usb*".  Tags which don't match any filter
+    //    tag are turned off.
+    // 2. If strTags is 0, or an empty string, filter is reset.
+    void setFilter(const char *strTags);
+
+    // The highest level which may be logged by any tag.
+    LogLevel maxLevel(void) const;
+    // Keep the log level of logSystem at maxLevel() since now, 0 to unbind.
+    void bindLogSystem(LogSystem *logSystem);
+
+  private:
+    // Hash slots, 0 is empty, otherwise tag ID + 1.  Slots are never reused, so lookup is lock-free.
+    std::atomic<int> slots[LOG_TAG_MAX_TAGS * 2];
+    uint32_t slotHashes[LOG_TAG_MAX_TAGS * 2];
+    const char *tagNames[LOG_TAG_MAX_TAGS];
+    std::atomic<int8_t> effectiveLevels[LOG_TAG_MAX_TAGS];
+    std::atomic<int> tagCount;
+    std::atomic<int> defaultLevel;
+    // Effective level of tags which are not interned, unless needsMatching.
+    std::atomic<int> otherTagsLevel;
+    // Wildcard rules or filters are set (or tags of rules cannot be interned), tags which are not interned are
+    // matched by computeLevel().
+    std::atomic<bool> needsMatching;
+
+    // Protect interning and rules.
+    mutable OsalMutex mutex;
+    // A few rules usually, inline w/o allocation, and contiguous for computeLevel() of each tag.
+    SmallList<_LogTagPattern *, 4> levelRules;
+    SmallList<_LogTagPattern *, 4> filters;
+    LogSystem *boundLogSystem = 0;
+
+    LogTagRegistry(void);
+    ~LogTagRegistry();
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    LogTagRegistry(const LogTagRegistry &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    LogTagRegistry &operator=(const LogTagRegistry &);
+
+    static uint32_t hashTag(const char *tag);
+    int lookup(const char *tag, uint32_t hash, int *freeSlot) const;
+    // Called with mutex locked.
+    int internLocked(const char *tag, uint32_t hash);
+    // The tag of a rule w/o wildcards is interned, so its level is found by isLoggable(const char *, LogLevel).
+    void internRuleTag(const _LogTagPattern *rule);
+    int8_t computeLevel(const char *tag) const;
+    void recomputeLevels(void);
+    // Called w/o mutex, LogSystem may call SysLoggers (and so this registry) with its own mutex locked.
+    void syncLogSystem(void);
+};
+
+/*!
+ * @brief Handle of an interned tag, for example, a file scope "static LogTag logTag("muxer");".
+ */
+class LogTag
+{
+  public:
+    LogTag(const char *name) : tagID(LogTagRegistry::getInstance()->intern(name)), tagName(name)
+    {
+    }
+
+    int getID(void) const
+    {
+        return tagID;
+    }
+
+    const char *getName(void) const
+    {
+        return tagName;
+    }
+
+    bool isLoggable(LogLevel logLevel) const
+    {
+        return LogTagRegistry::getInstance()->isLoggable(tagID, logLevel);
+    }
+
+  private:
+    const int tagID;
+    const char *const tagName;
+};
+
+inline _LogTagPattern::_LogTagPattern(const char *str, int strLen, LogLevel _logLevel) : logLevel(_logLevel)
+{
+    isHeadWildcard = (strLen > 0) && (str[0] == '*');
+    if(isHeadWildcard)
+    {
+        ++str;
+        --strLen;
+    }
+    isTailWildcard = (strLen > 0) && (str[strLen - 1] == '*');
+    if(isTailWildcard)
+    {
+        --strLen;
+    }
+    len = strLen;
+    pattern = (char *) malloc(len + 1);
+    memcpy(pattern, str, len);
+    pattern[len] = '\0';
+}
+
+inline _LogTagPattern::~_LogTagPattern()
+{
+    free(pattern);
+}
+
+inline bool _LogTagPattern::match(const char *tag, int tagLen) const
+{
+    if(isHeadWildcard && isTailWildcard)
+    {
+        return strstr(tag, pattern) != 0;
+    }
+    if(tagLen < len)
+    {
+        return false;
+    }
+    if(isHeadWildcard)
+    {
+        return memcmp(tag + tagLen - len, pattern, len) == 0;
+    }
+    if(isTailWildcard)
+    {
+        return memcmp(tag, pattern, len) == 0;
+    }
+    return (tagLen == len) && (memcmp(tag, pattern, len) == 0);
+}
+
+inline LogTagRegistry *LogTagRegistry::getInstance(void)
+{
+    // Never deleted, tags may be checked during static destruction.
+    static LogTagRegistry *registry = new LogTagRegistry();
+    return registry;
+}
+
+inline LogTagRegistry::LogTagRegistry(void) :
+    tagCount(0), defaultLevel(LOG_INFO), otherTagsLevel(LOG_INFO), needsMatching(false)
+{
+    for(int i = 0; i < LOG_TAG_MAX_TAGS * 2; ++i)
+    {
+        slots[i].store(0, std::memory_order_relaxed);
+    }
+    for(int i = 0; i < LOG_TAG_MAX_TAGS; ++i)
+    {
+        effectiveLevels[i].store(LOG_INFO, std::memory_order_relaxed);
+    }
+}
+
+inline LogTagRegistry::~LogTagRegistry()
+{
+    levelRules.deleteAllObjsAndReset();
+    filters.deleteAllObjsAndReset();
+}
+
+inline uint32_t LogTagRegistry::hashTag(const char *tag)
+{
+    // FNV-1a.
+    uint32_t hash = 2166136261u;
+    for(const unsigned char *ptr = (const unsigned char *) tag; *ptr; ++ptr)
+    {
+        hash = (hash ^ *ptr) * 16777619u;
+    }
+    return hash;
+}
+
+inline int LogTagRegistry::lookup(const char *tag, uint32_t hash, int *freeSlot) const
+{
+    const int mask = LOG_TAG_MAX_TAGS * 2 - 1;
+    for(int i = 0; i <= mask; ++i)
+    {
+        int slot = (hash + i) & mask;
+        int value = slots[slot].load(std::memory_order_acquire);
+        if(value == 0)
+        {
+            if(freeSlot)
+            {
+                *freeSlot = slot;
+            }
+            return LOG_TAG_INVALID_ID;
+        }
+        if((slotHashes[slot] == hash) && (strcmp(tagNames[value - 1], tag) == 0))
+        {
+            return value - 1;
+        }
+    }
+    return LOG_TAG_INVALID_ID;
+}
+
+inline int LogTagRegistry::find(const char *tag) const
+{
+    return tag ? lookup(tag, hashTag(tag), 0) : LOG_TAG_INVALID_ID;
+}
+
+inline int LogTagRegistry::intern(const char *tag)
+{
+    if(!tag)
+    {
+        return LOG_TAG_INVALID_ID;
+    }
+    uint32_t hash = hashTag(tag);
+    int tagID = lookup(tag, hash, 0);
+    if(tagID != LOG_TAG_INVALID_ID)
+    {
+        return tagID;
+    }
+
+    SmartMutexLock lock(mutex);
+    return internLocked(tag, hash);
+}
+
+inline int LogTagRegistry::internLocked(const char *tag, uint32_t hash)
+{
+    // Look up again, it may be interned by others.
+    int freeSlot = -1;
+    int tagID = lookup(tag, hash, &freeSlot);
+    if((tagID != LOG_TAG_INVALID_ID) || (freeSlot < 0))
+    {
+        return tagID;
+    }
+    int count = tagCount.load(std::memory_order_relaxed);
+    if(count >= LOG_TAG_MAX_TAGS)
+    {
+        return LOG_TAG_INVALID_ID;
+    }
+    tagNames[count] = strdup(tag);
+    effectiveLevels[count].store(computeLevel(tag), std::memory_order_relaxed);
+    slotHashes[freeSlot] = hash;
+    // Publish name, level and hash.
+    slots[freeSlot].store(count + 1, std::memory_order_release);
+    tagCount.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+inline const char *LogTagRegistry::getTagName(int tagID) const
+{
+    if((tagID < 0) || (tagID >= tagCount.load(std::memory_order_acquire)))
+    {
+        return 0;
+    }
+    return tagNames[tagID];
+}
+
+inline int LogTagRegistry::getTagCount(void) const
+{
+    return tagCount.load(std::memory_order_acquire);
+}
+
+inline bool LogTagRegistry::isLoggable(int tagID, LogLevel logLevel) const
+{
+    if((unsigned) tagID >= LOG_TAG_MAX_TAGS)
+    {
+        return (int) logLevel <= defaultLevel.load(std::memory_order_relaxed);
+    }
+    return (int) logLevel <= effectiveLevels[tagID].load(std::memory_order_relaxed);
+}
+
+inline bool LogTagRegistry::isLoggable(const char *tag, LogLevel logLevel) const
+{
+    int tagID = find(tag);
+    if((tagID != LOG_TAG_INVALID_ID) || !tag)
+    {
+        return isLoggable(tagID, logLevel);
+    }
+    if(!needsMatching.load(std::memory_order_relaxed))
+    {
+        return (int) logLevel <= otherTagsLevel.load(std::memory_order_relaxed);
+    }
+    SmartMutexLock lock(mutex);
+    return (int) logLevel <= computeLevel(tag);
+}
+
+inline int LogTagRegistry::getEffectiveLevel(int tagID) const
+{
+    if((unsigned) tagID >= LOG_TAG_MAX_TAGS)
+    {
+        return defaultLevel.load(std::memory_order_relaxed);
+    }
+    return effectiveLevels[tagID].load(std::memory_order_relaxed);
+}
+
+inline void LogTagRegistry::setDefaultLevel(LogLevel logLevel)
+{
+    {
+        SmartMutexLock lock(mutex);
+        defaultLevel.store(logLevel, std::memory_order_relaxed);
+        recomputeLevels();
+    }
+    syncLogSystem();
+}
+
+inline LogLevel LogTagRegistry::getDefaultLevel(void) const
+{
+    return (LogLevel) defaultLevel.load(std::memory_order_relaxed);
+}
+
+inline void LogTagRegistry::setTagLevel(const char *tagPattern, LogLevel logLevel)
+{
+    if(!tagPattern || !tagPattern[0])
+    {
+        return;
+    }
+    {
+        SmartMutexLock lock(mutex);
+        _LogTagPattern *rule = new _LogTagPattern(tagPattern, (int) strlen(tagPattern), logLevel);
+        for(int i = 0; i < levelRules.size(); ++i)
+        {
+            _LogTagPattern *oldRule = levelRules.get(i);
+            if((oldRule->isHeadWildcard == rule->isHeadWildcard) &&
+               (oldRule->isTailWildcard == rule->isTailWildcard) && (strcmp(oldRule->pattern, rule->pattern) == 0))
+            {
+                levelRules.removeByIndex(i);
+                delete oldRule;
+                break;
+            }
+        }
+        internRuleTag(rule);
+        levelRules.addWithoutCheck(rule);
+        recomputeLevels();
+    }
+    syncLogSystem();
+}
+
+inline void LogTagRegistry::resetTagLevels(void)
+{
+    {
+        SmartMutexLock lock(mutex);
+        levelRules.deleteAllObjsAndReset();
+        recomputeLevels();
+    }
+    syncLogSystem();
+}
+
+inline void LogTagRegistry::setFilter(const char *strTags)
+{
+    {
+        SmartMutexLock lock(mutex);
+        filters.deleteAllObjsAndReset();
+        while(strTags && *strTags)
+        {
+            const char *end = strchr(strTags, ',');
+            int len = end ? (int) (end - strTags) : (int) strlen(strTags);
+            if(len > 0)
+            {
+                _LogTagPattern *filter = new _LogTagPattern(strTags, len, LOG_DEBUG);
+                internRuleTag(filter);
+                filters.addWithoutCheck(filter);
+            }
+            strTags = end ? (end + 1) : 0;
+        }
+        recomputeLevels();
+    }
+    syncLogSystem();
+}
+
+inline LogLevel LogTagRegistry::maxLevel(void) const
+{
+    SmartMutexLock lock(mutex);
+    // Tags not interned yet get the default level.
+    int level = defaultLevel.load(std::memory_order_relaxed);
+    for(int i = 0; i < levelRules.size(); ++i)
+    {
+        if(levelRules.get(i)->logLevel > level)
+        {
+            level = levelRules.get(i)->logLevel;
+        }
+    }
+    return (LogLevel) level;
+}
+
+inline void LogTagRegistry::bindLogSystem(LogSystem *logSystem)
+{
+    {
+        SmartMutexLock lock(mutex);
+        boundLogSystem = logSystem;
+    }
+    syncLogSystem();
+}
+
+inline int8_t LogTagRegistry::computeLevel(const char *tag) const
+{
+    int tagLen = (int) strlen(tag);
+    if(filters.size() > 0)
+    {
+        bool isAccepted = false;
+        for(int i = 0; (i < filters.size()) && !isAccepted; ++i)
+        {
+            isAccepted = filters.get(i)->match(tag, tagLen);
+        }
+        if(!isAccepted)
+        {
+            return LOG_TAG_LEVEL_OFF;
+        }
+    }
+    for(int i = levelRules.size() - 1; i >= 0; --i)
+    {
+        if(levelRules.get(i)->match(tag, tagLen))
+        {
+            return (int8_t) levelRules.get(i)->logLevel;
+        }
+    }
+    return (int8_t) defaultLevel.load(std::memory_order_relaxed);
+}
+
+inline void LogTagRegistry::internRuleTag(const _LogTagPattern *rule)
+{
+    if(!rule->isHeadWildcard && !rule->isTailWildcard)
+    {
+        internLocked(rule->pattern, hashTag(rule->pattern));
+    }
+}
+
+inline void LogTagRegistry::recomputeLevels(void)
+{
+    int count = tagCount.load(std::memory_order_relaxed);
+    for(int i = 0; i < count; ++i)
+    {
+        effectiveLevels[i].store(computeLevel(tagNames[i]), std::memory_order_relaxed);
+    }
+    bool isMatchingRequired = false;
+    for(int i = 0; i < levelRules.size() + filters.size(); ++i)
+    {
+        const _LogTagPattern *rule = (i < levelRules.size()) ? levelRules.get(i) :
+                                                               filters.get(i - levelRules.size());
+        if(rule->isHeadWildcard || rule->isTailWildcard || (find(rule->pattern) == LOG_TAG_INVALID_ID))
+        {
+            isMatchingRequired = true;
+        }
+    }
+    // Patterns are not empty, so "" matches no rule w/o wildcards, the same as other tags which are not interned.
+    otherTagsLevel.store(computeLevel(""), std::memory_order_relaxed);
+    needsMatching.store(isMatchingRequired, std::memory_order_relaxed);
+}
+
+inline void LogTagRegistry::syncLogSystem(void)
+{
+    LogSystem *logSystem;
+    {
+        SmartMutexLock lock(mutex);
+        logSystem = boundLogSystem;
+    }
+    if(logSystem)
+    {
+        logSystem->setLogLevel(maxLevel());
+    }
+}
+
+#endif//_LOG_LOG_TAG_REGISTRY_H
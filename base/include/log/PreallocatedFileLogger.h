@@ -0,0 +1,328 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/PreallocatedFileLogger.h                                                                *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  AutoSerialFileLogger which preallocates each log file to its cut size, and writes in large  *
+ *                aligned chunks from a staging buffer, to avoid cluster allocation churn on FAT SD cards.    *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_PREALLOCATED_FILE_LOGGER_H
+#define _LOG_PREALLOCATED_FILE_LOGGER_H
+
+// Standard includes
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+// POSIX includes
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// libBase includes
+#include <util/SmartMutexLock.h>
+#include <util/TimeUtil.h>
+#include <task/Thread.h>
+#include <log/AutoSerialFileLogger.h>
+#include <log/logLineFormat.h>
+
+// Write unit, file offsets of writes are aligned to it (except flush()/stop()).  It should be multiple of the
+// cluster size.
+#define PREALLOCATED_LOG_CHUNK_SIZE     (64 * 1024)
+
+/*!
+ * @brief AutoSerialFileLogger with preallocated files and coalesced writes.  File naming, cutting, cleanup and
+ *        the maxTotalSizeInMB budget are the same as AutoSerialFileLogger.
+ *
+ * @remarks
+ *   1. Each new file is fallocate()'d to the cut size with FALLOC_FL_KEEP_SIZE, so clusters are reserved at
+ *      once, but the file length (and so currentFileSize(), cleanupOldFiles() budget, and append position)
+ *      is still the logical length.  On close, it is truncated to the logical length, which releases unused
+ *      reserved clusters.  If the file system doesn't support it, files just grow as usual.
+ *   2. Lines are formatted into a staging buffer, and written by write() in chunks of chunkSize, aligned by
+ *      file offset.  flush() (LogSystem::flush()), cut() and stop() write out the rest.  Messages in the
+ *      staging buffer are lost at a crash, use AsyncLogger/flush() policies accordingly.
+ *   3. currentSize() includes staged bytes.
+ *   4. It is also a LogLineSink, lines logged through AsyncLogger keep the original time and thread ID.
+ */
+class PreallocatedFileLogger : public AutoSerialFileLogger, public LogLineSink
+{
+  public:
+    PreallocatedFileLogger(const char *fullLogDirPath, const char *baseName, int maxTotalSizeInMB = 10,
+                           int chunkSize = PREALLOCATED_LOG_CHUNK_SIZE);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~PreallocatedFileLogger();
+
+    // Same as enableCutSizeCheck(cutSize), and new files are preallocated to cutSize.
+    void enablePreallocation(int cutSize);
+
+    /* Implementation for LogLineSink */
+    virtual void logLine(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                         const char *logStr);
+
+  protected:
+    /* Implementation for SysLogger */
+    virtual void stop(void);
+    virtual void log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList);
+    virtual void flush(void);
+    virtual void cut(void);
+    virtual size_t currentSize(void);
+    // Called right before a new log file is opened (with file mutex locked).
+    virtual std::string generateNextFilename(void);
+
+  private:
+    const int chunkSize;
+    int preallocateSize = 0;
+    // Below are protected by fileMutex().
+    char *staging;
+    int stagingSize;
+    int stagedLen = 0;
+    // Logical bytes written to the current file.
+    off_t writtenSize = 0;
+    bool isNewFile = true;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    PreallocatedFileLogger(const PreallocatedFileLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    PreallocatedFileLogger &operator=(const PreallocatedFileLogger &);
+
+    // Format a line into the staging buffer, the prefix is of timestampMS and threadID.
+    void stageLine(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID, const char *formatStr,
+                                                                                       va_list variableArgList);
+    void stageLineFormatted(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                                                                                    const char *formatStr, ...);
+    // Below are called with fileMutex() locked, fp is currentFile().
+    void checkNewFile(FILE *fp);
+    // Write staged bytes up to the last chunk boundary, or all of them.
+    void writeStaged(FILE *fp, bool isAll);
+    void writeFully(FILE *fp, const char *data, int len);
+    // Write all and truncate file to its logical length, before the file is closed.
+    void finishFile(void);
+};
+
+inline PreallocatedFileLogger::PreallocatedFileLogger(const char *fullLogDirPath, const char *baseName,
+                                                      int maxTotalSizeInMB, int _chunkSize) :
+    AutoSerialFileLogger(fullLogDirPath, baseName, maxTotalSizeInMB), chunkSize(_chunkSize)
+{
+    // Two chunks, so a chunk can always be written before the next line is staged.
+    stagingSize = chunkSize * 2;
+    staging = (char *) malloc(stagingSize);
+}
+
+inline PreallocatedFileLogger::~PreallocatedFileLogger()
+{
+    finishFile();
+    free(staging);
+}
+
+inline void PreallocatedFileLogger::enablePreallocation(int cutSize)
+{
+    preallocateSize = cutSize;
+    enableCutSizeCheck(cutSize);
+}
+
+inline void PreallocatedFileLogger::stop(void)
+{
+    finishFile();
+    AutoSerialFileLogger::stop();
+}
+
+inline void PreallocatedFileLogger::logLine(const char *tag, LogLevel logLevel, int64_t timestampMS,
+                                            int threadID, const char *logStr)
+{
+    stageLineFormatted(tag, logLevel, timestampMS, threadID, "%s", logStr);
+}
+
+inline void PreallocatedFileLogger::log(const char *tag, LogLevel logLevel, const char *formatStr,
+                                                                                       va_list variableArgList)
+{
+    stageLine(tag, logLevel, TimeUtil::now(), Thread::getCurrentThreadID(), formatStr, variableArgList);
+}
+
+inline void PreallocatedFileLogger::flush(void)
+{
+    {
+        SmartMutexLock lock(fileMutex());
+        FILE *fp = currentFile();
+        if(fp)
+        {
+            checkNewFile(fp);
+            writeStaged(fp, true);
+        }
+    }
+    AutoSerialFileLogger::flush();
+}
+
+inline void PreallocatedFileLogger::cut(void)
+{
+    finishFile();
+    AutoSerialFileLogger::cut();
+}
+
+inline size_t PreallocatedFileLogger::currentSize(void)
+{
+    SmartMutexLock lock(fileMutex());
+    return currentFile() ? (size_t) (writtenSize + stagedLen) : 0;
+}
+
+inline std::string PreallocatedFileLogger::generateNextFilename(void)
+{
+    isNewFile = true;
+    return AutoSerialFileLogger::generateNextFilename();
+}
+
+inline void PreallocatedFileLogger::stageLine(const char *tag, LogLevel logLevel, int64_t timestampMS,
+                                              int threadID, const char *formatStr, va_list variableArgList)
+{
+    SmartMutexLock lock(fileMutex());
+    FILE *fp = currentFile();
+    if(!fp)
+    {
+        return;
+    }
+    checkNewFile(fp);
+
+    // Less than a chunk is staged here, so there is always room for the prefix.
+    char *ptr = staging + stagedLen;
+    int prefixLen = formatLogLinePrefix(ptr, stagingSize - stagedLen, timestampMS, logLevel, threadID, tag);
+    int room = stagingSize - stagedLen - prefixLen;
+    va_list argList;
+    va_copy(argList, variableArgList);
+    int msgLen = vsnprintf(ptr + prefixLen, room, formatStr, argList);
+    va_end(argList);
+    if(msgLen < 0)
+    {
+        msgLen = 0;
+    }
+    if(msgLen >= room)
+    {
+        // Too long for the rest of the staging buffer, write staged lines (w/o this one) first.
+        char prefix[256];
+        if(prefixLen > (int) sizeof(prefix))
+        {
+            prefixLen = sizeof(prefix);
+        }
+        memcpy(prefix, ptr, prefixLen);
+        writeStaged(fp, true);
+        int lineLen = prefixLen + msgLen + 1;
+        char *line = (lineLen <= stagingSize) ? staging : (char *) malloc(lineLen);
+        memcpy(line, prefix, prefixLen);
+        vsnprintf(line + prefixLen, msgLen + 1, formatStr, variableArgList);
+        line[lineLen - 1] = '\n';
+        if(line == staging)
+        {
+            stagedLen = lineLen;
+        }
+        else
+        {
+            // Longer than the staging buffer, write it directly.
+            writeFully(fp, line, lineLen);
+            free(line);
+        }
+    }
+    else
+    {
+        ptr[prefixLen + msgLen] = '\n';
+        stagedLen += prefixLen + msgLen + 1;
+    }
+    if(stagedLen >= chunkSize)
+    {
+        writeStaged(fp, false);
+    }
+}
+
+inline void PreallocatedFileLogger::stageLineFormatted(const char *tag, LogLevel logLevel, int64_t timestampMS,
+                                                       int threadID, const char *formatStr, ...)
+{
+    va_list argList;
+    va_start(argList, formatStr);
+    stageLine(tag, logLevel, timestampMS, threadID, formatStr, argList);
+    va_end(argList);
+}
+
+inline void PreallocatedFileLogger::checkNewFile(FILE *fp)
+{
+    if(!isNewFile)
+    {
+        return;
+    }
+    isNewFile = false;
+    int fd = fileno(fp);
+    struct stat fileStat;
+    writtenSize = (fstat(fd, &fileStat) == 0) ? fileStat.st_size : 0;
+    if(preallocateSize > writtenSize)
+    {
+        // Failure is fine (not supported by the file system, or no space), the file grows as usual.
+        fallocate(fd, FALLOC_FL_KEEP_SIZE, 0, preallocateSize);
+    }
+}
+
+inline void PreallocatedFileLogger::writeStaged(FILE *fp, bool isAll)
+{
+    int len = stagedLen;
+    if(!isAll)
+    {
+        // Up to the last chunk boundary of the file.
+        off_t end = (writtenSize + stagedLen) / chunkSize * chunkSize;
+        len = (end > writtenSize) ? (int) (end - writtenSize) : 0;
+    }
+    if(len == 0)
+    {
+        return;
+    }
+    writeFully(fp, staging, len);
+    stagedLen -= len;
+    memmove(staging, staging + len, stagedLen);
+}
+
+inline void PreallocatedFileLogger::writeFully(FILE *fp, const char *data, int len)
+{
+    // FILE is opened for append, and FileBasedLogger doesn't write it, so there is no stdio buffer, and
+    // ftell() (currentFileSize()) sees the logical length.
+    int fd = fileno(fp);
+    while(len > 0)
+    {
+        ssize_t written = write(fd, data, len);
+        if(written < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            // No space, or media removed, drop it.
+            return;
+        }
+        data += written;
+        len -= (int) written;
+        writtenSize += written;
+    }
+}
+
+inline void PreallocatedFileLogger::finishFile(void)
+{
+    SmartMutexLock lock(fileMutex());
+    FILE *fp = currentFile();
+    if(!fp)
+    {
+        return;
+    }
+    checkNewFile(fp);
+    writeStaged(fp, true);
+    if(preallocateSize > 0)
+    {
+        // Release reserved but unused clusters.
+        ftruncate(fileno(fp), writtenSize);
+    }
+}
+
+#endif//_LOG_PREALLOCATED_FILE_LOGGER_H
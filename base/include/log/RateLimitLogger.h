@@ -0,0 +1,231 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/RateLimitLogger.h                                                                       *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  DelegateLogger which suppresses repeated identical messages per tag, and optionally applies *
+ *                LogRateLimiter per-tag limits to messages which don't come from log macros.                 *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_RATE_LIMIT_LOGGER_H
+#define _LOG_RATE_LIMIT_LOGGER_H
+
+// Standard includes
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+// libBase includes
+#include <osal/OsalMutex.h>
+#include <util/FlatPropertySet.h>
+#include <util/SmartMutexLock.h>
+#include <log/DelegateLogger.h>
+#include <log/LogRateLimiter.h>
+#include <log/LogTagRegistry.h>
+
+// Repeats are reported at least once per this period, while a message keeps repeating.
+#define LOG_REPEAT_REPORT_MS        30000
+// Longer messages are never suppressed.
+#define LOG_REPEAT_COMPARE_LEN      512
+
+/*!
+ * @brief Duplicate suppression (and rate limiting) in front of the real logger.
+ *
+ * @remarks
+ *   1. A message which is identical (same level and text) to the last one of the same tag is dropped and
+ *      counted.  When the tag logs a different message, flush() or stop() is called, or it has been repeating
+ *      for LOG_REPEAT_REPORT_MS, a single "last message repeated N times" line is logged instead.
+ *   2. Repeats are tracked by tag names, not interned into LogTagRegistry.  Tags beyond LOG_TAG_MAX_TAGS are
+ *      not suppressed.
+ *   3. Messages are formatted once here, and forwarded formatted.
+ *   4. isTagLimitChecked: LogRateLimiter per-tag limits are checked here too, for LogSystem::e(), ::w(), ...
+ *      callers.  Leave it false if the code logs by LOG_X() macros only, which check the limits before
+ *      LogSystem (and its mutex) is reached, otherwise messages are counted twice.
+ *   5. For example:
+ *          LogRateLimiter::getInstance()->setTagLimit("gps", 20, 50);
+ *          LogSystem::getSysLogSystem()->setLogger(new RateLimitLogger(fileLogger));
+ */
+class RateLimitLogger : public DelegateLogger
+{
+  public:
+    RateLimitLogger(SysLogger *target, bool isTagLimitChecked = false);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~RateLimitLogger();
+
+  protected:
+    /* Implementation for SysLogger */
+    virtual void stop(void);
+    virtual void log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList);
+    virtual void flush(void);
+
+  private:
+    struct RepeatState
+    {
+        // Owned, also the key of states.
+        char *tag;
+        std::string message;
+        LogLevel logLevel;
+        uint32_t repeatCount;
+        int64_t firstRepeatMS;
+    };
+
+    const bool isTagLimitChecked;
+    OsalMutex mutex;
+    // Tag -> RepeatState, protected by mutex.
+    FlatPropertySet states;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    RateLimitLogger(const RateLimitLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    RateLimitLogger &operator=(const RateLimitLogger &);
+
+    // Called with mutex locked.
+    // Return 0 if there are LOG_TAG_MAX_TAGS tags already.
+    RepeatState *getState(const char *tag);
+    void reportRepeats(RepeatState *state);
+    void reportAllRepeats(void);
+    static void _reportRepeats(void *context, const char *tag, void *state);
+    static void _deleteState(void *context, const char *tag, void *state);
+};
+
+inline RateLimitLogger::RateLimitLogger(SysLogger *target, bool _isTagLimitChecked) :
+    DelegateLogger(target), isTagLimitChecked(_isTagLimitChecked)
+{
+}
+
+inline RateLimitLogger::~RateLimitLogger()
+{
+    states.enumerate(_deleteState, 0);
+    states.reset();
+}
+
+inline void RateLimitLogger::stop(void)
+{
+    {
+        SmartMutexLock lock(mutex);
+        reportAllRepeats();
+    }
+    delegateStop();
+}
+
+inline void RateLimitLogger::log(const char *tag, LogLevel logLevel, const char *formatStr,
+                                                                                       va_list variableArgList)
+{
+    if(isTagLimitChecked)
+    {
+        uint32_t suppressed;
+        if(!LogRateLimiter::getInstance()->tryAcquire(tag, &suppressed))
+        {
+            return;
+        }
+        if(suppressed > 0)
+        {
+            delegateLogFormatted(tag, logLevel, "%u messages suppressed by the rate limit", suppressed);
+        }
+    }
+    char message[LOG_REPEAT_COMPARE_LEN];
+    va_list argList;
+    va_copy(argList, variableArgList);
+    int len = vsnprintf(message, sizeof(message), formatStr, argList);
+    va_end(argList);
+    if(len < 0)
+    {
+        return;
+    }
+
+    SmartMutexLock lock(mutex);
+    RepeatState *state = getState(tag);
+    if(!state)
+    {
+        delegateLog(tag, logLevel, formatStr, variableArgList);
+        return;
+    }
+    if(len >= (int) sizeof(message))
+    {
+        // Too long to be compared, let the target format it in full.
+        reportRepeats(state);
+        state->message.clear();
+        delegateLog(tag, logLevel, formatStr, variableArgList);
+        return;
+    }
+    if((state->logLevel == logLevel) && (state->message == message) && !state->message.empty())
+    {
+        int64_t nowMS = LogTokenBucket::monotonicNowNS() / 1000000;
+        if(state->repeatCount++ == 0)
+        {
+            state->firstRepeatMS = nowMS;
+        }
+        else if(nowMS - state->firstRepeatMS >= LOG_REPEAT_REPORT_MS)
+        {
+            reportRepeats(state);
+        }
+        return;
+    }
+    reportRepeats(state);
+    state->logLevel = logLevel;
+    state->message = message;
+    delegateLogFormatted(tag, logLevel, "%s", message);
+}
+
+inline void RateLimitLogger::flush(void)
+{
+    {
+        SmartMutexLock lock(mutex);
+        reportAllRepeats();
+    }
+    delegateFlush();
+}
+
+inline RateLimitLogger::RepeatState *RateLimitLogger::getState(const char *tag)
+{
+    const char *name = tag ? tag : "";
+    RepeatState *state = (RepeatState *) states.get(name);
+    if(state || (states.size() >= LOG_TAG_MAX_TAGS))
+    {
+        return state;
+    }
+    state = new RepeatState();
+    state->tag = strdup(name);
+    state->logLevel = LOG_INFO;
+    state->repeatCount = 0;
+    state->firstRepeatMS = 0;
+    states.set(state->tag, state);
+    return state;
+}
+
+inline void RateLimitLogger::reportRepeats(RepeatState *state)
+{
+    if(state->repeatCount > 0)
+    {
+        delegateLogFormatted(state->tag, state->logLevel, "last message repeated %u times", state->repeatCount);
+        state->repeatCount = 0;
+    }
+}
+
+inline void RateLimitLogger::reportAllRepeats(void)
+{
+    states.enumerate(_reportRepeats, this);
+}
+
+inline void RateLimitLogger::_reportRepeats(void *context, const char *, void *state)
+{
+    ((RateLimitLogger *) context)->reportRepeats((RepeatState *) state);
+}
+
+inline void RateLimitLogger::_deleteState(void *, const char *, void *state)
+{
+    free(((RepeatState *) state)->tag);
+    delete (RepeatState *) state;
+}
+
+#endif//_LOG_RATE_LIMIT_LOGGER_H
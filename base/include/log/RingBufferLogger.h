@@ -0,0 +1,343 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/RingBufferLogger.h                                                                      *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Bounded StringBufferLogger, which keeps the most recent lines in a fixed-capacity ring, and *
+ *                provides zero-copy snapshots.                                                               *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_RING_BUFFER_LOGGER_H
+#define _LOG_RING_BUFFER_LOGGER_H
+
+// Standard includes
+#include <stdint.h>
+#include <string.h>
+#include <string>
+// libBase includes
+#include <baseResultCode.h>
+#include <basicType/RefCountObj.h>
+#include <container/List.h>
+#include <container/SmallList.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+#include <util/TimeUtil.h>
+#include <task/Thread.h>
+#include <log/SysLogger.h>
+#include <log/logLineFormat.h>
+
+#define RING_LOG_CHUNK_SIZE         4096
+
+// A ring chunk, whole lines only.  Referenced by the ring and by snapshots.
+class _LogRingChunk : public RefCountObj
+{
+  public:
+    _LogRingChunk(int _size) : data(new char[_size]), size(_size), len(0)
+    {
+    }
+
+    char *const data;
+    const int size;
+    // Written by the logger (with its mutex locked), snapshots read only up to the len they captured.
+    int len;
+
+  protected:
+    virtual ~_LogRingChunk()
+    {
+        delete[] data;
+    }
+};
+
+/*!
+ * @brief Snapshot of RingBufferLogger, the lines are not copied but pinned until the snapshot is released.
+ *
+ * @remarks
+ *   1. Segments are in time order, each one contains whole lines.
+ *   2. Logging goes on while a snapshot is held, the logger allocates new chunks instead of overwriting pinned
+ *      ones, so the memory usage is capacity plus the pinned size at most.
+ *   3. For example:
+ *          LogRingSnapshot snapshot;
+ *          ringLogger->takeSnapshot(&snapshot);
+ *          for(int i = 0; i < snapshot.getSegmentCount(); ++i)
+ *          {
+ *              int len;
+ *              const char *data = snapshot.getSegment(i, &len);
+ *              send(sock, data, len, 0);
+ *          }
+ *          snapshot.release();  // Or by the destructor.
+ */
+class LogRingSnapshot
+{
+  public:
+    LogRingSnapshot(void);
+
+    /*!
+     * Destructor.
+     */
+    ~LogRingSnapshot();
+
+    int getSegmentCount(void) const;
+    // Return 0 if ndx is out of range.
+    const char *getSegment(int ndx, int *len) const;
+    // Total bytes of all segments.
+    size_t getSize(void) const;
+    // Unpin the lines, and it becomes empty.
+    void release(void);
+
+  private:
+    struct Segment
+    {
+        _LogRingChunk *chunk;
+        int len;
+    };
+
+    // Snapshots of small rings need no allocation.
+    SmallList<Segment, 8> segments;
+    size_t totalSize;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    LogRingSnapshot(const LogRingSnapshot &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    LogRingSnapshot &operator=(const LogRingSnapshot &);
+
+    friend class RingBufferLogger;
+};
+
+/*!
+ * @brief StringBufferLogger with a fixed capacity, the oldest lines are overwritten.
+ *
+ * @remarks
+ *   1. Lines are "MM/DD hh:mm:ss.mmm [LEVEL][TID] tag: message\n".
+ *   2. The ring is made of chunks of chunkSize.  When it is full, the oldest chunk (whole lines) is reused, so
+ *      getQueuedString() returns the most recent (capacity - chunkSize) to capacity bytes.  Lines longer than
+ *      chunkSize are cut.
+ *   3. No allocation after the ring is filled, unless chunks are pinned by snapshots.
+ *   4. getQueuedString() and reset() are the same as StringBufferLogger's, takeSnapshot() is zero-copy.
+ *   5. It is also a LogLineSink, lines logged through AsyncLogger keep the original time and thread ID.
+ */
+class RingBufferLogger : public SysLogger, public LogLineSink
+{
+  public:
+    // bufSize will be passed to SysLogger for SysLogger::log(const char *, LogLevel, const char *, va_list).
+    RingBufferLogger(int capacity = 64 * 1024, int chunkSize = RING_LOG_CHUNK_SIZE, int bufSize = 4096);
+
+    /*!
+     * Destructor.
+     */
+    virtual ~RingBufferLogger();
+
+    std::string getQueuedString(void);
+    void reset(void);
+    // The previous content of snapshot is released first.
+    void takeSnapshot(LogRingSnapshot *snapshot);
+    // Bytes of lines dropped for the capacity, since the start.
+    uint64_t getOverwrittenSize(void);
+
+    /* Implementation for LogLineSink */
+    virtual void logLine(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                         const char *logStr);
+
+  protected:
+    /* Implementation for SysLogger */
+    // start() will reset buffer too.
+    virtual int start(void);
+    virtual void log(const char *tag, LogLevel logLevel, const char *logStr);
+
+  private:
+    const int chunkSize;
+    const int maxChunkCount;
+    OsalMutex mutex;
+    // Below are protected by mutex, oldest first.
+    List<_LogRingChunk *> chunks;
+    uint64_t overwrittenSize;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    RingBufferLogger(const RingBufferLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    RingBufferLogger &operator=(const RingBufferLogger &);
+
+    // Called with mutex locked, return the chunk for a line of lineLen.
+    _LogRingChunk *getWritableChunk(int lineLen);
+    void clearChunks(void);
+};
+
+inline LogRingSnapshot::LogRingSnapshot(void) : totalSize(0)
+{
+}
+
+inline LogRingSnapshot::~LogRingSnapshot()
+{
+    release();
+}
+
+inline int LogRingSnapshot::getSegmentCount(void) const
+{
+    return segments.size();
+}
+
+inline const char *LogRingSnapshot::getSegment(int ndx, int *len) const
+{
+    if((ndx < 0) || (ndx >= segments.size()))
+    {
+        *len = 0;
+        return 0;
+    }
+    const Segment &segment = segments.get(ndx);
+    *len = segment.len;
+    return segment.chunk->data;
+}
+
+inline size_t LogRingSnapshot::getSize(void) const
+{
+    return totalSize;
+}
+
+inline void LogRingSnapshot::release(void)
+{
+    for(int i = 0; i < segments.size(); ++i)
+    {
+        segments.get(i).chunk->deref();
+    }
+    segments.clear();
+    totalSize = 0;
+}
+
+inline RingBufferLogger::RingBufferLogger(int capacity, int _chunkSize, int bufSize) :
+    SysLogger(bufSize), chunkSize(_chunkSize),
+    maxChunkCount((capacity / _chunkSize > 2) ? (capacity / _chunkSize) : 2), overwrittenSize(0)
+{
+}
+
+inline RingBufferLogger::~RingBufferLogger()
+{
+    clearChunks();
+}
+
+inline std::string RingBufferLogger::getQueuedString(void)
+{
+    SmartMutexLock lock(mutex);
+    std::string str;
+    for(int i = 0; i < chunks.size(); ++i)
+    {
+        str.append(chunks.get(i)->data, chunks.get(i)->len);
+    }
+    return str;
+}
+
+inline void RingBufferLogger::reset(void)
+{
+    SmartMutexLock lock(mutex);
+    clearChunks();
+}
+
+inline void RingBufferLogger::takeSnapshot(LogRingSnapshot *snapshot)
+{
+    snapshot->release();
+    SmartMutexLock lock(mutex);
+    for(int i = 0; i < chunks.size(); ++i)
+    {
+        _LogRingChunk *chunk = chunks.get(i);
+        if(chunk->len > 0)
+        {
+            LogRingSnapshot::Segment segment = { chunk, chunk->len };
+            chunk->ref();
+            snapshot->segments.addWithoutCheck(segment);
+            snapshot->totalSize += chunk->len;
+        }
+    }
+}
+
+inline uint64_t RingBufferLogger::getOverwrittenSize(void)
+{
+    SmartMutexLock lock(mutex);
+    return overwrittenSize;
+}
+
+inline int RingBufferLogger::start(void)
+{
+    reset();
+    return MIO_GENERAL_OK;
+}
+
+inline void RingBufferLogger::logLine(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                                      const char *logStr)
+{
+    char prefix[256];
+    int prefixLen = formatLogLinePrefix(prefix, sizeof(prefix), timestampMS, logLevel, threadID, tag);
+    int strLen = (int) strlen(logStr);
+    // Cut to a chunk, the newline included.
+    if(prefixLen + strLen + 1 > chunkSize)
+    {
+        if(prefixLen + 1 > chunkSize)
+        {
+            prefixLen = chunkSize - 1;
+        }
+        strLen = chunkSize - 1 - prefixLen;
+    }
+    int lineLen = prefixLen + strLen + 1;
+
+    SmartMutexLock lock(mutex);
+    _LogRingChunk *chunk = getWritableChunk(lineLen);
+    char *ptr = chunk->data + chunk->len;
+    memcpy(ptr, prefix, prefixLen);
+    memcpy(ptr + prefixLen, logStr, strLen);
+    ptr[lineLen - 1] = '\n';
+    chunk->len += lineLen;
+}
+
+inline void RingBufferLogger::log(const char *tag, LogLevel logLevel, const char *logStr)
+{
+    logLine(tag, logLevel, TimeUtil::now(), Thread::getCurrentThreadID(), logStr);
+}
+
+inline _LogRingChunk *RingBufferLogger::getWritableChunk(int lineLen)
+{
+    if(chunks.size() > 0)
+    {
+        _LogRingChunk *last = chunks.get(chunks.size() - 1);
+        if(last->len + lineLen <= last->size)
+        {
+            return last;
+        }
+    }
+    _LogRingChunk *chunk;
+    if(chunks.size() < maxChunkCount)
+    {
+        chunk = new _LogRingChunk(chunkSize);
+    }
+    else
+    {
+        // Drop the oldest lines, reuse the chunk if no snapshot pins it.  Snapshots only add references with
+        // mutex locked, so a count of 1 stays 1 here.
+        chunk = chunks.get(0);
+        chunks.removeByIndex(0);
+        overwrittenSize += chunk->len;
+        if(chunk->getRefCount() == 1)
+        {
+            chunk->len = 0;
+        }
+        else
+        {
+            chunk->deref();
+            chunk = new _LogRingChunk(chunkSize);
+        }
+    }
+    chunks.addWithoutCheck(chunk);
+    return chunk;
+}
+
+inline void RingBufferLogger::clearChunks(void)
+{
+    for(int i = 0; i < chunks.size(); ++i)
+    {
+        chunks.get(i)->deref();
+    }
+    chunks.clear();
+}
+
+#endif//_LOG_RING_BUFFER_LOGGER_H
@@ -101,6 +101,8 @@ class SysLogger
     char *buffer;
 
     friend class LogSystem;
+    // Decorators (AsyncLogger, ...) reach their target loggers through DelegateLogger.
+    friend class DelegateLogger;
 };
 
 #endif//_LOG_SYS_LOGGER_H
@@ -0,0 +1,69 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/TagFilterLogger.h                                                                       *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  SysLogger decorator which applies per-tag levels and filters of LogTagRegistry.             *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_TAG_FILTER_LOGGER_H
+#define _LOG_TAG_FILTER_LOGGER_H
+
+// Standard includes
+#include <stdarg.h>
+// libBase includes
+#include <log/DelegateLogger.h>
+#include <log/LogTagRegistry.h>
+
+/*!
+ * @brief Drop messages which are not loggable by LogTagRegistry, others are forwarded to the target.
+ *
+ * @remarks
+ *   1. This replaces LogSystem::setLogFilter() (linear scan with string compares per message), the check is a
+ *      hash lookup of the tag and one array lookup.
+ *   2. For example, muxer at LOG_DEBUG and others at LOG_INFO:
+ *          LogTagRegistry *registry = LogTagRegistry::getInstance();
+ *          registry->setTagLevel("muxer", LOG_DEBUG);
+ *          registry->bindLogSystem(LogSystem::getSysLogSystem());
+ *          LogSystem::getSysLogSystem()->setLogger(new TagFilterLogger(fileLogger));
+ *   3. Put it in front of AsyncLogger, so dropped messages never reach the ring.
+ */
+class TagFilterLogger : public DelegateLogger
+{
+  public:
+    TagFilterLogger(SysLogger *target) : DelegateLogger(target), registry(LogTagRegistry::getInstance())
+    {
+    }
+
+    /*!
+     * Destructor.
+     */
+    virtual ~TagFilterLogger()
+    {
+    }
+
+  protected:
+    /* Implementation for SysLogger */
+    virtual void log(const char *tag, LogLevel logLevel, const char *formatStr, va_list variableArgList)
+    {
+        if(registry->isLoggable(tag, logLevel))
+        {
+            delegateLog(tag, logLevel, formatStr, variableArgList);
+        }
+    }
+
+  private:
+    LogTagRegistry *const registry;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    TagFilterLogger(const TagFilterLogger &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    TagFilterLogger &operator=(const TagFilterLogger &);
+};
+
+#endif//_LOG_TAG_FILTER_LOGGER_H
@@ -0,0 +1,71 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/logLineFormat.h                                                                         *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Log line prefix used by file based loggers, shared by loggers which format lines by         *
+ *                themselves, and by offline tools.  No dependency to libBase binary.                         *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_LOG_LINE_FORMAT_H
+#define _LOG_LOG_LINE_FORMAT_H
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+// libBase include
+#include <log/logLevel.h>
+
+inline const char *logLevelShortName(LogLevel logLevel)
+{
+    static const char *names[] = { "FATAL", "CRIT", "ERROR", "WARN", "KINFO", "INFO", "DBG" };
+    if((logLevel < LOG_FATAL) || (logLevel > LOG_DEBUG))
+    {
+        return "?";
+    }
+    return names[logLevel];
+}
+
+// 1. Same as FileBasedLogger's lines, "MM/DD hh:mm:ss.mmm [LEVEL][TID] tag: ", TID is in hex.
+// 2. timestampMS is ms after 1970/1/1 (TimeUtil::now()), shown by local time.
+// 3. Return the length written (cut if bufSize is not enough), buf is always null-terminated.
+inline int formatLogLinePrefix(char *buf, int bufSize, int64_t timestampMS, LogLevel logLevel, int threadID,
+                                                                                               const char *tag)
+{
+    time_t seconds = (time_t) (timestampMS / 1000);
+    struct tm tmLocal;
+    localtime_r(&seconds, &tmLocal);
+    int len = snprintf(buf, bufSize, "%02d/%02d %02d:%02d:%02d.%03d [%s][%X] %s: ", tmLocal.tm_mon + 1,
+                       tmLocal.tm_mday, tmLocal.tm_hour, tmLocal.tm_min, tmLocal.tm_sec,
+                       (int) (timestampMS % 1000), logLevelShortName(logLevel), threadID, tag ? tag : "");
+    if(len < 0)
+    {
+        buf[0] = '\0';
+        return 0;
+    }
+    return (len < bufSize) ? len : (bufSize - 1);
+}
+
+/*!
+ * @brief Implemented by SysLoggers which format lines by themselves, for example, RingBufferLogger.  Then
+ *        decorators which log on other threads (AsyncLogger) pass the original time and thread ID of messages.
+ */
+class LogLineSink
+{
+  public:
+    virtual ~LogLineSink()
+    {
+    }
+
+    // logStr is the formatted message w/o newline, timestampMS is TimeUtil::now() when it was logged.
+    virtual void logLine(const char *tag, LogLevel logLevel, int64_t timestampMS, int threadID,
+                         const char *logStr) = 0;
+};
+
+#endif//_LOG_LOG_LINE_FORMAT_H
@@ -0,0 +1,215 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  log/logMacros.h                                                                             *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Log macros for the system-wised LogSystem, levels above LOG_COMPILE_LEVEL are removed at    *
+ *                compile time, and the others check the log level before arguments are evaluated.            *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _LOG_LOG_MACROS_H
+#define _LOG_LOG_MACROS_H
+
+// Standard includes
+#include <stdarg.h>
+#include <stdint.h>
+// libBase includes
+#include <log/logLevel.h>
+#include <log/logSystemBridge.h>
+#include <log/LogSystem.h>
+#include <log/LogRateLimiter.h>
+#include <log/LogTagRegistry.h>
+
+/*
+Usage:
+1. LOG_E(tag, formatStr, ...), LOG_W(), LOG_KI(), LOG_I(), LOG_D() are the same as LogSystem::e(), ::w(), ...
+   but
+   - Arguments are not evaluated, and no call is made, if the level is above the threshold of the LogSystem.
+   - Format strings are checked by compilers.
+2. LOG_L(tag, logLevel, formatStr, ...) is for levels decided at runtime.
+3. tag is either a string or a LogTag, for LogTag, per-tag levels of LogTagRegistry are checked too (one array
+   lookup).  tag is evaluated twice, so it shouldn't have side effects.
+4. LOG_COMPILE_LEVEL is the LogLevel value of the most verbose level which is compiled, for example,
+   -DLOG_COMPILE_LEVEL=5 (LOG_INFO) removes all LOG_D() (format strings are still checked).  Default is 6
+   (LOG_DEBUG).
+5. Per-tag limits of LogRateLimiter are checked after the levels, before arguments are evaluated, and before
+   LogSystem is reached.  It costs one relaxed load if no limit is set.  When a message of a limited tag is
+   accepted again, "N messages suppressed by the rate limit" is logged first.
+6. LOG_E_LIMITED(tag, maxPerSecond, formatStr, ...), LOG_W_LIMITED(), ... limit the call site itself to
+   maxPerSecond in average, with bursts of up to maxPerSecond messages.  LOG_L_LIMITED(tag, logLevel,
+   maxPerSecond, burst, formatStr, ...) is the general form.  Suppressed counts are logged with the file and
+   line of the call site, by the next message emitted from it (not by one which the tag limit rejects).
+*/
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL           6
+#endif
+
+static_assert((LOG_FATAL == 0) && (LOG_DEBUG == 6), "LOG_COMPILE_LEVEL values should follow LogLevel");
+
+#define LOG_L(tag, logLevel, ...)                                                                              \
+    do                                                                                                         \
+    {                                                                                                          \
+        if(((logLevel) <= LOG_COMPILE_LEVEL) && _logIsLoggable(tag, logLevel) &&                               \
+           _logIsAllowed(tag, logLevel))                                                                       \
+        {                                                                                                      \
+            _logEmit(_logTagName(tag), logLevel, __VA_ARGS__);                                                 \
+        }                                                                                                      \
+    } while(0)
+
+#define LOG_L_LIMITED(tag, logLevel, maxPerSecond, burst, ...)                                                 \
+    do                                                                                                         \
+    {                                                                                                          \
+        if(((logLevel) <= LOG_COMPILE_LEVEL) && _logIsLoggable(tag, logLevel))                                 \
+        {                                                                                                      \
+            static LogTokenBucket _logSiteBucket(maxPerSecond, burst);                                         \
+            uint32_t _logSiteSuppressed;                                                                       \
+            if(_logSiteBucket.tryAcquire(&_logSiteSuppressed))                                                 \
+            {                                                                                                  \
+                if(_logIsAllowed(tag, logLevel))                                                               \
+                {                                                                                              \
+                    if(_logSiteSuppressed > 0)                                                                 \
+                    {                                                                                          \
+                        _logEmitSuppressed(_logTagName(tag), logLevel, _logSiteSuppressed,                     \
+                                           __FILE__, __LINE__);                                                \
+                    }                                                                                          \
+                    _logEmit(_logTagName(tag), logLevel, __VA_ARGS__);                                         \
+                }                                                                                              \
+                else                                                                                           \
+                {                                                                                              \
+                    _logSiteBucket.addSuppressed(_logSiteSuppressed);                                          \
+                }                                                                                              \
+            }                                                                                                  \
+        }                                                                                                      \
+    } while(0)
+
+// Compiled to nothing, only for format checks.
+#define _LOG_DISABLED(tag, ...)                                                                                \
+    do                                                                                                         \
+    {                                                                                                          \
+        if(0)                                                                                                  \
+        {                                                                                                      \
+            _logCheckFormat(_logTagName(tag), __VA_ARGS__);                                                    \
+        }                                                                                                      \
+    } while(0)
+
+#define LOG_E(tag, ...)             LOG_L(tag, LOG_ERROR, __VA_ARGS__)
+#define LOG_E_LIMITED(tag, maxPerSecond, ...) \
+    LOG_L_LIMITED(tag, LOG_ERROR, maxPerSecond, maxPerSecond, __VA_ARGS__)
+
+#if LOG_COMPILE_LEVEL >= 3
+#define LOG_W(tag, ...)             LOG_L(tag, LOG_WARNING, __VA_ARGS__)
+#define LOG_W_LIMITED(tag, maxPerSecond, ...) \
+    LOG_L_LIMITED(tag, LOG_WARNING, maxPerSecond, maxPerSecond, __VA_ARGS__)
+#else
+#define LOG_W(tag, ...)             _LOG_DISABLED(tag, __VA_ARGS__)
+#define LOG_W_LIMITED(tag, maxPerSecond, ...) _LOG_DISABLED(tag, __VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL >= 4
+#define LOG_KI(tag, ...)            LOG_L(tag, LOG_KEY_INFO, __VA_ARGS__)
+#define LOG_KI_LIMITED(tag, maxPerSecond, ...) \
+    LOG_L_LIMITED(tag, LOG_KEY_INFO, maxPerSecond, maxPerSecond, __VA_ARGS__)
+#else
+#define LOG_KI(tag, ...)            _LOG_DISABLED(tag, __VA_ARGS__)
+#define LOG_KI_LIMITED(tag, maxPerSecond, ...) _LOG_DISABLED(tag, __VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL >= 5
+#define LOG_I(tag, ...)             LOG_L(tag, LOG_INFO, __VA_ARGS__)
+#define LOG_I_LIMITED(tag, maxPerSecond, ...) \
+    LOG_L_LIMITED(tag, LOG_INFO, maxPerSecond, maxPerSecond, __VA_ARGS__)
+#else
+#define LOG_I(tag, ...)             _LOG_DISABLED(tag, __VA_ARGS__)
+#define LOG_I_LIMITED(tag, maxPerSecond, ...) _LOG_DISABLED(tag, __VA_ARGS__)
+#endif
+
+#if LOG_COMPILE_LEVEL >= 6
+#define LOG_D(tag, ...)             LOG_L(tag, LOG_DEBUG, __VA_ARGS__)
+#define LOG_D_LIMITED(tag, maxPerSecond, ...) \
+    LOG_L_LIMITED(tag, LOG_DEBUG, maxPerSecond, maxPerSecond, __VA_ARGS__)
+#else
+#define LOG_D(tag, ...)             _LOG_DISABLED(tag, __VA_ARGS__)
+#define LOG_D_LIMITED(tag, maxPerSecond, ...) _LOG_DISABLED(tag, __VA_ARGS__)
+#endif
+
+/* Implementation details, used by the macros above */
+
+inline LogSystem *_logSysLogSystem(void)
+{
+    static LogSystem *const logSystem = LogSystem::getSysLogSystem();
+    return logSystem;
+}
+
+inline bool _logIsLoggable(const char *, LogLevel logLevel)
+{
+    return logLevel <= _logSysLogSystem()->getLogLevel();
+}
+
+inline bool _logIsLoggable(const LogTag &tag, LogLevel logLevel)
+{
+    return (logLevel <= _logSysLogSystem()->getLogLevel()) && tag.isLoggable(logLevel);
+}
+
+inline bool _logIsAllowed(const char *tag, LogLevel logLevel)
+{
+    uint32_t suppressed;
+    if(!LogRateLimiter::getInstance()->tryAcquire(tag, &suppressed))
+    {
+        return false;
+    }
+    if(suppressed > 0)
+    {
+        LogSystem::l(tag, logLevel, "%u messages suppressed by the rate limit", suppressed);
+    }
+    return true;
+}
+
+inline bool _logIsAllowed(const LogTag &tag, LogLevel logLevel)
+{
+    uint32_t suppressed;
+    if(!LogRateLimiter::getInstance()->tryAcquire(tag.getID(), &suppressed))
+    {
+        return false;
+    }
+    if(suppressed > 0)
+    {
+        LogSystem::l(tag.getName(), logLevel, "%u messages suppressed by the rate limit", suppressed);
+    }
+    return true;
+}
+
+inline const char *_logTagName(const char *tag)
+{
+    return tag;
+}
+
+inline const char *_logTagName(const LogTag &tag)
+{
+    return tag.getName();
+}
+
+inline void _logEmit(const char *tag, LogLevel logLevel, const char *formatStr, ...) _LOG_PRINTF_FORMAT(3, 4);
+inline void _logEmit(const char *tag, LogLevel logLevel, const char *formatStr, ...)
+{
+    va_list variableArgList;
+    va_start(variableArgList, formatStr);
+    LogSystem::l(tag, logLevel, formatStr, variableArgList);
+    va_end(variableArgList);
+}
+
+inline void _logEmitSuppressed(const char *tag, LogLevel logLevel, uint32_t suppressed, const char *file, int line)
+{
+    LogSystem::l(tag, logLevel, "%u messages suppressed by the rate limit of %s:%d", suppressed, file, line);
+}
+
+inline void _logCheckFormat(const char *tag, const char *formatStr, ...) _LOG_PRINTF_FORMAT(2, 3);
+inline void _logCheckFormat(const char *, const char *, ...)
+{
+}
+
+#endif//_LOG_LOG_MACROS_H
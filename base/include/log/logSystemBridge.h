@@ -17,20 +17,28 @@
 // liBase include
 #include <log/logLevel.h>
 
+// Let compilers check arguments against the printf() styled format string.
+#ifdef __GNUC__
+#define _LOG_PRINTF_FORMAT(formatNdx, firstArgNdx) __attribute__((format(printf, formatNdx, firstArgNdx)))
+#else
+#define _LOG_PRINTF_FORMAT(formatNdx, firstArgNdx)
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
-void logSystem_l(const char *tag, enum LogLevel logLevel, const char *formatStr, ...);
-void logSystem_e(const char *tag, const char *formatStr, ...);
-void logSystem_w(const char *tag, const char *formatStr, ...);
-void logSystem_ki(const char *tag, const char *formatStr, ...);
-void logSystem_i(const char *tag, const char *formatStr, ...);
-void logSystem_d(const char *tag, const char *formatStr, ...);
+void logSystem_l(const char *tag, enum LogLevel logLevel, const char *formatStr, ...) _LOG_PRINTF_FORMAT(3, 4);
+void logSystem_e(const char *tag, const char *formatStr, ...) _LOG_PRINTF_FORMAT(2, 3);
+void logSystem_w(const char *tag, const char *formatStr, ...) _LOG_PRINTF_FORMAT(2, 3);
+void logSystem_ki(const char *tag, const char *formatStr, ...) _LOG_PRINTF_FORMAT(2, 3);
+void logSystem_i(const char *tag, const char *formatStr, ...) _LOG_PRINTF_FORMAT(2, 3);
+void logSystem_d(const char *tag, const char *formatStr, ...) _LOG_PRINTF_FORMAT(2, 3);
 
 // Wrapper to log to specified LogSystem object.
-void altLogSystem_l(void *logSystem, const char *tag, enum LogLevel logLevel, const char *formatStr, ...);
+void altLogSystem_l(void *logSystem, const char *tag, enum LogLevel logLevel, const char *formatStr, ...)
+                                                                                         _LOG_PRINTF_FORMAT(4, 5);
 
 #ifdef __cplusplus
 }
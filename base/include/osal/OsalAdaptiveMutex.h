@@ -0,0 +1,469 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  osal/OsalAdaptiveMutex.h                                                                    *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. Futex mutex which spins briefly before it sleeps, w/ an optional priority-inheritance    *
+ *                   mode.                                                                                    *
+ *                2. Contention counters of locks, and the registry of named locks to report hot ones.       *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _OSAL_OSAL_ADAPTIVE_MUTEX_H
+#define _OSAL_OSAL_ADAPTIVE_MUTEX_H
+
+// Standard includes
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+// POSIX includes
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// libBase includes
+#include <container/List.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+
+// Spins of a contended lock() are adapted per mutex, up to the count and the time.
+#define OSAL_ADAPTIVE_MUTEX_MAX_SPINS       100
+#define OSAL_ADAPTIVE_MUTEX_MAX_SPIN_NS     20000
+#define OSAL_LOCK_NAME_MAX_LEN              31
+
+struct OsalLockStats
+{
+    char name[OSAL_LOCK_NAME_MAX_LEN + 1];
+    // Lock calls which didn't get it at once.
+    uint64_t contendedCount;
+    // Contended ones which got it by spinning, w/o sleeping.
+    uint64_t spinAcquiredCount;
+    // Contended ones which slept on the futex.
+    uint64_t sleepCount;
+    // Time of contended ones, from the call to the acquisition.
+    uint64_t totalWaitNS;
+    uint64_t maxWaitNS;
+};
+
+// Registry link of named locks.
+struct _OsalLockLink
+{
+    _OsalLockLink *prev;
+    _OsalLockLink *next;
+};
+
+// Contention counters, updated only by contended lock calls, so uncontended ones cost nothing more.
+class _OsalLockCounters : private _OsalLockLink
+{
+  public:
+    void getStats(OsalLockStats *stats);
+    void resetStats(void);
+
+  protected:
+    // name must be a static string, 0 to keep it out of OsalLockRegistry.
+    _OsalLockCounters(const char *name);
+    ~_OsalLockCounters();
+
+    void recordContention(bool hasSlept, uint64_t waitNS);
+    static uint64_t nowNS(void);
+
+  private:
+    const char *const name;
+    std::atomic<uint64_t> contendedCount;
+    std::atomic<uint64_t> sleepCount;
+    std::atomic<uint64_t> totalWaitNS;
+    std::atomic<uint64_t> maxWaitNS;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    _OsalLockCounters(const _OsalLockCounters &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    _OsalLockCounters &operator=(const _OsalLockCounters &);
+
+    friend class OsalLockRegistry;
+};
+
+/*!
+ * @brief Named OsalAdaptiveMutex and OsalRwLock objects, to find out which locks are hot.
+ *
+ * @remarks
+ *   1. Locks register themselves in constructors, and unregister in destructors.
+ *   2. For example, log the hottest ones periodically:
+ *          List<OsalLockStats> stats;
+ *          OsalLockRegistry::snapshot(stats);
+ */
+class OsalLockRegistry
+{
+  public:
+    // 1. Sorted by totalWaitNS, the hottest first.
+    // 2. Return the number of locks added to statsHolder.
+    static int snapshot(List<OsalLockStats> &statsHolder);
+    static void resetAll(void);
+
+  private:
+    OsalMutex mutex;
+    // Below are protected by mutex.
+    _OsalLockLink locks;
+
+    OsalLockRegistry(void);
+    static OsalLockRegistry *getInstance(void);
+    void add(_OsalLockCounters *counters);
+    void remove(_OsalLockCounters *counters);
+
+    friend class _OsalLockCounters;
+};
+
+/*!
+ * @brief Mutex on futex, which spins briefly before it sleeps, for short critical sections.
+ *
+ * @remarks
+ *   1. An uncontended lock()/unlock() is one atomic operation each, w/o any system call.
+ *   2. A contended lock() spins first, ARM cores wait in wfe until the lock word is written, other cores pause.
+ *      The spin count adapts to how long the mutex is usually held, and it is bounded by
+ *      OSAL_ADAPTIVE_MUTEX_MAX_SPINS and OSAL_ADAPTIVE_MUTEX_MAX_SPIN_NS.  Then it sleeps on the futex.
+ *   3. With isPriorityInheritance, it is a PI futex (FUTEX_LOCK_PI), a realtime thread waiting for it boosts
+ *      the owner, for realtime camera threads sharing locks with normal ones.
+ *   4. Not recursive, and it cannot be used with OsalCondVar, which needs OsalMutex.
+ */
+class OsalAdaptiveMutex : public _OsalLockCounters
+{
+  public:
+    // name must be a static string, it registers the mutex to OsalLockRegistry, 0 for an anonymous one.
+    OsalAdaptiveMutex(const char *name = 0, bool isPriorityInheritance = false);
+
+    /*!
+     * Destructor.
+     */
+    ~OsalAdaptiveMutex();
+
+    void lock(void);
+    bool tryLock(void);
+    void unlock(void);
+    bool isPriorityInheritance(void) const;
+
+  private:
+    // 0 unlocked, 1 locked, 2 locked and maybe waited.  Owner TID | FUTEX_WAITERS for PI.
+    std::atomic<int> word;
+    // Average spins which got the lock, of contended lock().
+    std::atomic<int> spinLimit;
+    const bool priorityInheritance;
+
+    void lockSlow(void);
+    // Return true if it is locked by spinning.
+    bool spin(int lockedValue);
+    static int currentTID(void);
+};
+
+// Wait a little for the 32-bit word to change from value, w/o locking the bus.
+static inline void _osalSpinWait(const void *word, int value)
+{
+#if defined(__aarch64__)
+    // The local event is cleared first, so wfe returns when the word is written (or by the event stream).
+    int observed;
+    __asm__ __volatile__("sevl\n\t"
+                         "wfe\n\t"
+                         "ldxr %w0, [%1]\n\t"
+                         "cmp %w0, %w2\n\t"
+                         "b.ne 1f\n\t"
+                         "wfe\n"
+                         "1:"
+                         : "=&r"(observed) : "r"(word), "r"(value) : "cc", "memory");
+#elif defined(__arm__)
+    (void) word;
+    (void) value;
+    __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+    (void) word;
+    (void) value;
+    __builtin_ia32_pause();
+#else
+    (void) word;
+    (void) value;
+    __asm__ __volatile__("" ::: "memory");
+#endif
+}
+
+// Spinning is useless on one core, the owner cannot run meanwhile.
+static inline bool _osalIsUniprocessor(void)
+{
+    static const bool isUniprocessor = (sysconf(_SC_NPROCESSORS_ONLN) <= 1);
+    return isUniprocessor;
+}
+
+/* Implementation for _OsalLockCounters */
+
+inline _OsalLockCounters::_OsalLockCounters(const char *_name) :
+    name(_name), contendedCount(0), sleepCount(0), totalWaitNS(0), maxWaitNS(0)
+{
+    prev = next = this;
+    if(name)
+    {
+        OsalLockRegistry::getInstance()->add(this);
+    }
+}
+
+inline _OsalLockCounters::~_OsalLockCounters()
+{
+    if(name)
+    {
+        OsalLockRegistry::getInstance()->remove(this);
+    }
+}
+
+inline void _OsalLockCounters::getStats(OsalLockStats *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    if(name)
+    {
+        strncpy(stats->name, name, OSAL_LOCK_NAME_MAX_LEN);
+    }
+    stats->contendedCount = contendedCount.load(std::memory_order_relaxed);
+    stats->sleepCount = sleepCount.load(std::memory_order_relaxed);
+    stats->spinAcquiredCount = stats->contendedCount - stats->sleepCount;
+    stats->totalWaitNS = totalWaitNS.load(std::memory_order_relaxed);
+    stats->maxWaitNS = maxWaitNS.load(std::memory_order_relaxed);
+}
+
+inline void _OsalLockCounters::resetStats(void)
+{
+    contendedCount.store(0, std::memory_order_relaxed);
+    sleepCount.store(0, std::memory_order_relaxed);
+    totalWaitNS.store(0, std::memory_order_relaxed);
+    maxWaitNS.store(0, std::memory_order_relaxed);
+}
+
+inline void _OsalLockCounters::recordContention(bool hasSlept, uint64_t waitNS)
+{
+    contendedCount.fetch_add(1, std::memory_order_relaxed);
+    if(hasSlept)
+    {
+        sleepCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    totalWaitNS.fetch_add(waitNS, std::memory_order_relaxed);
+    uint64_t maxNS = maxWaitNS.load(std::memory_order_relaxed);
+    while((waitNS > maxNS) && !maxWaitNS.compare_exchange_weak(maxNS, waitNS, std::memory_order_relaxed))
+    {
+    }
+}
+
+inline uint64_t _OsalLockCounters::nowNS(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+/* Implementation for OsalLockRegistry */
+
+inline OsalLockRegistry::OsalLockRegistry(void)
+{
+    locks.prev = locks.next = &locks;
+}
+
+inline OsalLockRegistry *OsalLockRegistry::getInstance(void)
+{
+    // Never deleted, static locks may unregister at exit.
+    static OsalLockRegistry *registry = new OsalLockRegistry();
+    return registry;
+}
+
+inline void OsalLockRegistry::add(_OsalLockCounters *counters)
+{
+    SmartMutexLock lock(mutex);
+    counters->prev = locks.prev;
+    counters->next = &locks;
+    locks.prev->next = counters;
+    locks.prev = counters;
+}
+
+inline void OsalLockRegistry::remove(_OsalLockCounters *counters)
+{
+    SmartMutexLock lock(mutex);
+    counters->prev->next = counters->next;
+    counters->next->prev = counters->prev;
+    counters->prev = counters->next = counters;
+}
+
+inline int OsalLockRegistry::snapshot(List<OsalLockStats> &statsHolder)
+{
+    OsalLockRegistry *registry = getInstance();
+    SmartMutexLock lock(registry->mutex);
+    int count = 0;
+    for(_OsalLockLink *link = registry->locks.next; link != &registry->locks; link = link->next)
+    {
+        OsalLockStats stats;
+        ((_OsalLockCounters *) link)->getStats(&stats);
+        // Few locks are named, insertion keeps it simple.
+        int first = statsHolder.size() - count;
+        int pos = first;
+        while((pos < statsHolder.size()) && (statsHolder.get(pos).totalWaitNS >= stats.totalWaitNS))
+        {
+            ++pos;
+        }
+        statsHolder.addWithoutCheck(pos, stats);
+        ++count;
+    }
+    return count;
+}
+
+inline void OsalLockRegistry::resetAll(void)
+{
+    OsalLockRegistry *registry = getInstance();
+    SmartMutexLock lock(registry->mutex);
+    for(_OsalLockLink *link = registry->locks.next; link != &registry->locks; link = link->next)
+    {
+        ((_OsalLockCounters *) link)->resetStats();
+    }
+}
+
+/* Implementation for OsalAdaptiveMutex */
+
+inline OsalAdaptiveMutex::OsalAdaptiveMutex(const char *name, bool isPriorityInheritance) :
+    _OsalLockCounters(name), word(0), spinLimit(OSAL_ADAPTIVE_MUTEX_MAX_SPINS / 10),
+    priorityInheritance(isPriorityInheritance)
+{
+}
+
+inline OsalAdaptiveMutex::~OsalAdaptiveMutex()
+{
+}
+
+inline void OsalAdaptiveMutex::lock(void)
+{
+    int expected = 0;
+    if(!word.compare_exchange_strong(expected, priorityInheritance ? currentTID() : 1, std::memory_order_acquire,
+                                     std::memory_order_relaxed))
+    {
+        lockSlow();
+    }
+}
+
+inline bool OsalAdaptiveMutex::tryLock(void)
+{
+    int expected = 0;
+    return word.compare_exchange_strong(expected, priorityInheritance ? currentTID() : 1,
+                                        std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline void OsalAdaptiveMutex::unlock(void)
+{
+    if(priorityInheritance)
+    {
+        // The kernel hands it to the top waiter if FUTEX_WAITERS is set.
+        int expected = currentTID();
+        if(!word.compare_exchange_strong(expected, 0, std::memory_order_release, std::memory_order_relaxed))
+        {
+            // The kernel writes the word of the next owner, release it here for the acquire in lockSlow().
+            word.fetch_or(0, std::memory_order_release);
+            syscall(SYS_futex, (int *) &word, FUTEX_UNLOCK_PI_PRIVATE, 0, 0, 0, 0);
+        }
+        return;
+    }
+    if(word.exchange(0, std::memory_order_release) == 2)
+    {
+        syscall(SYS_futex, (int *) &word, FUTEX_WAKE_PRIVATE, 1, 0, 0, 0);
+    }
+}
+
+inline bool OsalAdaptiveMutex::isPriorityInheritance(void) const
+{
+    return priorityInheritance;
+}
+
+inline void OsalAdaptiveMutex::lockSlow(void)
+{
+    uint64_t beginNS = nowNS();
+    bool hasSlept = false;
+    int lockedValue = priorityInheritance ? currentTID() : 1;
+    if(!spin(lockedValue))
+    {
+        hasSlept = true;
+        if(priorityInheritance)
+        {
+            // The kernel sets the owner and FUTEX_WAITERS, and boosts the owner by the waiters' priorities.
+            while(syscall(SYS_futex, (int *) &word, FUTEX_LOCK_PI_PRIVATE, 0, 0, 0, 0) != 0)
+            {
+                if((errno != EINTR) && (errno != EAGAIN))
+                {
+                    // No PI futex in the kernel, fall back to yielding.
+                    int expected = 0;
+                    while(!word.compare_exchange_weak(expected, lockedValue, std::memory_order_acquire,
+                                                      std::memory_order_relaxed))
+                    {
+                        expected = 0;
+                        sched_yield();
+                    }
+                    break;
+                }
+            }
+            word.load(std::memory_order_acquire);
+        }
+        else
+        {
+            // 2 tells unlock() to wake up a waiter, it may be spurious once the last waiter is gone.
+            while(word.exchange(2, std::memory_order_acquire) != 0)
+            {
+                syscall(SYS_futex, (int *) &word, FUTEX_WAIT_PRIVATE, 2, 0, 0, 0);
+            }
+        }
+    }
+    recordContention(hasSlept, nowNS() - beginNS);
+}
+
+inline bool OsalAdaptiveMutex::spin(int lockedValue)
+{
+    if(_osalIsUniprocessor())
+    {
+        return false;
+    }
+    int limit = spinLimit.load(std::memory_order_relaxed);
+    int maxSpins = limit * 2 + 10;
+    if(maxSpins > OSAL_ADAPTIVE_MUTEX_MAX_SPINS)
+    {
+        maxSpins = OSAL_ADAPTIVE_MUTEX_MAX_SPINS;
+    }
+    uint64_t deadlineNS = nowNS() + OSAL_ADAPTIVE_MUTEX_MAX_SPIN_NS;
+    int spins = 0;
+    bool isLocked = false;
+    while(spins < maxSpins)
+    {
+        ++spins;
+        int value = word.load(std::memory_order_relaxed);
+        if(value == 0)
+        {
+            if(word.compare_exchange_weak(value, lockedValue, std::memory_order_acquire,
+                                          std::memory_order_relaxed))
+            {
+                isLocked = true;
+                break;
+            }
+            continue;
+        }
+        // A wfe may take up to the event stream period (about 100us), so check the deadline after each one.
+        _osalSpinWait(&word, value);
+        if(nowNS() > deadlineNS)
+        {
+            break;
+        }
+    }
+    // Moving average, as glibc adaptive mutexes do.
+    spinLimit.store(limit + (spins - limit) / 8, std::memory_order_relaxed);
+    return isLocked;
+}
+
+inline int OsalAdaptiveMutex::currentTID(void)
+{
+    static __thread int tid = 0;
+    if(tid == 0)
+    {
+        tid = (int) syscall(SYS_gettid);
+    }
+    return tid;
+}
+
+#endif //_OSAL_OSAL_ADAPTIVE_MUTEX_H
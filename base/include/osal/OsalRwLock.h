@@ -0,0 +1,288 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  osal/OsalRwLock.h                                                                           *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Writer-preferring reader-writer lock on futex, for read-mostly structures, e.g. registries   *
+ *                and configurations.                                                                         *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _OSAL_OSAL_RW_LOCK_H
+#define _OSAL_OSAL_RW_LOCK_H
+
+// Standard includes
+#include <stdint.h>
+#include <atomic>
+// POSIX includes
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// libBase includes
+#include <osal/OsalAdaptiveMutex.h>
+
+// Futex event count, waiters sleep until the epoch changes, wakers skip the system call if nobody waits.
+class _OsalFutexEvent
+{
+  public:
+    _OsalFutexEvent(void);
+
+    // Register as a waiter, then check the condition, then wait(), or cancelWait() if it is true already.
+    int prepareWait(void);
+    void cancelWait(void);
+    void wait(int key);
+    void notifyOne(void);
+    void notifyAll(void);
+
+  private:
+    std::atomic<int> epoch;
+    std::atomic<int> waiterCount;
+
+    void notify(int count);
+};
+
+/*!
+ * @brief Reader-writer lock, any number of readers, or one writer.
+ *
+ * @remarks
+ *   1. An uncontended lockShared()/unlockShared() is one atomic operation each, readers don't wait for each
+ *      other, so lookups of a read-mostly structure don't serialize like OsalMutex does.
+ *   2. A waiting writer blocks new readers, so writers don't starve under steady reads.
+ *   3. Not recursive, a reader which takes it again may deadlock with a waiting writer.
+ *   4. Contention counters and OsalLockRegistry are the same as OsalAdaptiveMutex.
+ */
+class OsalRwLock : public _OsalLockCounters
+{
+  public:
+    // name must be a static string, it registers the lock to OsalLockRegistry, 0 for an anonymous one.
+    OsalRwLock(const char *name = 0);
+
+    /*!
+     * Destructor.
+     */
+    ~OsalRwLock();
+
+    void lockShared(void);
+    bool tryLockShared(void);
+    void unlockShared(void);
+    void lock(void);
+    bool tryLock(void);
+    void unlock(void);
+
+  private:
+    enum
+    {
+        WRITER = 0x40000000
+    };
+
+    // Count of readers, or WRITER.
+    std::atomic<int> state;
+    std::atomic<int> waitingWriters;
+    // Readers wait for no writer, writers wait for no reader and no writer.
+    _OsalFutexEvent readable;
+    _OsalFutexEvent writable;
+
+    void lockSharedSlow(void);
+    void lockSlow(void);
+    static int maxSpins(void);
+};
+
+/* Implementation for _OsalFutexEvent */
+
+inline _OsalFutexEvent::_OsalFutexEvent(void) : epoch(0), waiterCount(0)
+{
+}
+
+inline int _OsalFutexEvent::prepareWait(void)
+{
+    waiterCount.fetch_add(1, std::memory_order_relaxed);
+    // Pairs w/ the fence in notify(), either the waker sees the waiter, or the waiter sees the new condition.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return epoch.load(std::memory_order_acquire);
+}
+
+inline void _OsalFutexEvent::cancelWait(void)
+{
+    waiterCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void _OsalFutexEvent::wait(int key)
+{
+    syscall(SYS_futex, (int *) &epoch, FUTEX_WAIT_PRIVATE, key, 0, 0, 0);
+    waiterCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void _OsalFutexEvent::notifyOne(void)
+{
+    notify(1);
+}
+
+inline void _OsalFutexEvent::notifyAll(void)
+{
+    notify(0x7fffffff);
+}
+
+inline void _OsalFutexEvent::notify(int count)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(waiterCount.load(std::memory_order_relaxed) > 0)
+    {
+        epoch.fetch_add(1, std::memory_order_release);
+        syscall(SYS_futex, (int *) &epoch, FUTEX_WAKE_PRIVATE, count, 0, 0, 0);
+    }
+}
+
+/* Implementation for OsalRwLock */
+
+inline OsalRwLock::OsalRwLock(const char *name) : _OsalLockCounters(name), state(0), waitingWriters(0)
+{
+}
+
+inline OsalRwLock::~OsalRwLock()
+{
+}
+
+inline void OsalRwLock::lockShared(void)
+{
+    if(!tryLockShared())
+    {
+        lockSharedSlow();
+    }
+}
+
+inline bool OsalRwLock::tryLockShared(void)
+{
+    int value = state.load(std::memory_order_relaxed);
+    while(!(value & WRITER) && (waitingWriters.load(std::memory_order_relaxed) == 0))
+    {
+        if(state.compare_exchange_weak(value, value + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void OsalRwLock::unlockShared(void)
+{
+    if(state.fetch_sub(1, std::memory_order_release) == 1)
+    {
+        // Pairs w/ the fence in prepareWait() of a writer, which counts itself in waitingWriters before.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(waitingWriters.load(std::memory_order_relaxed) > 0)
+        {
+            writable.notifyOne();
+        }
+    }
+}
+
+inline void OsalRwLock::lock(void)
+{
+    if(!tryLock())
+    {
+        lockSlow();
+    }
+}
+
+inline bool OsalRwLock::tryLock(void)
+{
+    int expected = 0;
+    return state.compare_exchange_strong(expected, WRITER, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline void OsalRwLock::unlock(void)
+{
+    state.store(0, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(waitingWriters.load(std::memory_order_relaxed) > 0)
+    {
+        writable.notifyOne();
+    }
+    else
+    {
+        readable.notifyAll();
+    }
+}
+
+inline int OsalRwLock::maxSpins(void)
+{
+    // Readers may hold it for long, spin less than OsalAdaptiveMutex.  The spin time is bounded by
+    // OSAL_ADAPTIVE_MUTEX_MAX_SPIN_NS as well.
+    return _osalIsUniprocessor() ? 0 : (OSAL_ADAPTIVE_MUTEX_MAX_SPINS / 4);
+}
+
+inline void OsalRwLock::lockSharedSlow(void)
+{
+    uint64_t beginNS = nowNS();
+    uint64_t deadlineNS = beginNS + OSAL_ADAPTIVE_MUTEX_MAX_SPIN_NS;
+    bool hasSlept = false;
+    for(int spins = maxSpins(); spins > 0; --spins)
+    {
+        _osalSpinWait(&state, state.load(std::memory_order_relaxed));
+        if(tryLockShared())
+        {
+            recordContention(false, nowNS() - beginNS);
+            return;
+        }
+        if(nowNS() > deadlineNS)
+        {
+            break;
+        }
+    }
+    while(true)
+    {
+        int key = readable.prepareWait();
+        if(tryLockShared())
+        {
+            readable.cancelWait();
+            break;
+        }
+        hasSlept = true;
+        readable.wait(key);
+    }
+    recordContention(hasSlept, nowNS() - beginNS);
+}
+
+inline void OsalRwLock::lockSlow(void)
+{
+    uint64_t beginNS = nowNS();
+    bool hasSlept = false;
+    // New readers hold off from now on.
+    waitingWriters.fetch_add(1, std::memory_order_relaxed);
+    uint64_t deadlineNS = beginNS + OSAL_ADAPTIVE_MUTEX_MAX_SPIN_NS;
+    bool isLocked = false;
+    for(int spins = maxSpins(); spins > 0; --spins)
+    {
+        _osalSpinWait(&state, state.load(std::memory_order_relaxed));
+        if(tryLock())
+        {
+            isLocked = true;
+            break;
+        }
+        if(nowNS() > deadlineNS)
+        {
+            break;
+        }
+    }
+    while(!isLocked)
+    {
+        int key = writable.prepareWait();
+        if(tryLock())
+        {
+            writable.cancelWait();
+            break;
+        }
+        hasSlept = true;
+        writable.wait(key);
+        isLocked = tryLock();
+    }
+    // Readers blocked by this writer wait for its unlock(), which wakes them if no other writer is waiting.
+    waitingWriters.fetch_sub(1, std::memory_order_relaxed);
+    recordContention(hasSlept, nowNS() - beginNS);
+}
+
+#endif //_OSAL_OSAL_RW_LOCK_H
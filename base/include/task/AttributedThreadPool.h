@@ -0,0 +1,232 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/AttributedThreadPool.h                                                                 *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  ThreadPool whose pooled threads run with the pool default ThreadAttributes.                 *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_ATTRIBUTED_THREAD_POOL_H
+#define _TASK_ATTRIBUTED_THREAD_POOL_H
+
+// Standard includes
+#include <stdint.h>
+#include <atomic>
+// libBase includes
+#include <baseResultCode.h>
+#include <container/List.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+#include <task/Runnable.h>
+#include <task/TaskInstrumentation.h>
+#include <task/ThreadAttributes.h>
+#include <task/ThreadPool.h>
+
+class AttributedThreadPool;
+
+// Applies the pool default before the real work item, once per pooled thread and attributes change.
+class _AttributedWorkItem : public Runnable
+{
+  public:
+    _AttributedWorkItem(AttributedThreadPool *_pool, Ref<Runnable> &&_workItem, int (*_taskEntry)(void *),
+                        void *_context) :
+        pool(_pool), workItem(std::move(_workItem)), taskEntry(_taskEntry), context(_context)
+    {
+    }
+
+    virtual int run(void);
+
+  protected:
+    virtual ~_AttributedWorkItem()
+    {
+    }
+
+  private:
+    AttributedThreadPool *const pool;
+    const Ref<Runnable> workItem;
+    int (*const taskEntry)(void *);
+    void *const context;
+};
+
+/*!
+ * @brief ThreadPool with default ThreadAttributes for its pooled threads.
+ *
+ * @remarks
+ *   1. The interface is the same as ThreadPool, plus attributes.  For example, housekeeping on little cores:
+ *          ThreadAttributes attributes;
+ *          attributes.setAffinity(0x0F).setNice(10).setName("housekeeping");
+ *          AttributedThreadPool pool(2, attributes);
+ *   2. A pooled thread applies the attributes before its first work item, and again after setAttributes(), so
+ *      the cost is a thread-local check per work item.
+ *   3. Threads are created by ThreadPool, they are known by the pool once they run work items, queryPlacements()
+ *      reports them.
+ */
+class AttributedThreadPool
+{
+  public:
+    AttributedThreadPool(int maxPooledThreads, const ThreadAttributes &attributes,
+                         bool allowExtraThreads = false);
+    // All pooled thread will be deref().
+    ~AttributedThreadPool();
+
+    int maxRunningWorkItems(void);
+    int maxQueuedWorkItems(void);
+    int executeTaskItem(int (*taskEntry)(void *), void *context);
+    // workItem is ref(), and deref() when end.
+    int executeTaskItem(Runnable *workItem);
+    // Same as above, and the reference of workItem is moved in, even on failure.
+    int executeTaskItem(Ref<Runnable> &&workItem);
+
+    // Applied to pooled threads before their next work items.
+    void setAttributes(const ThreadAttributes &attributes);
+    ThreadAttributes getAttributes(void);
+    // Result of the latest application, MIO_GENERAL_OK before any.
+    int getApplyResult(void);
+    // Placements of pooled threads which have run work items, exited ones are dropped.
+    int queryPlacements(List<ThreadPlacement> &placementsHolder);
+
+  private:
+    ThreadPool pool;
+    OsalMutex mutex;
+    // Below are protected by mutex.
+    ThreadAttributes attributes;
+    int applyResult;
+    List<int> threadIDs;
+    std::atomic<uint32_t> generation;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    AttributedThreadPool(const AttributedThreadPool &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    AttributedThreadPool &operator=(const AttributedThreadPool &);
+
+    // The reference of workItem is moved in.
+    int submit(Ref<Runnable> &&workItem, int (*taskEntry)(void *), void *context);
+    // On pooled threads.
+    void applyIfChanged(void);
+
+    friend class _AttributedWorkItem;
+};
+
+inline int _AttributedWorkItem::run(void)
+{
+    pool->applyIfChanged();
+    return workItem ? workItem->run() : taskEntry(context);
+}
+
+inline AttributedThreadPool::AttributedThreadPool(int maxPooledThreads, const ThreadAttributes &_attributes,
+                                                  bool allowExtraThreads) :
+    pool(maxPooledThreads, allowExtraThreads), attributes(_attributes), applyResult(MIO_GENERAL_OK), generation(1)
+{
+}
+
+inline AttributedThreadPool::~AttributedThreadPool()
+{
+}
+
+inline int AttributedThreadPool::maxRunningWorkItems(void)
+{
+    return pool.maxRunningWorkItems();
+}
+
+inline int AttributedThreadPool::maxQueuedWorkItems(void)
+{
+    return pool.maxQueuedWorkItems();
+}
+
+inline int AttributedThreadPool::executeTaskItem(int (*taskEntry)(void *), void *context)
+{
+    if(!TaskInstrumentation::isEnabled())
+    {
+        return submit(Ref<Runnable>(), taskEntry, context);
+    }
+    return submit(adoptRef(TaskInstrumentation::wrap(taskEntry, context)), 0, 0);
+}
+
+inline int AttributedThreadPool::executeTaskItem(Runnable *workItem)
+{
+    if(!TaskInstrumentation::isEnabled())
+    {
+        return submit(Ref<Runnable>::retain(workItem), 0, 0);
+    }
+    return submit(adoptRef(TaskInstrumentation::wrap(workItem)), 0, 0);
+}
+
+inline int AttributedThreadPool::executeTaskItem(Ref<Runnable> &&workItem)
+{
+    if(!TaskInstrumentation::isEnabled())
+    {
+        return submit(std::move(workItem), 0, 0);
+    }
+    Ref<Runnable> item(std::move(workItem));
+    return submit(adoptRef(TaskInstrumentation::wrap(item.get())), 0, 0);
+}
+
+inline void AttributedThreadPool::setAttributes(const ThreadAttributes &_attributes)
+{
+    SmartMutexLock lock(mutex);
+    attributes = _attributes;
+    generation.fetch_add(1);
+}
+
+inline ThreadAttributes AttributedThreadPool::getAttributes(void)
+{
+    SmartMutexLock lock(mutex);
+    return attributes;
+}
+
+inline int AttributedThreadPool::getApplyResult(void)
+{
+    SmartMutexLock lock(mutex);
+    return applyResult;
+}
+
+inline int AttributedThreadPool::queryPlacements(List<ThreadPlacement> &placementsHolder)
+{
+    SmartMutexLock lock(mutex);
+    for(int i = threadIDs.size() - 1; i >= 0; --i)
+    {
+        ThreadPlacement placement;
+        if(ThreadAttributes::query(threadIDs.get(i), &placement) == MIO_GENERAL_OK)
+        {
+            placementsHolder.addWithoutCheck(placement);
+        }
+        else
+        {
+            threadIDs.removeByIndex(i);
+        }
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline int AttributedThreadPool::submit(Ref<Runnable> &&workItem, int (*taskEntry)(void *), void *context)
+{
+    _AttributedWorkItem *item = new _AttributedWorkItem(this, std::move(workItem), taskEntry, context);
+    int result = pool.executeTaskItem(item);
+    item->deref();
+    return result;
+}
+
+inline void AttributedThreadPool::applyIfChanged(void)
+{
+    // Pooled threads belong to one pool.
+    static __thread uint32_t appliedGeneration = 0;
+    uint32_t currentGeneration = generation.load(std::memory_order_acquire);
+    if(appliedGeneration == currentGeneration)
+    {
+        return;
+    }
+    SmartMutexLock lock(mutex);
+    applyResult = attributes.applyToCurrentThread();
+    if(appliedGeneration == 0)
+    {
+        threadIDs.addWithoutCheck(Thread::getCurrentThreadID());
+    }
+    appliedGeneration = generation.load(std::memory_order_relaxed);
+}
+
+#endif//_TASK_ATTRIBUTED_THREAD_POOL_H
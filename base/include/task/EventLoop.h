@@ -0,0 +1,694 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/EventLoop.h                                                                            *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  epoll reactor, fd watchers, timerfd timers and posted Runnables share one loop thread,       *
+ *                instead of one blocking thread per I/O source.                                              *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_EVENT_LOOP_H
+#define _TASK_EVENT_LOOP_H
+
+// Standard includes
+#include <errno.h>
+#include <stdint.h>
+#include <atomic>
+#include <utility>
+// POSIX includes
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <basicType/Ref.h>
+#include <basicType/RefCountObj.h>
+#include <container/MpscQueue.h>
+#include <osal/OsalMutex.h>
+#include <task/Runnable.h>
+#include <task/RunnableBridge.h>
+#include <task/Thread.h>
+#include <util/SmartMutexLock.h>
+
+// Max events got by one epoll_wait().
+#define EVENT_LOOP_EVENT_BATCH      64
+
+/*!
+ * @brief Handler of the events of a watched file descriptor, called on the loop thread.
+ */
+class EventLoopFdHandler : public RefCountObj
+{
+  public:
+    EventLoopFdHandler(void);
+
+    // 1. events are EPOLLIN, EPOLLOUT, EPOLLPRI, EPOLLRDHUP, EPOLLERR and EPOLLHUP.
+    // 2. It should not block, other sources of the loop wait meanwhile.
+    virtual void onFdEvents(int fd, uint32_t events) = 0;
+
+  protected:
+    virtual ~EventLoopFdHandler();
+
+  private:
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    EventLoopFdHandler(const EventLoopFdHandler &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    EventLoopFdHandler &operator=(const EventLoopFdHandler &);
+};
+
+// EventLoopFdHandler of a function, like RunnableBridge.
+class EventLoopFdBridge : public EventLoopFdHandler
+{
+  public:
+    EventLoopFdBridge(void (*onEvents)(void *context, int fd, uint32_t events), void *context);
+
+    virtual void onFdEvents(int fd, uint32_t events);
+
+  protected:
+    virtual ~EventLoopFdBridge();
+
+  private:
+    void (*const onEvents)(void *context, int fd, uint32_t events);
+    void *const context;
+};
+
+struct _EventLoopLink
+{
+    _EventLoopLink *prev;
+    _EventLoopLink *next;
+};
+
+// Registration of a file descriptor, the epoll data of it.
+struct _EventLoopEntry : public _EventLoopLink
+{
+    const int fd;
+    // > 0 for timers.
+    const int timerID;
+    // Cleared by unwatchFd(), events of the current epoll_wait() batch are skipped then.
+    std::atomic<bool> isActive;
+    const Ref<EventLoopFdHandler> handler;
+
+    _EventLoopEntry(int _fd, int _timerID, Ref<EventLoopFdHandler> &&_handler) :
+        fd(_fd), timerID(_timerID), isActive(true), handler(std::move(_handler))
+    {
+    }
+};
+
+class EventLoop;
+
+// Owner of the timerfd of a timer, which is closed when the entry is freed on the loop thread.
+class _EventLoopTimerHandler : public EventLoopFdHandler
+{
+  public:
+    _EventLoopTimerHandler(EventLoop *loop, int timerFD, Ref<Runnable> &&runnable, bool isPeriodic);
+
+    virtual void onFdEvents(int fd, uint32_t events);
+
+    void setTimerID(int timerID);
+
+  protected:
+    virtual ~_EventLoopTimerHandler();
+
+  private:
+    EventLoop *const loop;
+    const int timerFD;
+    const Ref<Runnable> runnable;
+    const bool isPeriodic;
+    int timerID;
+};
+
+/*!
+ * @brief epoll reactor, all file descriptors, timers and posted Runnables of it are handled by one thread.
+ *
+ * @remarks
+ *   1. Serial ports, sockets and pipes are watched by watchFd(), instead of a blocking reader thread for each,
+ *      so a few loops serve many sources, with fewer context switches and thread stacks.
+ *   2. start() runs the loop on a thread of its own, or run() runs it on the caller thread until stop().
+ *   3. All APIs can be called from any thread, including handlers on the loop thread.  Handlers of one loop
+ *      never run concurrently, so the state shared only by them needs no lock.
+ *   4. Handlers and Runnables are ref() while they are registered, and deref() on the loop thread after
+ *      unwatchFd()/cancelTimer(), so they may still be running when these return on other threads.  Close fd in
+ *      the destructor of its handler, or after unwatchFd() on the loop thread, so a reused fd number is never
+ *      read by a late handler.
+ *   5. post() is lock-free, one eventfd write wakes the loop for all Runnables posted meanwhile.
+ *   6. For example:
+ *          loop.start();
+ *          EventLoopFdBridge *handler = new EventLoopFdBridge(_onSerialReadable, this);
+ *          loop.watchFd(serialFD, EPOLLIN, handler);
+ *          handler->deref();
+ */
+class EventLoop
+{
+  public:
+    EventLoop(void);
+
+    /*!
+     * Destructor.
+     *
+     * @remarks stop() first, handlers still watched and Runnables still posted are deref() w/o being called.
+     */
+    ~EventLoop();
+
+    // 1. Run the loop on a new thread.
+    // 2. Return MIO_ERR_INCORRECT_STATUS if it is running, MIO_ERR_IO_GENERAL if epoll or eventfd fails.
+    int start(void);
+    // Run the loop on the caller thread until stop(), the return values are the same as start().
+    int run(void);
+    // 1. The loop returns after the current handler.
+    // 2. The thread of start() is joined, unless it is called on the loop thread.
+    void stop(void);
+    bool isRunning(void) const;
+    bool isInLoopThread(void) const;
+
+    // 1. events are EPOLLIN, EPOLLOUT, EPOLLPRI and EPOLLRDHUP, | EPOLLET for edge-triggered.  EPOLLERR and
+    //    EPOLLHUP are always reported.
+    // 2. handler is ref(), and deref() after unwatchFd().
+    // 3. Return MIO_ERR_INCORRECT_STATUS if fd is watched already, MIO_ERR_ILLEGAL_PARAMETERS if fd cannot be
+    //    polled, e.g. a regular file.
+    int watchFd(int fd, uint32_t events, EventLoopFdHandler *handler);
+    // Same as above, and the reference of handler is moved in, even on failure.
+    int watchFd(int fd, uint32_t events, Ref<EventLoopFdHandler> &&handler);
+    int modifyFd(int fd, uint32_t events);
+    // Return MIO_ERR_NO_DATA if fd is not watched.
+    int unwatchFd(int fd);
+
+    // 1. runnable->run() after delayMS, and then every periodMS if periodMS > 0, on the loop thread.
+    // 2. Missed periods of a busy loop are run once, not caught up.
+    // 3. runnable is ref(), and deref() after the one-shot timer fires, or cancelTimer().
+    // 4. Return the timer ID (> 0), or MIO_ERR_ILLEGAL_PARAMETERS/MIO_ERR_IO_GENERAL.
+    int addTimer(int delayMS, int periodMS, Runnable *runnable);
+    // Same as above, and the reference of runnable is moved in, even on failure.
+    int addTimer(int delayMS, int periodMS, Ref<Runnable> &&runnable);
+    // Return MIO_ERR_NO_DATA if timerID has fired (one-shot) or is cancelled.
+    int cancelTimer(int timerID);
+
+    // 1. runnable->run() on the loop thread, in the order of post().
+    // 2. runnable is ref(), and deref() after run().
+    int post(Runnable *runnable);
+    // Same as above, and the reference of runnable is moved in, even on failure.
+    int post(Ref<Runnable> &&runnable);
+
+    // Number of epoll_wait() wakeups, to compare with the number of handled events.
+    uint64_t getWakeupCount(void) const;
+
+  private:
+    int epollFD;
+    int eventFD;
+    std::atomic<bool> running;
+    std::atomic<int> loopThreadID;
+    // Set by the first post() after the loop drained posted Runnables, so others skip the eventfd write.
+    std::atomic<bool> isWakePending;
+    MpscQueue<Runnable *> posted;
+    std::atomic<uint64_t> wakeupCount;
+    Thread *loopThread;
+    OsalMutex mutex;
+    // Below are protected by mutex.
+    // Watched entries.
+    _EventLoopLink entries;
+    // Unwatched entries, freed on the loop thread after the current batch.
+    _EventLoopLink retired;
+    int lastTimerID;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    EventLoop(const EventLoop &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    EventLoop &operator=(const EventLoop &);
+
+    int runLoop(void);
+    int addEntry(int fd, uint32_t events, int timerID, Ref<EventLoopFdHandler> &&handler);
+    // mutex should be locked.
+    _EventLoopEntry *findEntry(int fd, int timerID);
+    // mutex should be locked.
+    void retireEntry(_EventLoopEntry *entry);
+    void freeRetired(void);
+    void runPosted(void);
+    void wake(void);
+    static int _loopEntry(void *context);
+};
+
+/* Implementation for EventLoopFdHandler */
+
+inline EventLoopFdHandler::EventLoopFdHandler(void)
+{
+}
+
+inline EventLoopFdHandler::~EventLoopFdHandler()
+{
+}
+
+/* Implementation for EventLoopFdBridge */
+
+inline EventLoopFdBridge::EventLoopFdBridge(void (*_onEvents)(void *context, int fd, uint32_t events),
+                                            void *_context) :
+    onEvents(_onEvents), context(_context)
+{
+}
+
+inline EventLoopFdBridge::~EventLoopFdBridge()
+{
+}
+
+inline void EventLoopFdBridge::onFdEvents(int fd, uint32_t events)
+{
+    onEvents(context, fd, events);
+}
+
+/* Implementation for _EventLoopTimerHandler */
+
+inline _EventLoopTimerHandler::_EventLoopTimerHandler(EventLoop *_loop, int _timerFD, Ref<Runnable> &&_runnable,
+                                                      bool _isPeriodic) :
+    loop(_loop), timerFD(_timerFD), runnable(std::move(_runnable)), isPeriodic(_isPeriodic), timerID(0)
+{
+}
+
+inline _EventLoopTimerHandler::~_EventLoopTimerHandler()
+{
+    close(timerFD);
+}
+
+inline void _EventLoopTimerHandler::setTimerID(int _timerID)
+{
+    timerID = _timerID;
+}
+
+inline void _EventLoopTimerHandler::onFdEvents(int fd, uint32_t events)
+{
+    (void) events;
+    uint64_t expirations;
+    if(read(fd, &expirations, sizeof(expirations)) != sizeof(expirations))
+    {
+        // Re-armed or cancelled meanwhile.
+        return;
+    }
+    if(!isPeriodic)
+    {
+        // Freed after this batch, runnable is still held.
+        loop->cancelTimer(timerID);
+    }
+    runnable->run();
+}
+
+/* Implementation for EventLoop */
+
+inline EventLoop::EventLoop(void) :
+    epollFD(epoll_create1(EPOLL_CLOEXEC)), eventFD(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)), running(false),
+    loopThreadID(0), isWakePending(false), wakeupCount(0), loopThread(0), lastTimerID(0)
+{
+    entries.prev = entries.next = &entries;
+    retired.prev = retired.next = &retired;
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = 0;
+    if((epollFD >= 0) && (eventFD >= 0) && (epoll_ctl(epollFD, EPOLL_CTL_ADD, eventFD, &event) != 0))
+    {
+        close(eventFD);
+        eventFD = -1;
+    }
+}
+
+inline EventLoop::~EventLoop()
+{
+    stop();
+    {
+        SmartMutexLock lock(mutex);
+        while(entries.next != &entries)
+        {
+            retireEntry((_EventLoopEntry *) entries.next);
+        }
+    }
+    freeRetired();
+    Runnable *runnable;
+    while(posted.tryPop(runnable))
+    {
+        runnable->deref();
+    }
+    if(epollFD >= 0)
+    {
+        close(epollFD);
+    }
+    if(eventFD >= 0)
+    {
+        close(eventFD);
+    }
+}
+
+inline int EventLoop::start(void)
+{
+    if((epollFD < 0) || (eventFD < 0))
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    bool expected = false;
+    if(!running.compare_exchange_strong(expected, true))
+    {
+        return MIO_ERR_INCORRECT_STATUS;
+    }
+    if(loopThread)
+    {
+        // Stopped by a handler on it.
+        loopThread->join();
+        loopThread->deref();
+    }
+    RunnableBridge *bridge = new RunnableBridge(_loopEntry, this);
+    loopThread = new Thread(bridge);
+    bridge->deref();
+    int result = loopThread->start();
+    if(result < 0)
+    {
+        loopThread->deref();
+        loopThread = 0;
+        running.store(false);
+    }
+    return result;
+}
+
+inline int EventLoop::run(void)
+{
+    if((epollFD < 0) || (eventFD < 0))
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    bool expected = false;
+    if(!running.compare_exchange_strong(expected, true))
+    {
+        return MIO_ERR_INCORRECT_STATUS;
+    }
+    return runLoop();
+}
+
+inline int EventLoop::runLoop(void)
+{
+    loopThreadID.store(Thread::getCurrentThreadID(), std::memory_order_relaxed);
+    struct epoll_event events[EVENT_LOOP_EVENT_BATCH];
+    // Posted before run().
+    runPosted();
+    while(running.load(std::memory_order_acquire))
+    {
+        int count = epoll_wait(epollFD, events, EVENT_LOOP_EVENT_BATCH, -1);
+        wakeupCount.fetch_add(1, std::memory_order_relaxed);
+        for(int i = 0; (i < count) && running.load(std::memory_order_relaxed); ++i)
+        {
+            _EventLoopEntry *entry = (_EventLoopEntry *) events[i].data.ptr;
+            if(!entry)
+            {
+                runPosted();
+            }
+            else if(entry->isActive.load(std::memory_order_acquire))
+            {
+                entry->handler->onFdEvents(entry->fd, events[i].events);
+            }
+        }
+        // No event of this batch refers to retired entries any more.
+        freeRetired();
+    }
+    loopThreadID.store(0, std::memory_order_relaxed);
+    return MIO_GENERAL_OK;
+}
+
+inline void EventLoop::stop(void)
+{
+    running.store(false, std::memory_order_release);
+    if(eventFD >= 0)
+    {
+        uint64_t one = 1;
+        while((write(eventFD, &one, sizeof(one)) < 0) && (errno == EINTR))
+        {
+        }
+    }
+    if(loopThread && !isInLoopThread())
+    {
+        loopThread->join();
+        loopThread->deref();
+        loopThread = 0;
+    }
+}
+
+inline bool EventLoop::isRunning(void) const
+{
+    return running.load(std::memory_order_acquire);
+}
+
+inline bool EventLoop::isInLoopThread(void) const
+{
+    return loopThreadID.load(std::memory_order_relaxed) == Thread::getCurrentThreadID();
+}
+
+inline int EventLoop::watchFd(int fd, uint32_t events, EventLoopFdHandler *handler)
+{
+    if(!handler)
+    {
+        return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    return addEntry(fd, events, 0, Ref<EventLoopFdHandler>::retain(handler));
+}
+
+inline int EventLoop::watchFd(int fd, uint32_t events, Ref<EventLoopFdHandler> &&handler)
+{
+    Ref<EventLoopFdHandler> holder(std::move(handler));
+    if(!holder)
+    {
+        return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    return addEntry(fd, events, 0, std::move(holder));
+}
+
+inline int EventLoop::modifyFd(int fd, uint32_t events)
+{
+    SmartMutexLock lock(mutex);
+    _EventLoopEntry *entry = findEntry(fd, 0);
+    if(!entry || (entry->timerID != 0))
+    {
+        return MIO_ERR_NO_DATA;
+    }
+    struct epoll_event event;
+    event.events = events;
+    event.data.ptr = entry;
+    return (epoll_ctl(epollFD, EPOLL_CTL_MOD, fd, &event) == 0) ? MIO_GENERAL_OK : MIO_ERR_ILLEGAL_PARAMETERS;
+}
+
+inline int EventLoop::unwatchFd(int fd)
+{
+    {
+        SmartMutexLock lock(mutex);
+        _EventLoopEntry *entry = findEntry(fd, 0);
+        // Timers are cancelled by cancelTimer().
+        if(!entry || (entry->timerID != 0))
+        {
+            return MIO_ERR_NO_DATA;
+        }
+        retireEntry(entry);
+    }
+    if(!isInLoopThread())
+    {
+        // Free it soon.
+        wake();
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline int EventLoop::addTimer(int delayMS, int periodMS, Runnable *runnable)
+{
+    return addTimer(delayMS, periodMS, Ref<Runnable>::retain(runnable));
+}
+
+inline int EventLoop::addTimer(int delayMS, int periodMS, Ref<Runnable> &&runnable)
+{
+    Ref<Runnable> holder(std::move(runnable));
+    if(!holder || (delayMS < 0) || (periodMS < 0))
+    {
+        return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    int timerFD = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if(timerFD < 0)
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    _EventLoopTimerHandler *handler = new _EventLoopTimerHandler(this, timerFD, std::move(holder), periodMS > 0);
+    Ref<EventLoopFdHandler> handlerHolder = Ref<EventLoopFdHandler>::adopt(handler);
+    int timerID;
+    {
+        SmartMutexLock lock(mutex);
+        // Skip IDs still in use after wrapping around.
+        do
+        {
+            lastTimerID = (lastTimerID == INT32_MAX) ? 1 : (lastTimerID + 1);
+        } while(findEntry(-1, lastTimerID));
+        timerID = lastTimerID;
+    }
+    handler->setTimerID(timerID);
+    int result = addEntry(timerFD, EPOLLIN, timerID, std::move(handlerHolder));
+    if(result < 0)
+    {
+        // timerFD is closed by the handler.
+        return result;
+    }
+    // Armed after it is watched, 0 disarms a timerfd, so the earliest is 1ns.
+    struct itimerspec spec;
+    spec.it_value.tv_sec = delayMS / 1000;
+    spec.it_value.tv_nsec = (delayMS % 1000) * 1000000L + ((delayMS == 0) ? 1 : 0);
+    spec.it_interval.tv_sec = periodMS / 1000;
+    spec.it_interval.tv_nsec = (periodMS % 1000) * 1000000L;
+    timerfd_settime(timerFD, 0, &spec, 0);
+    return timerID;
+}
+
+inline int EventLoop::cancelTimer(int timerID)
+{
+    if(timerID <= 0)
+    {
+        return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    {
+        SmartMutexLock lock(mutex);
+        _EventLoopEntry *entry = findEntry(-1, timerID);
+        if(!entry)
+        {
+            return MIO_ERR_NO_DATA;
+        }
+        retireEntry(entry);
+    }
+    if(!isInLoopThread())
+    {
+        wake();
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline int EventLoop::post(Runnable *runnable)
+{
+    return post(Ref<Runnable>::retain(runnable));
+}
+
+inline int EventLoop::post(Ref<Runnable> &&runnable)
+{
+    Ref<Runnable> holder(std::move(runnable));
+    if(!holder)
+    {
+        return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    posted.push(holder.release());
+    wake();
+    return MIO_GENERAL_OK;
+}
+
+inline uint64_t EventLoop::getWakeupCount(void) const
+{
+    return wakeupCount.load(std::memory_order_relaxed);
+}
+
+inline int EventLoop::addEntry(int fd, uint32_t events, int timerID, Ref<EventLoopFdHandler> &&handler)
+{
+    if((fd < 0) || (epollFD < 0))
+    {
+        return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    _EventLoopEntry *entry = new _EventLoopEntry(fd, timerID, std::move(handler));
+    SmartMutexLock lock(mutex);
+    if(findEntry(fd, 0))
+    {
+        delete entry;
+        return MIO_ERR_INCORRECT_STATUS;
+    }
+    struct epoll_event event;
+    event.events = events;
+    event.data.ptr = entry;
+    if(epoll_ctl(epollFD, EPOLL_CTL_ADD, fd, &event) != 0)
+    {
+        int error = errno;
+        delete entry;
+        return (error == EEXIST) ? MIO_ERR_INCORRECT_STATUS : MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    entry->prev = entries.prev;
+    entry->next = &entries;
+    entries.prev->next = entry;
+    entries.prev = entry;
+    return MIO_GENERAL_OK;
+}
+
+inline _EventLoopEntry *EventLoop::findEntry(int fd, int timerID)
+{
+    // Few sources per loop, linear search is fine.
+    for(_EventLoopLink *link = entries.next; link != &entries; link = link->next)
+    {
+        _EventLoopEntry *entry = (_EventLoopEntry *) link;
+        if((timerID > 0) ? (entry->timerID == timerID) : (entry->fd == fd))
+        {
+            return entry;
+        }
+    }
+    return 0;
+}
+
+inline void EventLoop::retireEntry(_EventLoopEntry *entry)
+{
+    entry->isActive.store(false, std::memory_order_release);
+    // Before the fd may be closed.
+    epoll_ctl(epollFD, EPOLL_CTL_DEL, entry->fd, 0);
+    entry->prev->next = entry->next;
+    entry->next->prev = entry->prev;
+    entry->prev = retired.prev;
+    entry->next = &retired;
+    retired.prev->next = entry;
+    retired.prev = entry;
+}
+
+inline void EventLoop::freeRetired(void)
+{
+    _EventLoopLink *link;
+    {
+        SmartMutexLock lock(mutex);
+        if(retired.next == &retired)
+        {
+            return;
+        }
+        link = retired.next;
+        retired.prev->next = 0;
+        retired.prev = retired.next = &retired;
+    }
+    // Handlers' destructors may call the loop, w/o mutex locked.
+    while(link)
+    {
+        _EventLoopEntry *entry = (_EventLoopEntry *) link;
+        link = link->next;
+        delete entry;
+    }
+}
+
+inline void EventLoop::runPosted(void)
+{
+    uint64_t value;
+    while(read(eventFD, &value, sizeof(value)) == sizeof(value))
+    {
+    }
+    // acq_rel pairs w/ the exchange of post(), Runnables pushed before it are seen by the pops below.
+    isWakePending.exchange(false, std::memory_order_acq_rel);
+    Runnable *runnable;
+    while(running.load(std::memory_order_relaxed) && posted.tryPop(runnable))
+    {
+        runnable->run();
+        runnable->deref();
+    }
+}
+
+inline void EventLoop::wake(void)
+{
+    if(!isWakePending.exchange(true, std::memory_order_acq_rel) && (eventFD >= 0))
+    {
+        uint64_t one = 1;
+        while((write(eventFD, &one, sizeof(one)) < 0) && (errno == EINTR))
+        {
+        }
+    }
+}
+
+inline int EventLoop::_loopEntry(void *context)
+{
+    return ((EventLoop *) context)->runLoop();
+}
+
+#endif//_TASK_EVENT_LOOP_H
@@ -0,0 +1,996 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/Future.h                                                                               *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Future/Promise of work items, with continuations, combinators and cancellation.             *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_FUTURE_H
+#define _TASK_FUTURE_H
+
+// Standard includes
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+#include <new>
+#include <utility>
+// POSIX includes
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <container/List.h>
+#include <task/Runnable.h>
+#include <task/AttributedThreadPool.h>
+#include <task/TaskLaneScheduler.h>
+#include <task/ThreadPool.h>
+#include <task/WorkStealingThreadPool.h>
+
+enum FutureStatus
+{
+    FUTURE_PENDING,
+    FUTURE_FULFILLED,
+    FUTURE_FAILED,
+    FUTURE_CANCELLED
+};
+
+template <class T> class Future;
+template <class T> class Promise;
+class Futures;
+// C++20 coroutines, see task/Task.h.
+template <class T> class Task;
+template <class T> class _TaskFutureAwaiter;
+class _FutureStateBase;
+
+// Called once the observed state completes, the node is owned by the observer.
+struct _FutureCallback
+{
+    _FutureCallback *nextCallback;
+
+    virtual void onComplete(_FutureStateBase *source) = 0;
+
+  protected:
+    ~_FutureCallback()
+    {
+    }
+};
+
+/*!
+ * @brief Where continuations and work items of futures run.
+ *
+ * @remarks
+ *   1. The default is inline, a continuation runs on the thread which completes the future, or on the thread
+ *      which calls then() if the future is completed already.  Inline continuations should be short.
+ *   2. Pools are not owned, they must outlive the futures which use them.
+ */
+class FutureExecutor
+{
+  public:
+    // Inline.
+    FutureExecutor(void);
+    FutureExecutor(ThreadPool *pool);
+    FutureExecutor(WorkStealingThreadPool *pool);
+    FutureExecutor(AttributedThreadPool *pool);
+    // TaskLanes, in the lane of priority.
+    FutureExecutor(TaskPriority priority);
+    // GlobalThreadPool w/o priority.
+    static FutureExecutor globalPool(void);
+
+    bool isInline(void) const;
+    // workItem is ref(), and deref() when end.
+    int execute(Runnable *workItem) const;
+    // Same as above, and the reference of workItem is moved in, even on failure.
+    int execute(Ref<Runnable> &&workItem) const;
+
+  private:
+    enum Type
+    {
+        INLINE,
+        THREAD_POOL,
+        WORK_STEALING_THREAD_POOL,
+        ATTRIBUTED_THREAD_POOL,
+        GLOBAL_THREAD_POOL,
+        TASK_LANES
+    };
+
+    Type type;
+    void *pool;
+    TaskPriority priority;
+};
+
+// State shared by a promise (or a work item) and its futures.
+class _FutureStateBase : public Runnable
+{
+  public:
+    FutureStatus getStatus(void) const;
+    bool isCompleted(void) const;
+    int getErrorCode(void) const;
+    // timeoutMS <= 0 for no timeout, return MIO_ERR_TIMEOUT if it is still pending.
+    int wait(int timeoutMS);
+    bool fail(int errorCode);
+    bool cancel(void);
+    // callback->onComplete() is called immediately if it is completed already.
+    void addCallback(_FutureCallback *callback);
+
+    // Work item states override it.
+    virtual int run(void);
+
+  protected:
+    _FutureStateBase(void);
+    // A state which is never completed, fails with MIO_REASON_SUBSYSTEM_STOPPED here, for example, its work item
+    // is dropped by a shut down pool.
+    virtual ~_FutureStateBase();
+
+    // Only one caller wins, the value is set between beginCompletion() and endCompletion().
+    bool beginCompletion(void);
+    void endCompletion(FutureStatus finalStatus, int errorCode);
+
+  private:
+    // Between beginCompletion() and endCompletion().
+    static const int SETTING = -1;
+
+    std::atomic<int> status;
+    int errorCode;
+    std::atomic<_FutureCallback *> callbacks;
+    std::atomic<int> waiterCount;
+
+    static _FutureCallback *closedCallbacks(void);
+};
+
+template <class T>
+class _FutureState : public _FutureStateBase
+{
+  public:
+    _FutureState(void)
+    {
+    }
+
+    bool fulfil(const T &value);
+    // FUTURE_FULFILLED only.
+    const T &getValue(void) const;
+
+  protected:
+    virtual ~_FutureState();
+
+  private:
+    alignas(T) unsigned char storage[sizeof(T)];
+};
+
+// Result type of calling F with const T &.
+template <class F, class T>
+struct _FutureResult
+{
+    typedef decltype(std::declval<F &>()(std::declval<const T &>())) Type;
+};
+
+/*!
+ * @brief Result of a work item, or of a Promise.
+ *
+ * @remarks
+ *   1. A Future is a handle, copies share the same state, which is a RefCountObj freed with the last handle.
+ *   2. T must be copy constructible, use int (MIO_GENERAL_OK or an error code) for work w/o results.
+ *   3. then() continuations run only if this is fulfilled, errors and cancellation are passed down the chain
+ *      without calling them.  Each then() allocates the state of the new future only, registration and
+ *      completion are lock-free and allocation-free.
+ *   4. cancel() completes a pending future as FUTURE_CANCELLED, a work item which is not started yet is
+ *      skipped, a running one is not interrupted (it may check Promise::isCancelled()), its result is dropped.
+ *   5. For example:
+ *          Future<int> frames = Futures::executeTaskItem(_decodeFrames, this);
+ *          Future<int> uploaded = frames.then(_uploadFrames, this, FutureExecutor(TASK_PRIORITY_BACKGROUND));
+ *          int result;
+ *          if(uploaded.get(&result, 3000) == MIO_ERR_TIMEOUT)
+ *          {
+ *              uploaded.cancel();
+ *          }
+ */
+template <class T>
+class Future
+{
+  public:
+    // Invalid one, only assignment, isValid() and the destructor can be used.
+    Future(void);
+    Future(const Future &another);
+    Future &operator=(const Future &another);
+
+    /*!
+     * Destructor.
+     */
+    ~Future();
+
+    bool isValid(void) const;
+    FutureStatus getStatus(void) const;
+    // Not FUTURE_PENDING.
+    bool isReady(void) const;
+    // timeoutMS <= 0 for no timeout, return MIO_ERR_TIMEOUT if it is still pending.
+    int wait(int timeoutMS = 0) const;
+    // Return MIO_GENERAL_OK with the value, the error code of FUTURE_FAILED, MIO_REASON_CANCELLED, or
+    // MIO_ERR_TIMEOUT.
+    int get(T *valueHolder, int timeoutMS = 0) const;
+    // FUTURE_FULFILLED only.
+    const T &getValue(void) const;
+    int getErrorCode(void) const;
+    // Return false if it is completed already.
+    bool cancel(void);
+
+    // continuation(const T &value) returns the value of the new future.
+    template <class F>
+    Future<typename _FutureResult<F, T>::Type> then(F continuation,
+                                                    const FutureExecutor &executor = FutureExecutor()) const;
+    // The same, in the style of work item entries.
+    template <class U>
+    Future<U> then(U (*continuation)(const T &value, void *context), void *context,
+                   const FutureExecutor &executor = FutureExecutor()) const;
+
+  private:
+    _FutureState<T> *state;
+
+    // state is adopted, w/o ref().
+    Future(_FutureState<T> *state);
+
+    template <class> friend class Future;
+    friend class Promise<T>;
+    friend class Futures;
+    template <class> friend class Task;
+    friend class _TaskFutureAwaiter<T>;
+};
+
+/*!
+ * @brief The producer side of a Future.
+ *
+ * @remarks
+ *   1. A Promise which is destructed w/o setValue()/setError() fails its futures with MIO_ERR_NO_DATA.
+ *   2. setValue()/setError() return false if the futures are completed already (cancelled, normally).
+ */
+template <class T>
+class Promise
+{
+  public:
+    Promise(void);
+
+    /*!
+     * Destructor.
+     */
+    ~Promise();
+
+    Future<T> getFuture(void);
+    bool setValue(const T &value);
+    bool setError(int errorCode);
+    bool isCancelled(void) const;
+
+  private:
+    _FutureState<T> *state;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    Promise(const Promise &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    Promise &operator=(const Promise &);
+};
+
+/*!
+ * @brief Work items with futures, and combinators.
+ */
+class Futures
+{
+  public:
+    // The same as executeTaskItem(), and the result of workItemEntry is returned by the future.
+    static Future<int> executeTaskItem(int (*workItemEntry)(void *), void *context,
+                                       const FutureExecutor &executor = FutureExecutor::globalPool());
+    // work() is called as a work item.
+    template <class F>
+    static Future<decltype(std::declval<F &>()())> executeTaskItem(F work, const FutureExecutor &executor =
+                                                                                  FutureExecutor::globalPool());
+    // Fulfilled with the number of futures once all of them are fulfilled, or fails with the error code of the
+    // first one which is not fulfilled (MIO_REASON_CANCELLED for a cancelled one) once all are completed.
+    template <class T>
+    static Future<int> whenAll(const List<Future<T> > &futures);
+    // Fulfilled with the index of the first completed one, no matter its status.
+    template <class T>
+    static Future<int> whenAny(const List<Future<T> > &futures);
+
+  private:
+    // Private constructor is declared but not defined to prevent object creation.
+    Futures(void);
+};
+
+// State of Futures::executeTaskItem().
+template <class T, class F>
+class _FutureTaskState : public _FutureState<T>
+{
+  public:
+    _FutureTaskState(const F &_work) : work(_work)
+    {
+    }
+
+    virtual int run(void)
+    {
+        // Skipped if it is cancelled before start.
+        if(!this->isCompleted())
+        {
+            this->fulfil(work());
+        }
+        return MIO_GENERAL_OK;
+    }
+
+  private:
+    F work;
+};
+
+// State of Future::then(), registered to the source as a callback.  The source is not referenced until it is
+// fulfilled, so a source which is never completed (its work item is dropped, ...) and its continuations are
+// still freed with their last handles.
+template <class T, class U, class F>
+class _FutureThenState : public _FutureState<U>, public _FutureCallback
+{
+  public:
+    _FutureThenState(const F &_continuation, const FutureExecutor &_executor) :
+        source(0), continuation(_continuation), executor(_executor)
+    {
+    }
+
+    virtual void onComplete(_FutureStateBase *completed)
+    {
+        // Errors and cancellation are passed down at once, it may be called by the destructor of the source.
+        switch(completed->getStatus())
+        {
+            case FUTURE_FULFILLED:
+                // Referenced until this is freed, for the value.
+                source = static_cast<_FutureState<T> *>(completed);
+                source->ref();
+                if(executor.isInline())
+                {
+                    run();
+                }
+                else
+                {
+                    int result = executor.execute(this);
+                    if(result != MIO_GENERAL_OK)
+                    {
+                        this->fail(result);
+                    }
+                }
+                break;
+            case FUTURE_CANCELLED:
+                this->cancel();
+                break;
+            default:
+                this->fail(completed->getErrorCode());
+                break;
+        }
+        // The reference for the registration.
+        this->deref();
+    }
+
+    virtual int run(void)
+    {
+        // Skipped if it is cancelled before start.
+        if(!this->isCompleted())
+        {
+            this->fulfil(continuation(source->getValue()));
+        }
+        return MIO_GENERAL_OK;
+    }
+
+  protected:
+    virtual ~_FutureThenState()
+    {
+        if(source)
+        {
+            source->deref();
+        }
+    }
+
+  private:
+    // Set once the source is fulfilled.
+    _FutureState<T> *source;
+    F continuation;
+    const FutureExecutor executor;
+};
+
+// Calls work item entries for Futures::executeTaskItem().
+struct _FutureEntryCall
+{
+    int (*entry)(void *);
+    void *context;
+
+    int operator()(void) const
+    {
+        return entry(context);
+    }
+};
+
+// Calls (value, context) style continuations for Future::then().
+template <class T, class U>
+struct _FutureContinuationCall
+{
+    U (*continuation)(const T &, void *);
+    void *context;
+
+    U operator()(const T &value) const
+    {
+        return continuation(value, context);
+    }
+};
+
+// State of Futures::whenAll()/whenAny().
+class _FutureWhenState : public _FutureState<int>
+{
+  public:
+    _FutureWhenState(int count, bool _isAny);
+
+    void watch(int ndx, _FutureStateBase *source);
+
+  protected:
+    virtual ~_FutureWhenState();
+
+  private:
+    struct Link : public _FutureCallback
+    {
+        _FutureWhenState *owner;
+        int ndx;
+
+        virtual void onComplete(_FutureStateBase *source)
+        {
+            owner->onComplete(ndx, source);
+        }
+    };
+
+    Link *links;
+    const int count;
+    const bool isAny;
+    std::atomic<int> remaining;
+    std::atomic<int> firstError;
+
+    void onComplete(int ndx, _FutureStateBase *source);
+};
+
+/* Implementation for FutureExecutor */
+
+inline FutureExecutor::FutureExecutor(void) : type(INLINE), pool(0), priority(TASK_PRIORITY_NORMAL)
+{
+}
+
+inline FutureExecutor::FutureExecutor(ThreadPool *_pool) :
+    type(THREAD_POOL), pool(_pool), priority(TASK_PRIORITY_NORMAL)
+{
+}
+
+inline FutureExecutor::FutureExecutor(WorkStealingThreadPool *_pool) :
+    type(WORK_STEALING_THREAD_POOL), pool(_pool), priority(TASK_PRIORITY_NORMAL)
+{
+}
+
+inline FutureExecutor::FutureExecutor(AttributedThreadPool *_pool) :
+    type(ATTRIBUTED_THREAD_POOL), pool(_pool), priority(TASK_PRIORITY_NORMAL)
+{
+}
+
+inline FutureExecutor::FutureExecutor(TaskPriority _priority) :
+    type(TASK_LANES), pool(0), priority(_priority)
+{
+}
+
+inline FutureExecutor FutureExecutor::globalPool(void)
+{
+    FutureExecutor executor;
+    executor.type = GLOBAL_THREAD_POOL;
+    return executor;
+}
+
+inline bool FutureExecutor::isInline(void) const
+{
+    return type == INLINE;
+}
+
+inline int FutureExecutor::execute(Runnable *workItem) const
+{
+    switch(type)
+    {
+        case THREAD_POOL:
+            return ((ThreadPool *) pool)->executeTaskItem(workItem);
+        case WORK_STEALING_THREAD_POOL:
+            return ((WorkStealingThreadPool *) pool)->executeTaskItem(workItem);
+        case ATTRIBUTED_THREAD_POOL:
+            return ((AttributedThreadPool *) pool)->executeTaskItem(workItem);
+        case GLOBAL_THREAD_POOL:
+            return GlobalThreadPool::executeTaskItem(workItem);
+        case TASK_LANES:
+            return TaskLanes::executeTaskItem(workItem, priority);
+        default:
+            workItem->ref();
+            workItem->run();
+            workItem->deref();
+            return MIO_GENERAL_OK;
+    }
+}
+
+inline int FutureExecutor::execute(Ref<Runnable> &&workItem) const
+{
+    switch(type)
+    {
+        case THREAD_POOL:
+            return ((ThreadPool *) pool)->executeTaskItem(std::move(workItem));
+        case WORK_STEALING_THREAD_POOL:
+            return ((WorkStealingThreadPool *) pool)->executeTaskItem(std::move(workItem));
+        case ATTRIBUTED_THREAD_POOL:
+            return ((AttributedThreadPool *) pool)->executeTaskItem(std::move(workItem));
+        case GLOBAL_THREAD_POOL:
+            return GlobalThreadPool::executeTaskItem(std::move(workItem));
+        case TASK_LANES:
+            return TaskLanes::executeTaskItem(std::move(workItem), priority);
+        default:
+            workItem->run();
+            workItem.reset();
+            return MIO_GENERAL_OK;
+    }
+}
+
+/* Implementation for _FutureStateBase */
+
+inline _FutureStateBase::_FutureStateBase(void) :
+    status(FUTURE_PENDING), errorCode(MIO_GENERAL_OK), callbacks(0), waiterCount(0)
+{
+}
+
+inline _FutureStateBase::~_FutureStateBase()
+{
+    if(beginCompletion())
+    {
+        endCompletion(FUTURE_FAILED, MIO_REASON_SUBSYSTEM_STOPPED);
+    }
+}
+
+inline FutureStatus _FutureStateBase::getStatus(void) const
+{
+    int value = status.load(std::memory_order_acquire);
+    return (value == SETTING) ? FUTURE_PENDING : (FutureStatus) value;
+}
+
+inline bool _FutureStateBase::isCompleted(void) const
+{
+    return getStatus() != FUTURE_PENDING;
+}
+
+inline int _FutureStateBase::getErrorCode(void) const
+{
+    switch(getStatus())
+    {
+        case FUTURE_FAILED:
+            return errorCode;
+        case FUTURE_CANCELLED:
+            return MIO_REASON_CANCELLED;
+        default:
+            return MIO_GENERAL_OK;
+    }
+}
+
+inline int _FutureStateBase::wait(int timeoutMS)
+{
+    if(isCompleted())
+    {
+        return MIO_GENERAL_OK;
+    }
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    int64_t deadlineNS = deadline.tv_sec * 1000000000LL + deadline.tv_nsec + timeoutMS * 1000000LL;
+
+    // Paired with endCompletion(), which stores status before it reads waiterCount.
+    waiterCount.fetch_add(1);
+    int result = MIO_GENERAL_OK;
+    while(true)
+    {
+        int value = status.load();
+        if((value != FUTURE_PENDING) && (value != SETTING))
+        {
+            break;
+        }
+        struct timespec timeout;
+        struct timespec *timeoutPtr = 0;
+        if(timeoutMS > 0)
+        {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            int64_t leftNS = deadlineNS - (now.tv_sec * 1000000000LL + now.tv_nsec);
+            if(leftNS <= 0)
+            {
+                result = MIO_ERR_TIMEOUT;
+                break;
+            }
+            timeout.tv_sec = leftNS / 1000000000LL;
+            timeout.tv_nsec = leftNS % 1000000000LL;
+            timeoutPtr = &timeout;
+        }
+        // It returns at once if status is not value any more.
+        syscall(SYS_futex, (int *) &status, FUTEX_WAIT_PRIVATE, value, timeoutPtr, 0, 0);
+    }
+    waiterCount.fetch_sub(1);
+    return result;
+}
+
+inline bool _FutureStateBase::fail(int _errorCode)
+{
+    if(!beginCompletion())
+    {
+        return false;
+    }
+    endCompletion(FUTURE_FAILED, _errorCode);
+    return true;
+}
+
+inline bool _FutureStateBase::cancel(void)
+{
+    if(!beginCompletion())
+    {
+        return false;
+    }
+    endCompletion(FUTURE_CANCELLED, MIO_REASON_CANCELLED);
+    return true;
+}
+
+inline void _FutureStateBase::addCallback(_FutureCallback *callback)
+{
+    _FutureCallback *head = callbacks.load(std::memory_order_acquire);
+    do
+    {
+        if(head == closedCallbacks())
+        {
+            callback->onComplete(this);
+            return;
+        }
+        callback->nextCallback = head;
+    } while(!callbacks.compare_exchange_weak(head, callback, std::memory_order_acq_rel,
+                                             std::memory_order_acquire));
+}
+
+inline int _FutureStateBase::run(void)
+{
+    return MIO_GENERAL_OK;
+}
+
+inline bool _FutureStateBase::beginCompletion(void)
+{
+    int expected = FUTURE_PENDING;
+    return status.compare_exchange_strong(expected, SETTING, std::memory_order_acquire);
+}
+
+inline void _FutureStateBase::endCompletion(FutureStatus finalStatus, int _errorCode)
+{
+    errorCode = _errorCode;
+    status.store(finalStatus);
+    if(waiterCount.load() > 0)
+    {
+        syscall(SYS_futex, (int *) &status, FUTEX_WAKE_PRIVATE, INT_MAX, 0, 0, 0);
+    }
+
+    // Callbacks are pushed LIFO, run them in the registration order.
+    _FutureCallback *head = callbacks.exchange(closedCallbacks(), std::memory_order_acq_rel);
+    _FutureCallback *ordered = 0;
+    while(head)
+    {
+        _FutureCallback *next = head->nextCallback;
+        head->nextCallback = ordered;
+        ordered = head;
+        head = next;
+    }
+    while(ordered)
+    {
+        // The callback may be freed by onComplete().
+        _FutureCallback *next = ordered->nextCallback;
+        ordered->onComplete(this);
+        ordered = next;
+    }
+}
+
+inline _FutureCallback *_FutureStateBase::closedCallbacks(void)
+{
+    // Never dereferenced.
+    return (_FutureCallback *) (uintptr_t) 1;
+}
+
+/* Implementation for _FutureState */
+
+template <class T>
+_FutureState<T>::~_FutureState()
+{
+    if(getStatus() == FUTURE_FULFILLED)
+    {
+        ((T *) storage)->~T();
+    }
+}
+
+template <class T>
+bool _FutureState<T>::fulfil(const T &value)
+{
+    if(!beginCompletion())
+    {
+        return false;
+    }
+    new(storage) T(value);
+    endCompletion(FUTURE_FULFILLED, MIO_GENERAL_OK);
+    return true;
+}
+
+template <class T>
+const T &_FutureState<T>::getValue(void) const
+{
+    return *(const T *) storage;
+}
+
+/* Implementation for Future */
+
+template <class T>
+Future<T>::Future(void) : state(0)
+{
+}
+
+template <class T>
+Future<T>::Future(_FutureState<T> *_state) : state(_state)
+{
+}
+
+template <class T>
+Future<T>::Future(const Future &another) : state(another.state)
+{
+    if(state)
+    {
+        state->ref();
+    }
+}
+
+template <class T>
+Future<T> &Future<T>::operator=(const Future &another)
+{
+    if(another.state)
+    {
+        another.state->ref();
+    }
+    if(state)
+    {
+        state->deref();
+    }
+    state = another.state;
+    return *this;
+}
+
+template <class T>
+Future<T>::~Future()
+{
+    if(state)
+    {
+        state->deref();
+    }
+}
+
+template <class T>
+bool Future<T>::isValid(void) const
+{
+    return state != 0;
+}
+
+template <class T>
+FutureStatus Future<T>::getStatus(void) const
+{
+    return state->getStatus();
+}
+
+template <class T>
+bool Future<T>::isReady(void) const
+{
+    return state->isCompleted();
+}
+
+template <class T>
+int Future<T>::wait(int timeoutMS) const
+{
+    return state->wait(timeoutMS);
+}
+
+template <class T>
+int Future<T>::get(T *valueHolder, int timeoutMS) const
+{
+    int result = state->wait(timeoutMS);
+    if(result != MIO_GENERAL_OK)
+    {
+        return result;
+    }
+    if(state->getStatus() != FUTURE_FULFILLED)
+    {
+        return state->getErrorCode();
+    }
+    *valueHolder = state->getValue();
+    return MIO_GENERAL_OK;
+}
+
+template <class T>
+const T &Future<T>::getValue(void) const
+{
+    return state->getValue();
+}
+
+template <class T>
+int Future<T>::getErrorCode(void) const
+{
+    return state->getErrorCode();
+}
+
+template <class T>
+bool Future<T>::cancel(void)
+{
+    return state->cancel();
+}
+
+template <class T>
+template <class F>
+Future<typename _FutureResult<F, T>::Type> Future<T>::then(F continuation, const FutureExecutor &executor) const
+{
+    typedef typename _FutureResult<F, T>::Type U;
+    _FutureThenState<T, U, F> *next = new _FutureThenState<T, U, F>(continuation, executor);
+    // Released by onComplete().
+    next->ref();
+    state->addCallback(next);
+    return Future<U>(next);
+}
+
+template <class T>
+template <class U>
+Future<U> Future<T>::then(U (*continuation)(const T &value, void *context), void *context,
+                          const FutureExecutor &executor) const
+{
+    _FutureContinuationCall<T, U> call = { continuation, context };
+    return then(call, executor);
+}
+
+/* Implementation for Promise */
+
+template <class T>
+Promise<T>::Promise(void) : state(new _FutureState<T>())
+{
+}
+
+template <class T>
+Promise<T>::~Promise()
+{
+    state->fail(MIO_ERR_NO_DATA);
+    state->deref();
+}
+
+template <class T>
+Future<T> Promise<T>::getFuture(void)
+{
+    state->ref();
+    return Future<T>(state);
+}
+
+template <class T>
+bool Promise<T>::setValue(const T &value)
+{
+    return state->fulfil(value);
+}
+
+template <class T>
+bool Promise<T>::setError(int errorCode)
+{
+    return state->fail(errorCode);
+}
+
+template <class T>
+bool Promise<T>::isCancelled(void) const
+{
+    return state->getStatus() == FUTURE_CANCELLED;
+}
+
+/* Implementation for Futures */
+
+inline Future<int> Futures::executeTaskItem(int (*workItemEntry)(void *), void *context,
+                                            const FutureExecutor &executor)
+{
+    _FutureEntryCall call = { workItemEntry, context };
+    return executeTaskItem(call, executor);
+}
+
+template <class F>
+Future<decltype(std::declval<F &>()())> Futures::executeTaskItem(F work, const FutureExecutor &executor)
+{
+    typedef decltype(std::declval<F &>()()) T;
+    _FutureTaskState<T, F> *state = new _FutureTaskState<T, F>(work);
+    int result = executor.execute(state);
+    if(result != MIO_GENERAL_OK)
+    {
+        state->fail(result);
+    }
+    return Future<T>(state);
+}
+
+template <class T>
+Future<int> Futures::whenAll(const List<Future<T> > &futures)
+{
+    _FutureWhenState *state = new _FutureWhenState(futures.size(), false);
+    for(int i = 0; i < futures.size(); ++i)
+    {
+        state->watch(i, futures.get(i).state);
+    }
+    return Future<int>(state);
+}
+
+template <class T>
+Future<int> Futures::whenAny(const List<Future<T> > &futures)
+{
+    _FutureWhenState *state = new _FutureWhenState(futures.size(), true);
+    for(int i = 0; i < futures.size(); ++i)
+    {
+        state->watch(i, futures.get(i).state);
+    }
+    return Future<int>(state);
+}
+
+/* Implementation for _FutureWhenState */
+
+inline _FutureWhenState::_FutureWhenState(int _count, bool _isAny) :
+    links(new Link[(_count > 0) ? _count : 1]), count(_count), isAny(_isAny), remaining(_count),
+    firstError(MIO_GENERAL_OK)
+{
+    if(count == 0)
+    {
+        if(isAny)
+        {
+            fail(MIO_ERR_ILLEGAL_PARAMETERS);
+        }
+        else
+        {
+            fulfil(0);
+        }
+    }
+}
+
+inline _FutureWhenState::~_FutureWhenState()
+{
+    delete[] links;
+}
+
+inline void _FutureWhenState::watch(int ndx, _FutureStateBase *source)
+{
+    links[ndx].owner = this;
+    links[ndx].ndx = ndx;
+    // Released by onComplete().
+    ref();
+    source->addCallback(&links[ndx]);
+}
+
+inline void _FutureWhenState::onComplete(int ndx, _FutureStateBase *source)
+{
+    if(isAny)
+    {
+        fulfil(ndx);
+    }
+    else
+    {
+        int expected = MIO_GENERAL_OK;
+        if(source->getStatus() != FUTURE_FULFILLED)
+        {
+            firstError.compare_exchange_strong(expected, source->getErrorCode());
+        }
+        if(remaining.fetch_sub(1) == 1)
+        {
+            int error = firstError.load();
+            if(error == MIO_GENERAL_OK)
+            {
+                fulfil(count);
+            }
+            else
+            {
+                fail(error);
+            }
+        }
+    }
+    deref();
+}
+
+#endif//_TASK_FUTURE_H
@@ -24,6 +24,8 @@ class PeriodicTask : public Runnable
   public:
     // runnable->run() is called as a work item.
     PeriodicTask(int periodInMS, Runnable *runnable);
+    // Same as above, and the reference of runnable is moved in.
+    PeriodicTask(int periodInMS, Ref<Runnable> &&runnable);
     // timerHandler() is called as a work item.
     PeriodicTask(int periodInMS, int (*timerHandler)(void *), void *context);
 
@@ -83,4 +85,11 @@ class PeriodicTask : public Runnable
     friend class OsalTaskExecutor;
 };
 
+inline PeriodicTask::PeriodicTask(int periodInMS, Ref<Runnable> &&runnable) :
+    PeriodicTask(periodInMS, runnable.get())
+{
+    // The task ref() by itself, the moved reference is released after that.
+    runnable.reset();
+}
+
 #endif//_TASK_PERIODIC_TASK_H
@@ -14,7 +14,10 @@
 #ifndef _TASK_RUNNABLE_H
 #define _TASK_RUNNABLE_H
 
-// libBase include
+// Standard includes
+#include <utility>
+// libBase includes
+#include <basicType/Ref.h>
 #include <basicType/RefCountObj.h>
 
 class Runnable : public RefCountObj
@@ -0,0 +1,1053 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/Task.h                                                                                 *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  C++20 coroutine tasks, with awaitables of executors, timers, file descriptors and events.   *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_TASK_H
+#define _TASK_TASK_H
+
+#if !defined(__cpp_impl_coroutine)
+#error "task/Task.h needs C++20 coroutines, compile with -std=c++20"
+#endif
+
+// Standard includes
+#include <errno.h>
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <new>
+#include <utility>
+// POSIX includes
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+#include <task/Future.h>
+#include <task/RunnableBridge.h>
+#include <task/Thread.h>
+#include <task/TimingWheel.h>
+
+template <class T> class _TaskPromise;
+
+// Resumes suspended coroutines on executors.
+struct _TaskResumer
+{
+    // Inline if executor is inline, or it cannot take the work item.
+    static void resume(const FutureExecutor &executor, std::coroutine_handle<> handle);
+    static int _resume(void *address);
+};
+
+// The final suspension of a task, resumes the awaiting coroutine, or completes the future of start().
+struct _TaskFinalAwaiter
+{
+    bool await_ready(void) noexcept
+    {
+        return false;
+    }
+
+    template <class P>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept;
+
+    void await_resume(void) noexcept
+    {
+    }
+};
+
+class _TaskPromiseBase
+{
+  public:
+    // Tasks are lazy, they run once awaited or started.
+    std::suspend_always initial_suspend(void) noexcept
+    {
+        return std::suspend_always();
+    }
+
+    _TaskFinalAwaiter final_suspend(void) noexcept
+    {
+        return _TaskFinalAwaiter();
+    }
+
+    // libBase reports errors by result codes, an exception out of a task is a bug.
+    void unhandled_exception(void)
+    {
+        std::terminate();
+    }
+
+    // The awaiting coroutine, none if it is started by Task::start().
+    std::coroutine_handle<> continuation;
+};
+
+template <class T>
+class _TaskPromise : public _TaskPromiseBase
+{
+  public:
+    // Value type of the future of Task::start().
+    typedef T ValueType;
+
+    _TaskPromise(void) : futureState(0), hasValue(false)
+    {
+    }
+
+    ~_TaskPromise();
+
+    Task<T> get_return_object(void);
+
+    template <class U>
+    void return_value(U &&value)
+    {
+        new(storage) T(std::forward<U>(value));
+        hasValue = true;
+    }
+
+    T &getValue(void)
+    {
+        return *(T *) storage;
+    }
+
+    void completeDetached(void)
+    {
+        futureState->fulfil(getValue());
+        futureState->deref();
+    }
+
+    _FutureState<T> *futureState;
+
+  private:
+    alignas(T) unsigned char storage[sizeof(T)];
+    bool hasValue;
+};
+
+template <>
+class _TaskPromise<void> : public _TaskPromiseBase
+{
+  public:
+    typedef int ValueType;
+
+    _TaskPromise(void) : futureState(0)
+    {
+    }
+
+    Task<void> get_return_object(void);
+
+    void return_void(void)
+    {
+    }
+
+    void completeDetached(void)
+    {
+        futureState->fulfil(MIO_GENERAL_OK);
+        futureState->deref();
+    }
+
+    _FutureState<int> *futureState;
+};
+
+// co_await of a task.
+template <class T>
+class _TaskAwaiter
+{
+  public:
+    _TaskAwaiter(std::coroutine_handle<_TaskPromise<T> > _handle) : handle(_handle)
+    {
+    }
+
+    bool await_ready(void)
+    {
+        return handle.done();
+    }
+
+    // Symmetric transfer, the awaited task runs on this thread w/o growing the stack.
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting)
+    {
+        handle.promise().continuation = awaiting;
+        return handle;
+    }
+
+    T await_resume(void)
+    {
+        if constexpr(!std::is_void<T>::value)
+        {
+            return std::move(handle.promise().getValue());
+        }
+    }
+
+  private:
+    std::coroutine_handle<_TaskPromise<T> > handle;
+};
+
+/*!
+ * @brief Coroutine which returns T, the flow is written as straight code and suspends on co_await.
+ *
+ * @remarks
+ *   1. A task is lazy, it runs once it is awaited by another task (co_await task), or started by start().  It
+ *      runs on the thread which resumes it, between suspensions, so many flows share few threads.
+ *   2. An awaited task returns T to the awaiting one, start() returns a Future which is fulfilled with T, or
+ *      MIO_GENERAL_OK for Task<void>.  Errors are reported by result codes as elsewhere in libBase, an exception
+ *      out of a task terminates the process.
+ *   3. Awaitables:
+ *          co_await Tasks::resumeOn(executor)          Continue on a pool, or a lane of TaskLanes.
+ *          co_await Tasks::sleep(ms)                   Resumed by the TimingWheel, w/o blocking a thread.
+ *          co_await Tasks::waitReadable(fd, timeoutMS) Resumed by the shared epoll thread.
+ *          co_await event                              TaskEvent, set by another task or thread.
+ *          co_await future                             Future of work items, promises or tasks.
+ *   4. A suspended coroutine is resumed once, by the one which completes what it awaits, so a task must not be
+ *      destroyed while it is suspended.  A started task owns itself, and is freed when it ends.
+ *   5. For example, flows which read sockets on GlobalThreadPool:
+ *          Task<int> readFrame(int fd, Frame *frame)
+ *          {
+ *              int result = co_await Tasks::waitReadable(fd, 3000);
+ *              if(result == MIO_GENERAL_OK)
+ *              {
+ *                  result = co_await parseFrame(fd, frame);
+ *              }
+ *              co_return result;
+ *          }
+ *          Future<int> done = readFrame(fd, &frame).start(FutureExecutor::globalPool());
+ */
+template <class T = void>
+class Task
+{
+  public:
+    typedef _TaskPromise<T> promise_type;
+    typedef typename _TaskPromise<T>::ValueType ValueType;
+
+    // Invalid one, only assignment, isValid() and the destructor can be used.
+    Task(void);
+    Task(Task &&another);
+    Task &operator=(Task &&another);
+
+    /*!
+     * Destructor.
+     */
+    ~Task();
+
+    bool isValid(void) const;
+    // 1. Run it on executor until its first suspension, inline by default, and it goes on by itself.
+    // 2. This becomes invalid, the future is fulfilled once the task ends.
+    // 3. Cancelling the future doesn't stop the task, its result is dropped.
+    Future<ValueType> start(const FutureExecutor &executor = FutureExecutor());
+
+    _TaskAwaiter<T> operator co_await() const;
+
+  private:
+    std::coroutine_handle<promise_type> handle;
+
+    Task(std::coroutine_handle<promise_type> handle);
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    Task(const Task &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    Task &operator=(const Task &);
+
+    friend class _TaskPromise<T>;
+};
+
+// co_await Tasks::resumeOn().
+class _TaskResumeAwaiter
+{
+  public:
+    _TaskResumeAwaiter(const FutureExecutor &_executor) : executor(_executor), result(MIO_GENERAL_OK)
+    {
+    }
+
+    bool await_ready(void)
+    {
+        return executor.isInline();
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle);
+
+    int await_resume(void)
+    {
+        return result;
+    }
+
+  private:
+    const FutureExecutor executor;
+    int result;
+};
+
+// co_await Tasks::sleep().
+class _TaskSleepAwaiter
+{
+  public:
+    _TaskSleepAwaiter(int _ms, const FutureExecutor &_executor) :
+        timer(_fire, this), ms(_ms), executor(_executor), result(MIO_GENERAL_OK)
+    {
+    }
+
+    bool await_ready(void)
+    {
+        return ms <= 0;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle);
+
+    int await_resume(void)
+    {
+        return result;
+    }
+
+  private:
+    // The destructor waits for _fire(), which may still be returning when the coroutine is resumed on a pool.
+    TimingWheelTimer timer;
+    const int ms;
+    const FutureExecutor executor;
+    std::coroutine_handle<> handle;
+    int result;
+
+    // On the wheel thread.
+    static int _fire(void *context);
+};
+
+class _TaskFdPoller;
+
+struct _TaskFdLink
+{
+    _TaskFdLink *prev;
+    _TaskFdLink *next;
+};
+
+// co_await Tasks::waitReadable() and Tasks::waitWritable(), the links are owned by the poller between
+// await_suspend() and the resumption.
+class _TaskFdAwaiter : private _TaskFdLink
+{
+  public:
+    _TaskFdAwaiter(int fd, bool isWritable, int timeoutMS, const FutureExecutor &executor);
+
+    // A ready descriptor doesn't need the poller, so it is polled once first.
+    bool await_ready(void);
+    bool await_suspend(std::coroutine_handle<> handle);
+
+    int await_resume(void)
+    {
+        return result;
+    }
+
+  private:
+    const int fd;
+    const bool isWritable;
+    // CLOCK_MONOTONIC, 0 for no timeout.
+    int64_t deadlineNS;
+    const FutureExecutor executor;
+    std::coroutine_handle<> handle;
+    int result;
+
+    friend class _TaskFdPoller;
+};
+
+// One epoll thread for the fd awaiters of the process.
+class _TaskFdPoller
+{
+  public:
+    static _TaskFdPoller *getInstance(void);
+
+    // Return MIO_ERR_IO_GENERAL if the poller thread cannot be created.
+    int add(_TaskFdAwaiter *awaiter);
+
+  private:
+    static const int EVENT_BATCH = 64;
+
+    int epollFD;
+    int eventFD;
+    OsalMutex mutex;
+    // Added, not registered yet, protected by mutex, linked by next.
+    _TaskFdAwaiter *incoming;
+    // Registered, on the poller thread only.
+    _TaskFdLink waiting;
+
+    _TaskFdPoller(void);
+    // Never deleted.
+    ~_TaskFdPoller();
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    _TaskFdPoller(const _TaskFdPoller &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    _TaskFdPoller &operator=(const _TaskFdPoller &);
+
+    void runPoller(void);
+    void registerIncoming(void);
+    // Return the epoll_wait() timeout after completing expired awaiters.
+    int expireWaiting(void);
+    // Unregister a registered awaiter, and resume it.
+    void complete(_TaskFdAwaiter *awaiter, int result);
+    static int _threadEntry(void *context);
+};
+
+class _TaskEventAwaiter;
+
+/*!
+ * @brief Manual-reset event for tasks, the coroutine counterpart of waiting an OsalCondVar for a flag.
+ *
+ * @remarks
+ *   1. co_await event suspends the task until set(), it doesn't suspend if the event is set already.
+ *   2. set() resumes all waiting tasks, inline on the thread which calls set() by default, or on the executor
+ *      of wait(executor).  It stays set until reset().
+ *   3. set(), reset() and waiting are lock-free and allocation-free.
+ *   4. Tasks still waiting when the event is destroyed are never resumed.
+ */
+class TaskEvent
+{
+  public:
+    TaskEvent(bool isSet = false);
+
+    /*!
+     * Destructor.
+     */
+    ~TaskEvent();
+
+    bool isSet(void) const;
+    void set(void);
+    void reset(void);
+    _TaskEventAwaiter wait(const FutureExecutor &executor = FutureExecutor());
+    _TaskEventAwaiter operator co_await();
+
+  private:
+    // this if it is set, otherwise the last waiting awaiter (linked to earlier ones), or null.
+    std::atomic<void *> state;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    TaskEvent(const TaskEvent &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    TaskEvent &operator=(const TaskEvent &);
+
+    friend class _TaskEventAwaiter;
+};
+
+class _TaskEventAwaiter
+{
+  public:
+    _TaskEventAwaiter(TaskEvent *_event, const FutureExecutor &_executor) :
+        event(_event), executor(_executor), nextAwaiter(0)
+    {
+    }
+
+    bool await_ready(void)
+    {
+        return event->isSet();
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle);
+
+    void await_resume(void)
+    {
+    }
+
+  private:
+    TaskEvent *const event;
+    const FutureExecutor executor;
+    std::coroutine_handle<> handle;
+    _TaskEventAwaiter *nextAwaiter;
+
+    friend class TaskEvent;
+};
+
+// co_await future, return MIO_GENERAL_OK if it is fulfilled, the value is got by future.getValue().
+template <class T>
+class _TaskFutureAwaiter : public _FutureCallback
+{
+  public:
+    _TaskFutureAwaiter(const Future<T> &future);
+    ~_TaskFutureAwaiter();
+
+    bool await_ready(void);
+    bool await_suspend(std::coroutine_handle<> handle);
+    int await_resume(void);
+
+    // Inline on the thread which completes the future.
+    virtual void onComplete(_FutureStateBase *source);
+
+  private:
+    _FutureState<T> *const state;
+    std::coroutine_handle<> handle;
+    // Whichever of await_suspend() and onComplete() comes later resumes the coroutine.
+    std::atomic<bool> isDecided;
+};
+
+template <class T>
+_TaskFutureAwaiter<T> operator co_await(const Future<T> &future);
+
+/*!
+ * @brief Awaitables of tasks, see Task.
+ */
+class Tasks
+{
+  public:
+    // 1. Continue on executor, for example, co_await Tasks::resumeOn(TASK_PRIORITY_BACKGROUND).
+    // 2. Return the error of executor if it cannot take the task, which goes on inline.
+    static _TaskResumeAwaiter resumeOn(const FutureExecutor &executor);
+    // 1. Suspend for ms milliseconds, at the TimingWheel resolution.
+    // 2. The task goes on on executor, inline means on the wheel thread, which should be short.
+    static _TaskSleepAwaiter sleep(int ms, const FutureExecutor &executor = FutureExecutor::globalPool());
+    // 1. Return MIO_GENERAL_OK if fd is readable (or writable), MIO_ERR_TIMEOUT, or MIO_ERR_IO_CLOSED if fd
+    //    errs or hangs up.
+    // 2. timeoutMS <= 0 for no timeout.
+    // 3. The task goes on on executor, inline means on the epoll thread, which should be short.
+    // 4. One task waits a file descriptor at a time, others get MIO_ERR_INCORRECT_STATUS.
+    static _TaskFdAwaiter waitReadable(int fd, int timeoutMS = 0,
+                                       const FutureExecutor &executor = FutureExecutor::globalPool());
+    static _TaskFdAwaiter waitWritable(int fd, int timeoutMS = 0,
+                                       const FutureExecutor &executor = FutureExecutor::globalPool());
+
+  private:
+    // Private constructor is declared but not defined to prevent instantiation.
+    Tasks(void);
+};
+
+/* Implementation for _TaskResumer */
+
+inline void _TaskResumer::resume(const FutureExecutor &executor, std::coroutine_handle<> handle)
+{
+    if(!executor.isInline())
+    {
+        RunnableBridge *bridge = new RunnableBridge(_resume, handle.address());
+        int result = executor.execute(bridge);
+        bridge->deref();
+        if(result == MIO_GENERAL_OK)
+        {
+            return;
+        }
+    }
+    handle.resume();
+}
+
+inline int _TaskResumer::_resume(void *address)
+{
+    std::coroutine_handle<>::from_address(address).resume();
+    return MIO_GENERAL_OK;
+}
+
+/* Implementation for _TaskFinalAwaiter */
+
+template <class P>
+std::coroutine_handle<> _TaskFinalAwaiter::await_suspend(std::coroutine_handle<P> handle) noexcept
+{
+    P &promise = handle.promise();
+    if(promise.continuation)
+    {
+        return promise.continuation;
+    }
+    // Started, nobody holds it any more.
+    promise.completeDetached();
+    handle.destroy();
+    return std::noop_coroutine();
+}
+
+/* Implementation for _TaskPromise */
+
+template <class T>
+_TaskPromise<T>::~_TaskPromise()
+{
+    if(hasValue)
+    {
+        ((T *) storage)->~T();
+    }
+}
+
+template <class T>
+Task<T> _TaskPromise<T>::get_return_object(void)
+{
+    return Task<T>(std::coroutine_handle<_TaskPromise<T> >::from_promise(*this));
+}
+
+inline Task<void> _TaskPromise<void>::get_return_object(void)
+{
+    return Task<void>(std::coroutine_handle<_TaskPromise<void> >::from_promise(*this));
+}
+
+/* Implementation for Task */
+
+template <class T>
+Task<T>::Task(void) : handle()
+{
+}
+
+template <class T>
+Task<T>::Task(std::coroutine_handle<promise_type> _handle) : handle(_handle)
+{
+}
+
+template <class T>
+Task<T>::Task(Task &&another) : handle(another.handle)
+{
+    another.handle = 0;
+}
+
+template <class T>
+Task<T> &Task<T>::operator=(Task &&another)
+{
+    if(this != &another)
+    {
+        if(handle)
+        {
+            handle.destroy();
+        }
+        handle = another.handle;
+        another.handle = 0;
+    }
+    return *this;
+}
+
+template <class T>
+Task<T>::~Task()
+{
+    if(handle)
+    {
+        handle.destroy();
+    }
+}
+
+template <class T>
+bool Task<T>::isValid(void) const
+{
+    return (bool) handle;
+}
+
+template <class T>
+Future<typename Task<T>::ValueType> Task<T>::start(const FutureExecutor &executor)
+{
+    if(!handle)
+    {
+        return Future<ValueType>();
+    }
+    // One reference for the future, one for the task.
+    _FutureState<ValueType> *state = new _FutureState<ValueType>();
+    state->ref();
+    handle.promise().futureState = state;
+    std::coroutine_handle<promise_type> started = handle;
+    handle = 0;
+    if(executor.isInline())
+    {
+        started.resume();
+    }
+    else
+    {
+        RunnableBridge *bridge = new RunnableBridge(_TaskResumer::_resume, started.address());
+        int result = executor.execute(bridge);
+        bridge->deref();
+        if(result != MIO_GENERAL_OK)
+        {
+            state->fail(result);
+            state->deref();
+            started.destroy();
+        }
+    }
+    return Future<ValueType>(state);
+}
+
+template <class T>
+_TaskAwaiter<T> Task<T>::operator co_await() const
+{
+    return _TaskAwaiter<T>(handle);
+}
+
+/* Implementation for _TaskResumeAwaiter */
+
+inline bool _TaskResumeAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    RunnableBridge *bridge = new RunnableBridge(_TaskResumer::_resume, handle.address());
+    int executeResult = executor.execute(bridge);
+    bridge->deref();
+    // It may be running on the pool already, so this is touched only if it is not.
+    if(executeResult != MIO_GENERAL_OK)
+    {
+        result = executeResult;
+        return false;
+    }
+    return true;
+}
+
+/* Implementation for _TaskSleepAwaiter */
+
+inline bool _TaskSleepAwaiter::await_suspend(std::coroutine_handle<> _handle)
+{
+    handle = _handle;
+    int scheduleResult = timer.schedule(ms);
+    if(scheduleResult != MIO_GENERAL_OK)
+    {
+        result = scheduleResult;
+        return false;
+    }
+    return true;
+}
+
+inline int _TaskSleepAwaiter::_fire(void *context)
+{
+    _TaskSleepAwaiter *awaiter = (_TaskSleepAwaiter *) context;
+    _TaskResumer::resume(awaiter->executor, awaiter->handle);
+    return MIO_GENERAL_OK;
+}
+
+/* Implementation for _TaskFdAwaiter */
+
+inline _TaskFdAwaiter::_TaskFdAwaiter(int _fd, bool _isWritable, int timeoutMS, const FutureExecutor &_executor) :
+    fd(_fd), isWritable(_isWritable), deadlineNS(0), executor(_executor), result(MIO_GENERAL_OK)
+{
+    prev = next = 0;
+    if(timeoutMS > 0)
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        deadlineNS = now.tv_sec * 1000000000LL + now.tv_nsec + timeoutMS * 1000000LL;
+    }
+}
+
+inline bool _TaskFdAwaiter::await_ready(void)
+{
+    struct pollfd pollFD;
+    pollFD.fd = fd;
+    pollFD.events = isWritable ? POLLOUT : POLLIN;
+    pollFD.revents = 0;
+    if(poll(&pollFD, 1, 0) <= 0)
+    {
+        return false;
+    }
+    if(pollFD.revents & pollFD.events)
+    {
+        result = MIO_GENERAL_OK;
+    }
+    else if(pollFD.revents & POLLNVAL)
+    {
+        result = MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    else
+    {
+        result = MIO_ERR_IO_CLOSED;
+    }
+    return true;
+}
+
+inline bool _TaskFdAwaiter::await_suspend(std::coroutine_handle<> _handle)
+{
+    handle = _handle;
+    int addResult = _TaskFdPoller::getInstance()->add(this);
+    if(addResult != MIO_GENERAL_OK)
+    {
+        result = addResult;
+        return false;
+    }
+    return true;
+}
+
+/* Implementation for _TaskFdPoller */
+
+inline _TaskFdPoller *_TaskFdPoller::getInstance(void)
+{
+    // Never deleted, awaiters may still be waiting at exit.
+    static _TaskFdPoller *poller = new _TaskFdPoller();
+    return poller;
+}
+
+inline int _TaskFdPoller::add(_TaskFdAwaiter *awaiter)
+{
+    if(eventFD < 0)
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    mutex.lock();
+    awaiter->next = incoming;
+    incoming = awaiter;
+    mutex.unlock();
+    // awaiter may be resumed from here.
+    uint64_t one = 1;
+    while((write(eventFD, &one, sizeof(one)) < 0) && (errno == EINTR))
+    {
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline _TaskFdPoller::_TaskFdPoller(void) :
+    epollFD(epoll_create1(EPOLL_CLOEXEC)), eventFD(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)), incoming(0)
+{
+    waiting.prev = waiting.next = &waiting;
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = 0;
+    if((epollFD < 0) || (eventFD < 0) || (epoll_ctl(epollFD, EPOLL_CTL_ADD, eventFD, &event) != 0) ||
+       (Thread::startThread(_threadEntry, this) != MIO_GENERAL_OK))
+    {
+        if(epollFD >= 0)
+        {
+            close(epollFD);
+        }
+        if(eventFD >= 0)
+        {
+            close(eventFD);
+        }
+        epollFD = eventFD = -1;
+    }
+}
+
+inline _TaskFdPoller::~_TaskFdPoller()
+{
+}
+
+inline void _TaskFdPoller::runPoller(void)
+{
+    struct epoll_event events[EVENT_BATCH];
+    for(;;)
+    {
+        registerIncoming();
+        int count = epoll_wait(epollFD, events, EVENT_BATCH, expireWaiting());
+        for(int i = 0; i < count; ++i)
+        {
+            _TaskFdAwaiter *awaiter = (_TaskFdAwaiter *) events[i].data.ptr;
+            if(!awaiter)
+            {
+                uint64_t value;
+                while(read(eventFD, &value, sizeof(value)) == sizeof(value))
+                {
+                }
+                continue;
+            }
+            uint32_t requested = awaiter->isWritable ? EPOLLOUT : EPOLLIN;
+            complete(awaiter, (events[i].events & requested) ? MIO_GENERAL_OK : MIO_ERR_IO_CLOSED);
+        }
+    }
+}
+
+inline void _TaskFdPoller::registerIncoming(void)
+{
+    mutex.lock();
+    _TaskFdAwaiter *awaiter = incoming;
+    incoming = 0;
+    mutex.unlock();
+    while(awaiter)
+    {
+        _TaskFdAwaiter *nextAwaiter = (_TaskFdAwaiter *) awaiter->next;
+        struct epoll_event event;
+        event.events = (awaiter->isWritable ? EPOLLOUT : EPOLLIN) | EPOLLONESHOT;
+        event.data.ptr = awaiter;
+        if(epoll_ctl(epollFD, EPOLL_CTL_ADD, awaiter->fd, &event) == 0)
+        {
+            awaiter->prev = waiting.prev;
+            awaiter->next = &waiting;
+            waiting.prev->next = awaiter;
+            waiting.prev = awaiter;
+        }
+        else
+        {
+            // Regular files cannot be polled, and they are always ready.  The registration of EEXIST belongs to
+            // another awaiter.
+            int error = errno;
+            awaiter->result = (error == EPERM)    ? MIO_GENERAL_OK :
+                              (error == EEXIST) ? MIO_ERR_INCORRECT_STATUS :
+                                                  MIO_ERR_ILLEGAL_PARAMETERS;
+            _TaskResumer::resume(awaiter->executor, awaiter->handle);
+        }
+        awaiter = nextAwaiter;
+    }
+}
+
+inline int _TaskFdPoller::expireWaiting(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t nowNS = now.tv_sec * 1000000000LL + now.tv_nsec;
+    int64_t nearestNS = INT64_MAX;
+    _TaskFdLink *link = waiting.next;
+    while(link != &waiting)
+    {
+        _TaskFdAwaiter *awaiter = (_TaskFdAwaiter *) link;
+        link = link->next;
+        if(awaiter->deadlineNS != 0)
+        {
+            if(awaiter->deadlineNS <= nowNS)
+            {
+                complete(awaiter, MIO_ERR_TIMEOUT);
+            }
+            else if(awaiter->deadlineNS < nearestNS)
+            {
+                nearestNS = awaiter->deadlineNS;
+            }
+        }
+    }
+    if(nearestNS == INT64_MAX)
+    {
+        return -1;
+    }
+    // Rounded up, so it doesn't wake up right before the deadline.
+    return (int) ((nearestNS - nowNS + 999999) / 1000000);
+}
+
+inline void _TaskFdPoller::complete(_TaskFdAwaiter *awaiter, int result)
+{
+    // Before resuming, the task may close fd once it goes on.
+    epoll_ctl(epollFD, EPOLL_CTL_DEL, awaiter->fd, 0);
+    awaiter->prev->next = awaiter->next;
+    awaiter->next->prev = awaiter->prev;
+    awaiter->result = result;
+    _TaskResumer::resume(awaiter->executor, awaiter->handle);
+}
+
+inline int _TaskFdPoller::_threadEntry(void *context)
+{
+    ((_TaskFdPoller *) context)->runPoller();
+    return MIO_GENERAL_OK;
+}
+
+/* Implementation for TaskEvent */
+
+inline TaskEvent::TaskEvent(bool isSet) : state(isSet ? this : 0)
+{
+}
+
+inline TaskEvent::~TaskEvent()
+{
+}
+
+inline bool TaskEvent::isSet(void) const
+{
+    return state.load(std::memory_order_acquire) == this;
+}
+
+inline void TaskEvent::set(void)
+{
+    void *previous = state.exchange(this, std::memory_order_acq_rel);
+    if(previous == this)
+    {
+        return;
+    }
+    // Waiting awaiters are linked from the last one, they are resumed in the order of waiting.
+    _TaskEventAwaiter *reversed = 0;
+    _TaskEventAwaiter *awaiter = (_TaskEventAwaiter *) previous;
+    while(awaiter)
+    {
+        _TaskEventAwaiter *nextAwaiter = awaiter->nextAwaiter;
+        awaiter->nextAwaiter = reversed;
+        reversed = awaiter;
+        awaiter = nextAwaiter;
+    }
+    while(reversed)
+    {
+        _TaskEventAwaiter *nextAwaiter = reversed->nextAwaiter;
+        _TaskResumer::resume(reversed->executor, reversed->handle);
+        reversed = nextAwaiter;
+    }
+}
+
+inline void TaskEvent::reset(void)
+{
+    void *expected = this;
+    state.compare_exchange_strong(expected, 0, std::memory_order_relaxed);
+}
+
+inline _TaskEventAwaiter TaskEvent::wait(const FutureExecutor &executor)
+{
+    return _TaskEventAwaiter(this, executor);
+}
+
+inline _TaskEventAwaiter TaskEvent::operator co_await()
+{
+    return _TaskEventAwaiter(this, FutureExecutor());
+}
+
+/* Implementation for _TaskEventAwaiter */
+
+inline bool _TaskEventAwaiter::await_suspend(std::coroutine_handle<> _handle)
+{
+    handle = _handle;
+    void *previous = event->state.load(std::memory_order_acquire);
+    do
+    {
+        if(previous == event)
+        {
+            return false;
+        }
+        nextAwaiter = (_TaskEventAwaiter *) previous;
+    } while(!event->state.compare_exchange_weak(previous, this, std::memory_order_release,
+                                                std::memory_order_acquire));
+    return true;
+}
+
+/* Implementation for _TaskFutureAwaiter */
+
+template <class T>
+_TaskFutureAwaiter<T>::_TaskFutureAwaiter(const Future<T> &future) : state(future.state), isDecided(false)
+{
+    if(state)
+    {
+        state->ref();
+    }
+}
+
+template <class T>
+_TaskFutureAwaiter<T>::~_TaskFutureAwaiter()
+{
+    if(state)
+    {
+        state->deref();
+    }
+}
+
+template <class T>
+bool _TaskFutureAwaiter<T>::await_ready(void)
+{
+    return !state || state->isCompleted();
+}
+
+template <class T>
+bool _TaskFutureAwaiter<T>::await_suspend(std::coroutine_handle<> _handle)
+{
+    handle = _handle;
+    state->addCallback(this);
+    // onComplete() is called already if the future is completed in between.
+    return !isDecided.exchange(true, std::memory_order_acq_rel);
+}
+
+template <class T>
+int _TaskFutureAwaiter<T>::await_resume(void)
+{
+    return state ? state->getErrorCode() : MIO_ERR_INCORRECT_STATUS;
+}
+
+template <class T>
+void _TaskFutureAwaiter<T>::onComplete(_FutureStateBase *)
+{
+    if(isDecided.exchange(true, std::memory_order_acq_rel))
+    {
+        handle.resume();
+    }
+}
+
+template <class T>
+_TaskFutureAwaiter<T> operator co_await(const Future<T> &future)
+{
+    return _TaskFutureAwaiter<T>(future);
+}
+
+/* Implementation for Tasks */
+
+inline _TaskResumeAwaiter Tasks::resumeOn(const FutureExecutor &executor)
+{
+    return _TaskResumeAwaiter(executor);
+}
+
+inline _TaskSleepAwaiter Tasks::sleep(int ms, const FutureExecutor &executor)
+{
+    return _TaskSleepAwaiter(ms, executor);
+}
+
+inline _TaskFdAwaiter Tasks::waitReadable(int fd, int timeoutMS, const FutureExecutor &executor)
+{
+    return _TaskFdAwaiter(fd, false, timeoutMS, executor);
+}
+
+inline _TaskFdAwaiter Tasks::waitWritable(int fd, int timeoutMS, const FutureExecutor &executor)
+{
+    return _TaskFdAwaiter(fd, true, timeoutMS, executor);
+}
+
+#endif//_TASK_TASK_H
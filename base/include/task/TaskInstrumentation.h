@@ -0,0 +1,626 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/TaskInstrumentation.h                                                                  *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Optional per work item accounting (wait and run time by entry or Runnable type) of pools.   *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_TASK_INSTRUMENTATION_H
+#define _TASK_TASK_INSTRUMENTATION_H
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <atomic>
+#include <cxxabi.h>
+#include <typeinfo>
+// libBase includes
+#include <baseResultCode.h>
+#include <container/List.h>
+#include <log/LogSystem.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+#include <task/Runnable.h>
+#include <task/RunnableBridge.h>
+#include <task/TimingWheel.h>
+
+// 16 linear sub-buckets per power of 2, about 6% precision.
+#define TASK_HISTOGRAM_SUB_BITS             4
+#define TASK_HISTOGRAM_SUB_COUNT            (1 << TASK_HISTOGRAM_SUB_BITS)
+// Up to 2^32 us (71 minutes), larger values are counted in the last bucket.
+#define TASK_HISTOGRAM_BUCKETS              ((32 - TASK_HISTOGRAM_SUB_BITS + 1) * TASK_HISTOGRAM_SUB_COUNT)
+// Distinct entries and Runnable types, the rest are accounted as "(others)".
+#define TASK_INSTRUMENTATION_MAX_KEYS       256
+#define TASK_STATS_NAME_LEN                 96
+#define TASK_STATS_LOG_TAG                  "TaskStats"
+
+/*!
+ * @brief HDR-style histogram of microseconds, recording is lock-free and wait-free.
+ *
+ * @remarks
+ *   1. Buckets are log-linear, a percentile is the upper bound of its bucket, within about 6%.
+ *   2. Readers see counters which may be updated meanwhile, percentiles are taken from one copy of them.
+ */
+class TaskHistogram
+{
+  public:
+    TaskHistogram(void);
+
+    void add(uint64_t valueUS);
+    void reset(void);
+    uint64_t getCount(void) const;
+    uint64_t getSumUS(void) const;
+    uint64_t getMaxUS(void) const;
+    // 1. ratio is 0 ~ 1, for example 0.99.
+    // 2. The upper bound of the bucket, but not more than getMaxUS().
+    uint64_t percentile(double ratio) const;
+
+    static int bucketOf(uint64_t valueUS);
+    // Upper bound of the bucket.
+    static uint64_t valueOf(int bucket);
+
+  private:
+    std::atomic<uint32_t> counts[TASK_HISTOGRAM_BUCKETS];
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sumUS;
+    std::atomic<uint64_t> maxUS;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    TaskHistogram(const TaskHistogram &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    TaskHistogram &operator=(const TaskHistogram &);
+};
+
+// Accounting of a work item key, from the start to the end of the enqueued-to-run life.
+struct TaskStatsSnapshot
+{
+    // Demangled Runnable type, the name of setEntryName(), or the entry address.
+    char name[TASK_STATS_NAME_LEN];
+    uint64_t count;
+    // From executeTaskItem() (or its afterMS) to run.
+    uint64_t totalWaitUS;
+    uint64_t p50WaitUS;
+    uint64_t p99WaitUS;
+    uint64_t maxWaitUS;
+    uint64_t totalRunUS;
+    uint64_t p50RunUS;
+    uint64_t p99RunUS;
+    uint64_t maxRunUS;
+};
+
+// Accounting of a key, never deleted once added.
+struct _TaskStatsSlot
+{
+    // Entry address, or the std::type_info of the Runnable, 0 for others.
+    const void *key;
+    bool isEntry;
+    std::atomic<const char *> name;
+    TaskHistogram waitHistogram;
+    TaskHistogram runHistogram;
+
+    _TaskStatsSlot(const void *_key, bool _isEntry) : key(_key), isEntry(_isEntry), name(0)
+    {
+    }
+};
+
+class _TaskStatsDumper;
+
+/*!
+ * @brief Optional accounting of work items, to find which ones starve pools.
+ *
+ * @remarks
+ *   1. Disabled by default, then the cost is a relaxed load per executeTaskItem().  Once enabled, a work item
+ *      costs an allocation, 3 clock reads and a few atomic adds, under 1% of work items of 50 us or more.
+ *   2. Work items are accounted by their entries, or Runnable types, with wait time (from executeTaskItem(),
+ *      or its afterMS, to run) and run time.
+ *   3. WorkStealingThreadPool, AttributedThreadPool, TaskLanes, and futures on them are accounted.  ThreadPool
+ *      and GlobalThreadPool are not, a work item of them is accounted if it is wrapped:
+ *          Runnable *workItem = TaskInstrumentation::wrap(_decodeFrame, this);
+ *          pool.executeTaskItem(workItem);
+ *          workItem->deref();
+ *   4. snapshot() reads the accounting, startDump() logs it periodically by LogSystem with tag "TaskStats".
+ */
+class TaskInstrumentation
+{
+  public:
+    static void setEnabled(bool isEnabled);
+    static bool isEnabled(void);
+    // Name of entry in snapshots instead of its address, name must live forever (a literal for example).
+    static void setEntryName(int (*entry)(void *), const char *name);
+
+    // 1. Return the work item to be passed to pools, it should be deref() after that.
+    // 2. If disabled, workItem itself (ref()), or a RunnableBridge, is returned.
+    // 3. Waiting is accounted from afterMS later, for delayed executions.
+    static Runnable *wrap(Runnable *workItem, int afterMS = 0);
+    static Runnable *wrap(int (*entry)(void *), void *context, int afterMS = 0);
+    // Accounting of a work item which is run by the caller itself.
+    static void record(const void *key, bool isEntry, uint64_t waitUS, uint64_t runUS);
+
+    // Keys ordered by total run time, descending.
+    static int snapshot(List<TaskStatsSnapshot> &snapshotsHolder);
+    static void reset(void);
+    // 1. Log the top maxKeys keys every periodMS, as a work item of GlobalThreadPool.
+    // 2. If shouldReset, a dump covers the period since the previous one, instead of since reset().
+    static int startDump(int periodMS, int maxKeys = 10, bool shouldReset = true);
+    static void stopDump(void);
+
+    static uint64_t nowUS(void);
+
+  private:
+    std::atomic<bool> enabled;
+    std::atomic<_TaskStatsSlot *> slots[TASK_INSTRUMENTATION_MAX_KEYS];
+    _TaskStatsSlot others;
+    OsalMutex dumpMutex;
+    // Protected by dumpMutex.
+    _TaskStatsDumper *dumper;
+
+    TaskInstrumentation(void);
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    TaskInstrumentation(const TaskInstrumentation &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    TaskInstrumentation &operator=(const TaskInstrumentation &);
+
+    static TaskInstrumentation *getInstance(void);
+    _TaskStatsSlot *find(const void *key, bool isEntry);
+    static void nameOf(const _TaskStatsSlot *slot, char *buffer, int bufferLen);
+};
+
+// Accounted wrapper of a work item.
+class _TaskInstrumentedItem : public Runnable
+{
+  public:
+    _TaskInstrumentedItem(Runnable *_workItem, int (*_entry)(void *), void *_context, int afterMS) :
+        workItem(_workItem), entry(_entry), context(_context),
+        dueUS(TaskInstrumentation::nowUS() + ((afterMS > 0) ? afterMS * 1000ULL : 0))
+    {
+        if(workItem)
+        {
+            workItem->ref();
+        }
+    }
+
+    virtual int run(void);
+
+  protected:
+    virtual ~_TaskInstrumentedItem()
+    {
+        if(workItem)
+        {
+            workItem->deref();
+        }
+    }
+
+  private:
+    Runnable *const workItem;
+    int (*const entry)(void *);
+    void *const context;
+    const uint64_t dueUS;
+};
+
+// Dumps as a work item of GlobalThreadPool, fired by the timing wheel.
+class _TaskStatsDumper : public Runnable
+{
+  public:
+    _TaskStatsDumper(int _periodMS, int _maxKeys, bool _shouldReset) :
+        timer(_fire, this), periodMS(_periodMS), maxKeys(_maxKeys), shouldReset(_shouldReset), isStopped(false),
+        isDumping(false)
+    {
+    }
+
+    int start(void);
+    // No more dumps after it returns, except a running one.
+    void stop(void);
+
+    virtual int run(void);
+
+  private:
+    TimingWheelTimer timer;
+    const int periodMS;
+    const int maxKeys;
+    const bool shouldReset;
+    std::atomic<bool> isStopped;
+    // A slow dump skips the next ones, instead of piling up.
+    std::atomic<bool> isDumping;
+
+    // On the wheel thread.
+    static int _fire(void *context);
+};
+
+/* Implementation for TaskHistogram */
+
+inline TaskHistogram::TaskHistogram(void) : count(0), sumUS(0), maxUS(0)
+{
+    for(int i = 0; i < TASK_HISTOGRAM_BUCKETS; ++i)
+    {
+        counts[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+inline void TaskHistogram::add(uint64_t valueUS)
+{
+    counts[bucketOf(valueUS)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sumUS.fetch_add(valueUS, std::memory_order_relaxed);
+    uint64_t previousMax = maxUS.load(std::memory_order_relaxed);
+    while((valueUS > previousMax) &&
+          !maxUS.compare_exchange_weak(previousMax, valueUS, std::memory_order_relaxed))
+    {
+    }
+}
+
+inline void TaskHistogram::reset(void)
+{
+    for(int i = 0; i < TASK_HISTOGRAM_BUCKETS; ++i)
+    {
+        counts[i].store(0, std::memory_order_relaxed);
+    }
+    count.store(0, std::memory_order_relaxed);
+    sumUS.store(0, std::memory_order_relaxed);
+    maxUS.store(0, std::memory_order_relaxed);
+}
+
+inline uint64_t TaskHistogram::getCount(void) const
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+inline uint64_t TaskHistogram::getSumUS(void) const
+{
+    return sumUS.load(std::memory_order_relaxed);
+}
+
+inline uint64_t TaskHistogram::getMaxUS(void) const
+{
+    return maxUS.load(std::memory_order_relaxed);
+}
+
+inline uint64_t TaskHistogram::percentile(double ratio) const
+{
+    uint32_t copied[TASK_HISTOGRAM_BUCKETS];
+    uint64_t total = 0;
+    for(int i = 0; i < TASK_HISTOGRAM_BUCKETS; ++i)
+    {
+        copied[i] = counts[i].load(std::memory_order_relaxed);
+        total += copied[i];
+    }
+    uint64_t rank = (uint64_t) (total * ratio);
+    uint64_t seen = 0;
+    for(int i = 0; i < TASK_HISTOGRAM_BUCKETS; ++i)
+    {
+        seen += copied[i];
+        if(seen > rank)
+        {
+            uint64_t value = valueOf(i);
+            uint64_t maxValue = getMaxUS();
+            return (value < maxValue) ? value : maxValue;
+        }
+    }
+    return 0;
+}
+
+inline int TaskHistogram::bucketOf(uint64_t valueUS)
+{
+    if(valueUS < TASK_HISTOGRAM_SUB_COUNT)
+    {
+        return (int) valueUS;
+    }
+    int msb = 63 - __builtin_clzll(valueUS);
+    if(msb >= 32)
+    {
+        return TASK_HISTOGRAM_BUCKETS - 1;
+    }
+    int sub = (int) (valueUS >> (msb - TASK_HISTOGRAM_SUB_BITS)) & (TASK_HISTOGRAM_SUB_COUNT - 1);
+    return (msb - TASK_HISTOGRAM_SUB_BITS + 1) * TASK_HISTOGRAM_SUB_COUNT + sub;
+}
+
+inline uint64_t TaskHistogram::valueOf(int bucket)
+{
+    if(bucket < TASK_HISTOGRAM_SUB_COUNT)
+    {
+        return bucket;
+    }
+    int msb = bucket / TASK_HISTOGRAM_SUB_COUNT + TASK_HISTOGRAM_SUB_BITS - 1;
+    uint64_t sub = bucket % TASK_HISTOGRAM_SUB_COUNT;
+    return ((TASK_HISTOGRAM_SUB_COUNT + sub + 1) << (msb - TASK_HISTOGRAM_SUB_BITS)) - 1;
+}
+
+/* Implementation for TaskInstrumentation */
+
+inline TaskInstrumentation::TaskInstrumentation(void) : enabled(false), others(0, false), dumper(0)
+{
+    others.name.store("(others)", std::memory_order_relaxed);
+    for(int i = 0; i < TASK_INSTRUMENTATION_MAX_KEYS; ++i)
+    {
+        slots[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+inline TaskInstrumentation *TaskInstrumentation::getInstance(void)
+{
+    // Never deleted, work items may still be running at exit.
+    static TaskInstrumentation *instrumentation = new TaskInstrumentation();
+    return instrumentation;
+}
+
+inline void TaskInstrumentation::setEnabled(bool isEnabled)
+{
+    getInstance()->enabled.store(isEnabled, std::memory_order_relaxed);
+}
+
+inline bool TaskInstrumentation::isEnabled(void)
+{
+    return getInstance()->enabled.load(std::memory_order_relaxed);
+}
+
+inline void TaskInstrumentation::setEntryName(int (*entry)(void *), const char *name)
+{
+    TaskInstrumentation *instrumentation = getInstance();
+    _TaskStatsSlot *slot = instrumentation->find((const void *) entry, true);
+    if(slot != &instrumentation->others)
+    {
+        slot->name.store(name, std::memory_order_release);
+    }
+}
+
+inline Runnable *TaskInstrumentation::wrap(Runnable *workItem, int afterMS)
+{
+    if(!isEnabled())
+    {
+        workItem->ref();
+        return workItem;
+    }
+    return new _TaskInstrumentedItem(workItem, 0, 0, afterMS);
+}
+
+inline Runnable *TaskInstrumentation::wrap(int (*entry)(void *), void *context, int afterMS)
+{
+    if(!isEnabled())
+    {
+        return new RunnableBridge(entry, context);
+    }
+    return new _TaskInstrumentedItem(0, entry, context, afterMS);
+}
+
+inline void TaskInstrumentation::record(const void *key, bool isEntry, uint64_t waitUS, uint64_t runUS)
+{
+    _TaskStatsSlot *slot = getInstance()->find(key, isEntry);
+    slot->waitHistogram.add(waitUS);
+    slot->runHistogram.add(runUS);
+}
+
+inline int TaskInstrumentation::snapshot(List<TaskStatsSnapshot> &snapshotsHolder)
+{
+    TaskInstrumentation *instrumentation = getInstance();
+    TaskStatsSnapshot *snapshots = new TaskStatsSnapshot[TASK_INSTRUMENTATION_MAX_KEYS + 1];
+    int snapshotCount = 0;
+    for(int i = 0; i <= TASK_INSTRUMENTATION_MAX_KEYS; ++i)
+    {
+        const _TaskStatsSlot *slot = (i < TASK_INSTRUMENTATION_MAX_KEYS) ?
+                                     instrumentation->slots[i].load(std::memory_order_acquire) :
+                                     &instrumentation->others;
+        if(!slot || (slot->runHistogram.getCount() == 0))
+        {
+            continue;
+        }
+        TaskStatsSnapshot &snapshot = snapshots[snapshotCount++];
+        nameOf(slot, snapshot.name, sizeof(snapshot.name));
+        snapshot.count = slot->runHistogram.getCount();
+        snapshot.totalWaitUS = slot->waitHistogram.getSumUS();
+        snapshot.p50WaitUS = slot->waitHistogram.percentile(0.5);
+        snapshot.p99WaitUS = slot->waitHistogram.percentile(0.99);
+        snapshot.maxWaitUS = slot->waitHistogram.getMaxUS();
+        snapshot.totalRunUS = slot->runHistogram.getSumUS();
+        snapshot.p50RunUS = slot->runHistogram.percentile(0.5);
+        snapshot.p99RunUS = slot->runHistogram.percentile(0.99);
+        snapshot.maxRunUS = slot->runHistogram.getMaxUS();
+    }
+    std::sort(snapshots, snapshots + snapshotCount, [](const TaskStatsSnapshot &a, const TaskStatsSnapshot &b) {
+        return a.totalRunUS > b.totalRunUS;
+    });
+    for(int i = 0; i < snapshotCount; ++i)
+    {
+        snapshotsHolder.addWithoutCheck(snapshots[i]);
+    }
+    delete[] snapshots;
+    return MIO_GENERAL_OK;
+}
+
+inline void TaskInstrumentation::reset(void)
+{
+    TaskInstrumentation *instrumentation = getInstance();
+    for(int i = 0; i <= TASK_INSTRUMENTATION_MAX_KEYS; ++i)
+    {
+        _TaskStatsSlot *slot = (i < TASK_INSTRUMENTATION_MAX_KEYS) ?
+                               instrumentation->slots[i].load(std::memory_order_acquire) :
+                               &instrumentation->others;
+        if(slot)
+        {
+            slot->waitHistogram.reset();
+            slot->runHistogram.reset();
+        }
+    }
+}
+
+inline int TaskInstrumentation::startDump(int periodMS, int maxKeys, bool shouldReset)
+{
+    if((periodMS <= 0) || (maxKeys <= 0))
+    {
+        return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+    TaskInstrumentation *instrumentation = getInstance();
+    SmartMutexLock lock(instrumentation->dumpMutex);
+    if(instrumentation->dumper)
+    {
+        return MIO_ERR_INCORRECT_STATUS;
+    }
+    _TaskStatsDumper *dumper = new _TaskStatsDumper(periodMS, maxKeys, shouldReset);
+    int result = dumper->start();
+    if(result != MIO_GENERAL_OK)
+    {
+        dumper->deref();
+        return result;
+    }
+    instrumentation->dumper = dumper;
+    return MIO_GENERAL_OK;
+}
+
+inline void TaskInstrumentation::stopDump(void)
+{
+    TaskInstrumentation *instrumentation = getInstance();
+    _TaskStatsDumper *dumper;
+    {
+        SmartMutexLock lock(instrumentation->dumpMutex);
+        dumper = instrumentation->dumper;
+        instrumentation->dumper = 0;
+    }
+    if(dumper)
+    {
+        dumper->stop();
+        dumper->deref();
+    }
+}
+
+inline uint64_t TaskInstrumentation::nowUS(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+}
+
+inline _TaskStatsSlot *TaskInstrumentation::find(const void *key, bool isEntry)
+{
+    // Fibonacci hashing of the address, then linear probing.  Slots are only added, so a key is found where it
+    // was added, or before the first empty slot.
+    uint32_t start = (uint32_t) (((uintptr_t) key * 0x9E3779B97F4A7C15ULL) >> 32);
+    _TaskStatsSlot *added = 0;
+    for(int i = 0; i < TASK_INSTRUMENTATION_MAX_KEYS; ++i)
+    {
+        std::atomic<_TaskStatsSlot *> &entry = slots[(start + i) % TASK_INSTRUMENTATION_MAX_KEYS];
+        _TaskStatsSlot *slot = entry.load(std::memory_order_acquire);
+        while(!slot)
+        {
+            if(!added)
+            {
+                added = new _TaskStatsSlot(key, isEntry);
+            }
+            if(entry.compare_exchange_strong(slot, added, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return added;
+            }
+        }
+        if(slot->key == key)
+        {
+            delete added;
+            return slot;
+        }
+    }
+    delete added;
+    return &others;
+}
+
+inline void TaskInstrumentation::nameOf(const _TaskStatsSlot *slot, char *buffer, int bufferLen)
+{
+    const char *name = slot->name.load(std::memory_order_acquire);
+    if(name)
+    {
+        snprintf(buffer, bufferLen, "%s", name);
+    }
+    else if(slot->isEntry)
+    {
+        snprintf(buffer, bufferLen, "entry@%p", slot->key);
+    }
+    else
+    {
+        const char *mangled = ((const std::type_info *) slot->key)->name();
+        int status;
+        char *demangled = abi::__cxa_demangle(mangled, 0, 0, &status);
+        snprintf(buffer, bufferLen, "%s", (status == 0) ? demangled : mangled);
+        free(demangled);
+    }
+}
+
+/* Implementation for _TaskInstrumentedItem */
+
+inline int _TaskInstrumentedItem::run(void)
+{
+    uint64_t startUS = TaskInstrumentation::nowUS();
+    int result = workItem ? workItem->run() : entry(context);
+    uint64_t endUS = TaskInstrumentation::nowUS();
+    const void *key = workItem ? (const void *) &typeid(*workItem) : (const void *) entry;
+    TaskInstrumentation::record(key, !workItem, (startUS > dueUS) ? startUS - dueUS : 0, endUS - startUS);
+    return result;
+}
+
+/* Implementation for _TaskStatsDumper */
+
+inline int _TaskStatsDumper::start(void)
+{
+    return timer.schedule(periodMS);
+}
+
+inline void _TaskStatsDumper::stop(void)
+{
+    isStopped.store(true);
+    timer.cancelAndWait();
+    // A firing _fire() may have re-armed it before it saw isStopped.
+    timer.cancel();
+}
+
+inline int _TaskStatsDumper::_fire(void *context)
+{
+    _TaskStatsDumper *dumper = (_TaskStatsDumper *) context;
+    if(dumper->isStopped.load())
+    {
+        return MIO_GENERAL_OK;
+    }
+    dumper->timer.scheduleNext(dumper->periodMS);
+    if(dumper->isDumping.exchange(true))
+    {
+        return MIO_GENERAL_OK;
+    }
+    // The work item holds a reference, so it may run after stop().
+    int result = GlobalThreadPool::executeTaskItem(dumper);
+    if(result != MIO_GENERAL_OK)
+    {
+        dumper->isDumping.store(false);
+    }
+    return result;
+}
+
+inline int _TaskStatsDumper::run(void)
+{
+    List<TaskStatsSnapshot> snapshots;
+    TaskInstrumentation::snapshot(snapshots);
+    if(shouldReset)
+    {
+        TaskInstrumentation::reset();
+    }
+    int count = (snapshots.size() < maxKeys) ? snapshots.size() : maxKeys;
+    LogSystem::i(TASK_STATS_LOG_TAG, "%d of %d keys, by run time, %s", count, snapshots.size(),
+                 shouldReset ? "in the period" : "since reset");
+    for(int i = 0; i < count; ++i)
+    {
+        const TaskStatsSnapshot &snapshot = snapshots.get(i);
+        LogSystem::i(TASK_STATS_LOG_TAG, "%s: count %llu, wait total/p50/p99/max %llu/%llu/%llu/%llu us, "
+                     "run total/p50/p99/max %llu/%llu/%llu/%llu us", snapshot.name,
+                     (unsigned long long) snapshot.count, (unsigned long long) snapshot.totalWaitUS,
+                     (unsigned long long) snapshot.p50WaitUS, (unsigned long long) snapshot.p99WaitUS,
+                     (unsigned long long) snapshot.maxWaitUS, (unsigned long long) snapshot.totalRunUS,
+                     (unsigned long long) snapshot.p50RunUS, (unsigned long long) snapshot.p99RunUS,
+                     (unsigned long long) snapshot.maxRunUS);
+    }
+    isDumping.store(false);
+    return MIO_GENERAL_OK;
+}
+
+#endif//_TASK_TASK_INSTRUMENTATION_H
@@ -0,0 +1,671 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/TaskLaneScheduler.h                                                                    *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Opt-in priority lanes (realtime/normal/background) of work items, beside GlobalThreadPool.  *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_TASK_LANE_SCHEDULER_H
+#define _TASK_TASK_LANE_SCHEDULER_H
+
+// Standard includes
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <container/List.h>
+#include <osal/OsalCondVar.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+#include <task/Runnable.h>
+#include <task/RunnableBridge.h>
+#include <task/Thread.h>
+#include <task/ThreadAttributes.h>
+#include <task/TimingWheel.h>
+#include <task/TaskInstrumentation.h>
+
+// Max runners (threads which run lanes) at the same time.
+#define TASK_LANE_MAX_RUNNERS               8
+// Realtime work items may start extra runners when all runners are busy.
+#define TASK_LANE_REALTIME_EXTRA_RUNNERS    2
+#define TASK_LANE_BACKGROUND_CONCURRENCY    2
+// Idle runners end after it.
+#define TASK_LANE_RUNNER_IDLE_MS            5000
+
+enum TaskPriority
+{
+    TASK_PRIORITY_REALTIME,
+    TASK_PRIORITY_NORMAL,
+    TASK_PRIORITY_BACKGROUND,
+    TASK_PRIORITY_COUNT
+};
+
+enum TaskLanePolicy
+{
+    // Higher lanes always first.
+    TASK_LANE_STRICT,
+    // Lanes share runs by their weights.
+    TASK_LANE_WEIGHTED
+};
+
+struct TaskLaneStats
+{
+    int queued;
+    int maxQueued;
+    int running;
+    uint64_t executed;
+    // Time from executeTaskItem() (or its afterMS) to run.
+    uint64_t totalWaitUS;
+    uint64_t maxWaitUS;
+};
+
+/*!
+ * @brief Priority lanes of work items, for work which should not wait behind others in GlobalThreadPool.
+ *
+ * @remarks
+ *   1. Opt-in, only files including this header pay for it (TimingWheel, ThreadAttributes and
+ *      TaskInstrumentation).  Work items submitted to GlobalThreadPool are not in lanes.
+ *   2. Lanes run on runner threads of their own, see _TaskLaneScheduler.
+ */
+class TaskLanes
+{
+  public:
+    // 1. Same as GlobalThreadPool::executeTaskItem(), but the work item waits in the lane of priority, and runs
+    //    by the lane policy.
+    // 2. TASK_PRIORITY_BACKGROUND has a concurrency cap.
+    static int executeTaskItem(int (*workItemEntry)(void *), void *context, TaskPriority priority,
+                               int afterMS = 0);
+    static int executeTaskItem(Runnable *workItem, TaskPriority priority, int afterMS = 0);
+    static int executeTaskItem(Ref<Runnable> &&workItem, TaskPriority priority, int afterMS = 0);
+    // Default is TASK_LANE_STRICT.
+    static void setPolicy(TaskLanePolicy policy);
+    // For TASK_LANE_WEIGHTED, default is 8:4:1.
+    static void setWeights(int realtimeWeight, int normalWeight, int backgroundWeight);
+    // Max background work items running at the same time, default is 2.
+    static void setBackgroundConcurrency(int maxRunning);
+    static int maxQueuedWorkItems(TaskPriority priority);
+    static void getStats(TaskPriority priority, TaskLaneStats *stats);
+    // 1. Runners apply attributes of the lane before its work items.  Before switching to another lane, they
+    //    restore their own ones, or end if it fails, so attributes never leak to other lanes.
+    // 2. Empty attributes (default) leave runners unchanged.
+    static void setThreadAttributes(TaskPriority priority, const ThreadAttributes &attributes);
+    static ThreadAttributes getThreadAttributes(TaskPriority priority);
+
+  private:
+    // Private copy constructor is declared but not defined to prevent object creation.
+    TaskLanes(const TaskLanes &);
+};
+
+struct _TaskLaneItem
+{
+    Runnable *workItem;
+    uint64_t queuedTimeUS;
+};
+
+/*!
+ * @brief Lanes of TaskLanes::executeTaskItem().
+ *
+ * @remarks
+ *   1. Work items wait in their lanes, and runners (threads of the scheduler) take them one by one.  So, a
+ *      realtime work item waits for the next free runner at most, instead of all work items queued before it.
+ *   2. TASK_LANE_STRICT: the highest non-empty lane is taken first.  TASK_LANE_WEIGHTED: non-empty lanes are
+ *      taken by smooth weighted round-robin, so background work can't be starved.
+ *   3. Background work items are not taken when setBackgroundConcurrency() of them are running.
+ *   4. Runners are not pooled threads of GlobalThreadPool, so lanes don't wait behind work items submitted w/o
+ *      priorities, and lane attributes never leak to them.  Idle runners end after TASK_LANE_RUNNER_IDLE_MS.
+ *      Runners are started by a spawner thread, so they don't inherit attributes of the thread which executes.
+ *   5. Lanes may have ThreadAttributes.  When a runner switches lanes, it restores its own attributes first,
+ *      and then applies the new lane's.  If they can't be restored, e.g. a raised nice can't be lowered w/o
+ *      CAP_SYS_NICE or RLIMIT_NICE, the runner ends instead of running other lanes, and another one takes over.
+ */
+class _TaskLaneScheduler
+{
+  public:
+    static _TaskLaneScheduler *getInstance(void);
+
+    int execute(Runnable *workItem, TaskPriority priority, int afterMS);
+    // The reference of workItem is moved in, and kept by the lane until the work item ends.
+    int execute(Ref<Runnable> &&workItem, TaskPriority priority, int afterMS);
+    void setPolicy(TaskLanePolicy policy);
+    void setWeights(int realtimeWeight, int normalWeight, int backgroundWeight);
+    void setBackgroundConcurrency(int maxRunning);
+    void getStats(TaskPriority priority, TaskLaneStats *stats);
+    void setThreadAttributes(TaskPriority priority, const ThreadAttributes &attributes);
+    ThreadAttributes getThreadAttributes(TaskPriority priority);
+
+  private:
+    OsalMutex mutex;
+    OsalCondVar workAvailable;
+    OsalCondVar spawnRequested;
+    // Below are protected by mutex.
+    List<_TaskLaneItem> lanes[TASK_PRIORITY_COUNT];
+    TaskLaneStats stats[TASK_PRIORITY_COUNT];
+    int weights[TASK_PRIORITY_COUNT];
+    int currentWeights[TASK_PRIORITY_COUNT];
+    TaskLanePolicy policy;
+    int backgroundConcurrency;
+    int runnerCount;
+    // Runners waiting for workAvailable, and signals sent to them but not taken yet.
+    int idleRunners;
+    int pendingWakeups;
+    // Runners to be started by the spawner thread.
+    int spawnRequests;
+    bool isSpawnerStarted;
+    ThreadAttributes laneAttributes[TASK_PRIORITY_COUNT];
+    // Increased by setThreadAttributes(), runners re-apply attributes when it changes.
+    uint32_t attributesGeneration;
+
+    _TaskLaneScheduler(void);
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    _TaskLaneScheduler(const _TaskLaneScheduler &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    _TaskLaneScheduler &operator=(const _TaskLaneScheduler &);
+
+    int enqueue(Runnable *workItem, TaskPriority priority);
+    // Called with mutex locked, wake an idle runner, or return true if a new runner should be started.
+    bool wakeOrAddRunner(int maxRunners);
+    // Called w/o mutex locked, after wakeOrAddRunner() returns true, the spawner thread starts it.
+    int startRunner(void);
+    static int _spawnerEntry(void *context);
+    void spawnRunners(void);
+    static int _runnerEntry(void *context);
+    void runLanes(void);
+    // Called with mutex locked.
+    bool isEligible(int lane);
+    bool hasEligibleLane(void);
+    // Called with mutex locked, return TASK_PRIORITY_COUNT if none can be taken.
+    int pickLane(void);
+    static uint64_t nowUS(void);
+};
+
+// The delayed part of execute(), it holds the work item on the timing wheel until afterMS.
+class _TaskLaneDelayedItem
+{
+  public:
+    _TaskLaneDelayedItem(Ref<Runnable> &&_workItem, TaskPriority _priority) :
+        timer(_fire, this), workItem(std::move(_workItem)), priority(_priority)
+    {
+    }
+
+    TimingWheelTimer timer;
+
+  private:
+    // Moved to the lane when it fires.
+    Ref<Runnable> workItem;
+    const TaskPriority priority;
+
+    // On the wheel thread, queueing is short enough to be done there.
+    static int _fire(void *context);
+};
+
+inline _TaskLaneScheduler *_TaskLaneScheduler::getInstance(void)
+{
+    // Never deleted, runners may still be running at exit.
+    static _TaskLaneScheduler *scheduler = new _TaskLaneScheduler();
+    return scheduler;
+}
+
+inline _TaskLaneScheduler::_TaskLaneScheduler(void) :
+    policy(TASK_LANE_STRICT), backgroundConcurrency(TASK_LANE_BACKGROUND_CONCURRENCY), runnerCount(0),
+    idleRunners(0), pendingWakeups(0), spawnRequests(0), isSpawnerStarted(false), attributesGeneration(0)
+{
+    memset(stats, 0, sizeof(stats));
+    memset(currentWeights, 0, sizeof(currentWeights));
+    weights[TASK_PRIORITY_REALTIME] = 8;
+    weights[TASK_PRIORITY_NORMAL] = 4;
+    weights[TASK_PRIORITY_BACKGROUND] = 1;
+}
+
+inline int _TaskLaneScheduler::execute(Runnable *workItem, TaskPriority priority, int afterMS)
+{
+    return execute(Ref<Runnable>::retain(workItem), priority, afterMS);
+}
+
+inline int _TaskLaneScheduler::execute(Ref<Runnable> &&workItem, TaskPriority priority, int afterMS)
+{
+    Ref<Runnable> item(std::move(workItem));
+    if((priority < TASK_PRIORITY_REALTIME) || (priority >= TASK_PRIORITY_COUNT))
+    {
+        return MIO_ERR_OUT_OF_RANGE;
+    }
+    if(afterMS > 0)
+    {
+        _TaskLaneDelayedItem *delayed = new _TaskLaneDelayedItem(std::move(item), priority);
+        int result = delayed->timer.schedule(afterMS);
+        if(result != MIO_GENERAL_OK)
+        {
+            delete delayed;
+        }
+        return result;
+    }
+    int result = enqueue(item.get(), priority);
+    if(result == MIO_GENERAL_OK)
+    {
+        // Dequeued items are deref() by runners.
+        item.release();
+    }
+    return result;
+}
+
+inline void _TaskLaneScheduler::setPolicy(TaskLanePolicy _policy)
+{
+    SmartMutexLock lock(mutex);
+    policy = _policy;
+}
+
+inline void _TaskLaneScheduler::setWeights(int realtimeWeight, int normalWeight, int backgroundWeight)
+{
+    SmartMutexLock lock(mutex);
+    weights[TASK_PRIORITY_REALTIME] = (realtimeWeight > 0) ? realtimeWeight : 1;
+    weights[TASK_PRIORITY_NORMAL] = (normalWeight > 0) ? normalWeight : 1;
+    weights[TASK_PRIORITY_BACKGROUND] = (backgroundWeight > 0) ? backgroundWeight : 1;
+    memset(currentWeights, 0, sizeof(currentWeights));
+}
+
+inline void _TaskLaneScheduler::setBackgroundConcurrency(int maxRunning)
+{
+    bool shouldStartRunner;
+    {
+        SmartMutexLock lock(mutex);
+        bool isRaised = (maxRunning > backgroundConcurrency) && (lanes[TASK_PRIORITY_BACKGROUND].size() > 0);
+        backgroundConcurrency = (maxRunning > 0) ? maxRunning : 1;
+        // More background work items can run now.
+        shouldStartRunner = isRaised && wakeOrAddRunner(TASK_LANE_MAX_RUNNERS);
+    }
+    if(shouldStartRunner)
+    {
+        startRunner();
+    }
+}
+
+inline void _TaskLaneScheduler::getStats(TaskPriority priority, TaskLaneStats *laneStats)
+{
+    if((priority < TASK_PRIORITY_REALTIME) || (priority >= TASK_PRIORITY_COUNT))
+    {
+        memset(laneStats, 0, sizeof(*laneStats));
+        return;
+    }
+    SmartMutexLock lock(mutex);
+    *laneStats = stats[priority];
+}
+
+inline void _TaskLaneScheduler::setThreadAttributes(TaskPriority priority, const ThreadAttributes &attributes)
+{
+    if((priority < TASK_PRIORITY_REALTIME) || (priority >= TASK_PRIORITY_COUNT))
+    {
+        return;
+    }
+    SmartMutexLock lock(mutex);
+    laneAttributes[priority] = attributes;
+    ++attributesGeneration;
+}
+
+inline ThreadAttributes _TaskLaneScheduler::getThreadAttributes(TaskPriority priority)
+{
+    if((priority < TASK_PRIORITY_REALTIME) || (priority >= TASK_PRIORITY_COUNT))
+    {
+        return ThreadAttributes();
+    }
+    SmartMutexLock lock(mutex);
+    return laneAttributes[priority];
+}
+
+inline int _TaskLaneScheduler::enqueue(Runnable *workItem, TaskPriority priority)
+{
+    bool shouldStartRunner;
+    {
+        SmartMutexLock lock(mutex);
+        _TaskLaneItem item = { workItem, nowUS() };
+        lanes[priority].addWithoutCheck(item);
+        TaskLaneStats &laneStats = stats[priority];
+        if(++laneStats.queued > laneStats.maxQueued)
+        {
+            laneStats.maxQueued = laneStats.queued;
+        }
+        int maxRunners = TASK_LANE_MAX_RUNNERS +
+                         ((priority == TASK_PRIORITY_REALTIME) ? TASK_LANE_REALTIME_EXTRA_RUNNERS : 0);
+        // A background work item over the cap is taken by a running runner later.
+        shouldStartRunner = ((priority != TASK_PRIORITY_BACKGROUND) ||
+                             (stats[TASK_PRIORITY_BACKGROUND].running < backgroundConcurrency)) &&
+                            wakeOrAddRunner(maxRunners);
+    }
+    int result = shouldStartRunner ? startRunner() : MIO_GENERAL_OK;
+    if(result == MIO_GENERAL_OK)
+    {
+        return MIO_GENERAL_OK;
+    }
+    SmartMutexLock lock(mutex);
+    if(runnerCount > 0)
+    {
+        // Other runners take it later.
+        return MIO_GENERAL_OK;
+    }
+    // No runner can take it, give it back to the caller.
+    List<_TaskLaneItem> &lane = lanes[priority];
+    for(int i = lane.size() - 1; i >= 0; --i)
+    {
+        if(lane.get(i).workItem == workItem)
+        {
+            lane.removeByIndex(i);
+            --stats[priority].queued;
+            break;
+        }
+    }
+    return result;
+}
+
+inline bool _TaskLaneScheduler::wakeOrAddRunner(int maxRunners)
+{
+    if(idleRunners > pendingWakeups)
+    {
+        ++pendingWakeups;
+        workAvailable.signal();
+        return false;
+    }
+    if(runnerCount >= maxRunners)
+    {
+        return false;
+    }
+    ++runnerCount;
+    return true;
+}
+
+inline int _TaskLaneScheduler::startRunner(void)
+{
+    bool shouldStartSpawner;
+    {
+        SmartMutexLock lock(mutex);
+        ++spawnRequests;
+        shouldStartSpawner = !isSpawnerStarted;
+        isSpawnerStarted = true;
+        spawnRequested.signal();
+    }
+    int result = shouldStartSpawner ? Thread::startThread(_spawnerEntry, this) : MIO_GENERAL_OK;
+    if(result != MIO_GENERAL_OK)
+    {
+        // Requests of other threads meanwhile fail too.
+        SmartMutexLock lock(mutex);
+        runnerCount -= spawnRequests;
+        spawnRequests = 0;
+        isSpawnerStarted = false;
+    }
+    return result;
+}
+
+inline int _TaskLaneScheduler::_spawnerEntry(void *context)
+{
+    ((_TaskLaneScheduler *) context)->spawnRunners();
+    return MIO_GENERAL_OK;
+}
+
+inline void _TaskLaneScheduler::spawnRunners(void)
+{
+    // 1. A new thread inherits the nice and policy of its creator, which may be a runner w/ attributes of a
+    //    lane, or a work item raising its own priority.  So, all runners are started by this thread, which
+    //    never changes its attributes.
+    // 2. It never ends, the same as the scheduler.
+    mutex.lock();
+    while(true)
+    {
+        while(spawnRequests == 0)
+        {
+            spawnRequested.wait(mutex);
+        }
+        --spawnRequests;
+        mutex.unlock();
+        int result = Thread::startThread(_runnerEntry, this);
+        mutex.lock();
+        if(result != MIO_GENERAL_OK)
+        {
+            // Work items are left in lanes, the next execute() tries again.
+            --runnerCount;
+        }
+    }
+}
+
+inline int _TaskLaneDelayedItem::_fire(void *context)
+{
+    _TaskLaneDelayedItem *delayed = (_TaskLaneDelayedItem *) context;
+    int result = _TaskLaneScheduler::getInstance()->execute(std::move(delayed->workItem), delayed->priority, 0);
+    delete delayed;
+    return result;
+}
+
+inline int _TaskLaneScheduler::_runnerEntry(void *context)
+{
+    ((_TaskLaneScheduler *) context)->runLanes();
+    return MIO_GENERAL_OK;
+}
+
+inline void _TaskLaneScheduler::runLanes(void)
+{
+    // Attributes of the runner itself, restored before another lane's attributes are applied.
+    ThreadAttributes originalAttributes;
+    bool isCaptured = (ThreadAttributes::capture(0, &originalAttributes) == MIO_GENERAL_OK);
+    // The lane whose attributes are in effect, TASK_PRIORITY_COUNT for the runner's own.
+    int appliedLane = TASK_PRIORITY_COUNT;
+    uint32_t appliedGeneration = 0;
+    // The lane picked before switching attributes, it's taken next if it still can be.
+    int switchedLane = TASK_PRIORITY_COUNT;
+
+    mutex.lock();
+    while(true)
+    {
+        int lane = ((switchedLane != TASK_PRIORITY_COUNT) && isEligible(switchedLane)) ? switchedLane : pickLane();
+        switchedLane = TASK_PRIORITY_COUNT;
+        if(lane == TASK_PRIORITY_COUNT)
+        {
+            ++idleRunners;
+            bool isWoken = workAvailable.wait(mutex, TASK_LANE_RUNNER_IDLE_MS);
+            --idleRunners;
+            if(pendingWakeups > 0)
+            {
+                --pendingWakeups;
+            }
+            if(!isWoken && !hasEligibleLane())
+            {
+                break;
+            }
+            continue;
+        }
+
+        // Syscalls only when the lane (or its attributes) changes.
+        bool hasAttributes = !laneAttributes[lane].isEmpty();
+        bool shouldSwitch = hasAttributes ? ((lane != appliedLane) || (attributesGeneration != appliedGeneration))
+                                          : (appliedLane != TASK_PRIORITY_COUNT);
+        if(shouldSwitch)
+        {
+            ThreadAttributes attributes = laneAttributes[lane];
+            uint32_t generation = attributesGeneration;
+            mutex.unlock();
+            // Fields set by the previous lane only should not be left for this lane.
+            bool isRestored = (appliedLane == TASK_PRIORITY_COUNT) ||
+                              (isCaptured && (originalAttributes.applyToCurrentThread() == MIO_GENERAL_OK));
+            if(isRestored && hasAttributes)
+            {
+                // Best effort, e.g. realtime policies need privileges, the work item runs anyway.
+                attributes.applyToCurrentThread();
+            }
+            mutex.lock();
+            if(!isRestored)
+            {
+                // Attributes of another lane are left, this runner should not run any other lane.
+                break;
+            }
+            appliedLane = hasAttributes ? lane : TASK_PRIORITY_COUNT;
+            appliedGeneration = generation;
+            switchedLane = lane;
+            continue;
+        }
+
+        _TaskLaneItem item = lanes[lane].get(0);
+        lanes[lane].removeByIndex(0);
+        TaskLaneStats &laneStats = stats[lane];
+        uint64_t waitUS = nowUS() - item.queuedTimeUS;
+        --laneStats.queued;
+        ++laneStats.running;
+        ++laneStats.executed;
+        laneStats.totalWaitUS += waitUS;
+        if(waitUS > laneStats.maxWaitUS)
+        {
+            laneStats.maxWaitUS = waitUS;
+        }
+        mutex.unlock();
+
+        item.workItem->run();
+        item.workItem->deref();
+
+        mutex.lock();
+        --laneStats.running;
+    }
+    --runnerCount;
+    // Ended w/ work items left (attributes not restored), another runner takes over.
+    bool shouldStartRunner = hasEligibleLane() && wakeOrAddRunner(TASK_LANE_MAX_RUNNERS);
+    mutex.unlock();
+    if(shouldStartRunner)
+    {
+        startRunner();
+    }
+}
+
+inline bool _TaskLaneScheduler::isEligible(int lane)
+{
+    return (lanes[lane].size() > 0) &&
+           ((lane != TASK_PRIORITY_BACKGROUND) || (stats[lane].running < backgroundConcurrency));
+}
+
+inline bool _TaskLaneScheduler::hasEligibleLane(void)
+{
+    for(int i = 0; i < TASK_PRIORITY_COUNT; ++i)
+    {
+        if(isEligible(i))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline int _TaskLaneScheduler::pickLane(void)
+{
+    bool isLaneEligible[TASK_PRIORITY_COUNT];
+    int totalWeight = 0;
+    for(int i = 0; i < TASK_PRIORITY_COUNT; ++i)
+    {
+        isLaneEligible[i] = isEligible(i);
+        totalWeight += isLaneEligible[i] ? weights[i] : 0;
+    }
+    if(policy == TASK_LANE_STRICT)
+    {
+        for(int i = 0; i < TASK_PRIORITY_COUNT; ++i)
+        {
+            if(isLaneEligible[i])
+            {
+                return i;
+            }
+        }
+        return TASK_PRIORITY_COUNT;
+    }
+    // Smooth weighted round-robin.
+    int picked = TASK_PRIORITY_COUNT;
+    for(int i = 0; i < TASK_PRIORITY_COUNT; ++i)
+    {
+        if(isLaneEligible[i])
+        {
+            currentWeights[i] += weights[i];
+            if((picked == TASK_PRIORITY_COUNT) || (currentWeights[i] > currentWeights[picked]))
+            {
+                picked = i;
+            }
+        }
+    }
+    if(picked != TASK_PRIORITY_COUNT)
+    {
+        currentWeights[picked] -= totalWeight;
+    }
+    return picked;
+}
+
+inline uint64_t _TaskLaneScheduler::nowUS(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+}
+
+/* Implementation for TaskLanes */
+
+inline int TaskLanes::executeTaskItem(int (*workItemEntry)(void *), void *context, TaskPriority priority,
+                                                                                                      int afterMS)
+{
+    // The new work item is moved to the lane w/o another ref().
+    Ref<Runnable> bridge = adoptRef(TaskInstrumentation::wrap(workItemEntry, context, afterMS));
+    return _TaskLaneScheduler::getInstance()->execute(std::move(bridge), priority, afterMS);
+}
+
+inline int TaskLanes::executeTaskItem(Runnable *workItem, TaskPriority priority, int afterMS)
+{
+    if(!TaskInstrumentation::isEnabled())
+    {
+        return _TaskLaneScheduler::getInstance()->execute(workItem, priority, afterMS);
+    }
+    Ref<Runnable> instrumented = adoptRef(TaskInstrumentation::wrap(workItem, afterMS));
+    return _TaskLaneScheduler::getInstance()->execute(std::move(instrumented), priority, afterMS);
+}
+
+inline int TaskLanes::executeTaskItem(Ref<Runnable> &&workItem, TaskPriority priority, int afterMS)
+{
+    Ref<Runnable> item(std::move(workItem));
+    if(!TaskInstrumentation::isEnabled())
+    {
+        return _TaskLaneScheduler::getInstance()->execute(std::move(item), priority, afterMS);
+    }
+    return executeTaskItem(item.get(), priority, afterMS);
+}
+
+inline void TaskLanes::setPolicy(TaskLanePolicy policy)
+{
+    _TaskLaneScheduler::getInstance()->setPolicy(policy);
+}
+
+inline void TaskLanes::setWeights(int realtimeWeight, int normalWeight, int backgroundWeight)
+{
+    _TaskLaneScheduler::getInstance()->setWeights(realtimeWeight, normalWeight, backgroundWeight);
+}
+
+inline void TaskLanes::setBackgroundConcurrency(int maxRunning)
+{
+    _TaskLaneScheduler::getInstance()->setBackgroundConcurrency(maxRunning);
+}
+
+inline int TaskLanes::maxQueuedWorkItems(TaskPriority priority)
+{
+    TaskLaneStats stats;
+    _TaskLaneScheduler::getInstance()->getStats(priority, &stats);
+    return stats.maxQueued;
+}
+
+inline void TaskLanes::getStats(TaskPriority priority, TaskLaneStats *stats)
+{
+    _TaskLaneScheduler::getInstance()->getStats(priority, stats);
+}
+
+inline void TaskLanes::setThreadAttributes(TaskPriority priority, const ThreadAttributes &attributes)
+{
+    _TaskLaneScheduler::getInstance()->setThreadAttributes(priority, attributes);
+}
+
+inline ThreadAttributes TaskLanes::getThreadAttributes(TaskPriority priority)
+{
+    return _TaskLaneScheduler::getInstance()->getThreadAttributes(priority);
+}
+
+#endif//_TASK_TASK_LANE_SCHEDULER_H
@@ -25,12 +25,16 @@ class Thread : public Runnable
     Thread(void);
     // runnable is ref(), and deref() in dtor.
     Thread(Runnable *runnable);
+    // Same as above, and the reference of runnable is moved in.
+    Thread(Ref<Runnable> &&runnable);
 
     // This thread execution is heavy-weight, try to use ThreadPool::executeTaskItem();
     static int startThread(int (*threadEntry)(void *), void *context);
     // 1. This thread execution is heavy-weight, try to use ThreadPool::executeTaskItem();
     // 2. runnable is ref(), and deref() when end.
     static int startThread(Runnable *runnable);
+    // Same as above, and the reference of runnable is moved in, even on failure.
+    static int startThread(Ref<Runnable> &&runnable);
     static int getCurrentThreadID(void);
     static void msleep(int ms);
     // Implemented by POSIX sleep() directly.
@@ -50,6 +54,8 @@ class Thread : public Runnable
     // 5. run() is not used, and runnable->run() is called.
     // 6. If the thread is stopped, it can be start() w/o problems.
     int start(Runnable *runnable);
+    // Same as above, and the reference of runnable is moved in, even on failure.
+    int start(Ref<Runnable> &&runnable);
     // It will return immediately if the the thread is not started.
     int join(void);
 
@@ -80,4 +86,24 @@ class Thread : public Runnable
     friend class PooledThread;
 };
 
+/* Implementation for the Ref<Runnable> overloads */
+
+inline Thread::Thread(Ref<Runnable> &&runnable) : Thread(runnable.get())
+{
+    // The thread ref() by itself, the moved reference is released after that.
+    runnable.reset();
+}
+
+inline int Thread::startThread(Ref<Runnable> &&runnable)
+{
+    Ref<Runnable> holder(std::move(runnable));
+    return startThread(holder.get());
+}
+
+inline int Thread::start(Ref<Runnable> &&runnable)
+{
+    Ref<Runnable> holder(std::move(runnable));
+    return start(holder.get());
+}
+
 #endif//_TASK_THREAD_H
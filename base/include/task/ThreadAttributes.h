@@ -0,0 +1,464 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/ThreadAttributes.h                                                                     *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  CPU affinity, scheduling policy, priority, nice value and name of threads.                  *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_THREAD_ATTRIBUTES_H
+#define _TASK_THREAD_ATTRIBUTES_H
+
+// Standard includes
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+// POSIX includes
+#include <dirent.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <container/List.h>
+#include <task/Runnable.h>
+#include <task/Thread.h>
+
+#define THREAD_NAME_MAX_LEN         15
+// CPUs above are not supported by the affinity mask.
+#define THREAD_MAX_CPUS             64
+
+enum ThreadSchedPolicy
+{
+    // Keep the current one.
+    THREAD_SCHED_INHERIT,
+    THREAD_SCHED_OTHER,
+    THREAD_SCHED_BATCH,
+    THREAD_SCHED_IDLE,
+    // Realtime policies, priority is 1 (lowest) to 99, they need CAP_SYS_NICE or RLIMIT_RTPRIO.
+    THREAD_SCHED_FIFO,
+    THREAD_SCHED_RR
+};
+
+// Actual placement of a thread, for diagnostics.
+struct ThreadPlacement
+{
+    int threadID;
+    // The CPU it ran on most recently.
+    int cpu;
+    uint64_t affinityMask;
+    ThreadSchedPolicy policy;
+    int priority;
+    int nice;
+    char name[THREAD_NAME_MAX_LEN + 1];
+};
+
+/*!
+ * @brief Attributes applied to threads, fields not set are left unchanged.
+ *
+ * @remarks
+ *   1. For example, camera dispatch threads on big cores (4-7 of EVO) with realtime priority:
+ *          ThreadAttributes attributes;
+ *          attributes.setAffinity(0xF0).setPolicy(THREAD_SCHED_FIFO, 50).setName("camDispatch");
+ *          Thread *thread = attributes.newThread(dispatcher);
+ *          thread->start();
+ *   2. newThread()/startThread() apply them in the new thread, before the runnable.  Pools take them as the
+ *      pool default, see AttributedThreadPool, WorkStealingThreadPool and TaskLanes.
+ *   3. All set fields are tried even if some fail, the failure is kept, query() reports what is in effect.
+ */
+class ThreadAttributes
+{
+  public:
+    ThreadAttributes(void);
+
+    // 1. Bit n for CPU n, 0 is unchanged.
+    ThreadAttributes &setAffinity(uint64_t cpuMask);
+    ThreadAttributes &addCpu(int cpu);
+    // priority is for THREAD_SCHED_FIFO and THREAD_SCHED_RR, 0 for others.
+    ThreadAttributes &setPolicy(ThreadSchedPolicy policy, int priority = 0);
+    // -20 (highest) to 19, for THREAD_SCHED_OTHER and THREAD_SCHED_BATCH.
+    ThreadAttributes &setNice(int nice);
+    // Cut to THREAD_NAME_MAX_LEN.
+    ThreadAttributes &setName(const char *name);
+
+    uint64_t getAffinity(void) const;
+    ThreadSchedPolicy getPolicy(void) const;
+    int getPriority(void) const;
+    bool hasNice(void) const;
+    int getNice(void) const;
+    const char *getName(void) const;
+    // No field is set.
+    bool isEmpty(void) const;
+    bool operator==(const ThreadAttributes &another) const;
+    bool operator!=(const ThreadAttributes &another) const;
+
+    // 1. threadID is a thread of this process, 0 is the calling thread.
+    // 2. Return MIO_ERR_SYS_LIMITATION if it is not permitted (realtime policies without privileges),
+    //    MIO_ERR_ILLEGAL_PARAMETERS if some fields are invalid, MIO_ERR_NO_DATA if the thread is gone.
+    int applyTo(int threadID) const;
+    int applyToCurrentThread(void) const;
+
+    // Same as new Thread(runnable), and the attributes are applied in the thread before runnable->run().
+    Thread *newThread(Runnable *runnable) const;
+    // Same as above, and the reference of runnable is moved in.
+    Thread *newThread(Ref<Runnable> &&runnable) const;
+    // Same as Thread::startThread(), and the attributes are applied in the thread first.
+    int startThread(int (*threadEntry)(void *), void *context) const;
+    int startThread(Runnable *runnable) const;
+    // Same as above, and the reference of runnable is moved in, even on failure.
+    int startThread(Ref<Runnable> &&runnable) const;
+
+    // 1. threadID is a thread of this process, 0 is the calling thread.
+    // 2. Return MIO_ERR_NO_DATA if the thread is gone.
+    static int query(int threadID, ThreadPlacement *placement);
+    // All threads of this process.
+    static int queryAll(List<ThreadPlacement> &placementsHolder);
+    // Attributes in effect of the thread, all fields set, to restore it later.
+    static int capture(int threadID, ThreadAttributes *attributes);
+
+  private:
+    uint64_t cpuMask;
+    ThreadSchedPolicy policy;
+    int priority;
+    bool isNiceSet;
+    int nice;
+    char name[THREAD_NAME_MAX_LEN + 1];
+
+    static int toResult(int err);
+};
+
+// Applies attributes in the new thread, and then runs the real runnable or entry.
+class _ThreadAttributesBridge : public Runnable
+{
+  public:
+    _ThreadAttributesBridge(const ThreadAttributes &_attributes, Ref<Runnable> &&_runnable,
+                            int (*_entry)(void *), void *_context) :
+        attributes(_attributes), runnable(std::move(_runnable)), entry(_entry), context(_context)
+    {
+    }
+
+    virtual int run(void)
+    {
+        attributes.applyToCurrentThread();
+        return runnable ? runnable->run() : entry(context);
+    }
+
+  protected:
+    virtual ~_ThreadAttributesBridge()
+    {
+    }
+
+  private:
+    const ThreadAttributes attributes;
+    const Ref<Runnable> runnable;
+    int (*const entry)(void *);
+    void *const context;
+};
+
+inline ThreadAttributes::ThreadAttributes(void) :
+    cpuMask(0), policy(THREAD_SCHED_INHERIT), priority(0), isNiceSet(false), nice(0)
+{
+    name[0] = 0;
+}
+
+inline ThreadAttributes &ThreadAttributes::setAffinity(uint64_t _cpuMask)
+{
+    cpuMask = _cpuMask;
+    return *this;
+}
+
+inline ThreadAttributes &ThreadAttributes::addCpu(int cpu)
+{
+    if((cpu >= 0) && (cpu < THREAD_MAX_CPUS))
+    {
+        cpuMask |= (1ULL << cpu);
+    }
+    return *this;
+}
+
+inline ThreadAttributes &ThreadAttributes::setPolicy(ThreadSchedPolicy _policy, int _priority)
+{
+    policy = _policy;
+    priority = _priority;
+    return *this;
+}
+
+inline ThreadAttributes &ThreadAttributes::setNice(int _nice)
+{
+    isNiceSet = true;
+    nice = _nice;
+    return *this;
+}
+
+inline ThreadAttributes &ThreadAttributes::setName(const char *_name)
+{
+    strncpy(name, _name ? _name : "", THREAD_NAME_MAX_LEN);
+    name[THREAD_NAME_MAX_LEN] = 0;
+    return *this;
+}
+
+inline uint64_t ThreadAttributes::getAffinity(void) const
+{
+    return cpuMask;
+}
+
+inline ThreadSchedPolicy ThreadAttributes::getPolicy(void) const
+{
+    return policy;
+}
+
+inline int ThreadAttributes::getPriority(void) const
+{
+    return priority;
+}
+
+inline bool ThreadAttributes::hasNice(void) const
+{
+    return isNiceSet;
+}
+
+inline int ThreadAttributes::getNice(void) const
+{
+    return nice;
+}
+
+inline const char *ThreadAttributes::getName(void) const
+{
+    return name;
+}
+
+inline bool ThreadAttributes::isEmpty(void) const
+{
+    return (cpuMask == 0) && (policy == THREAD_SCHED_INHERIT) && !isNiceSet && (name[0] == 0);
+}
+
+inline bool ThreadAttributes::operator==(const ThreadAttributes &another) const
+{
+    return (cpuMask == another.cpuMask) && (policy == another.policy) && (priority == another.priority) &&
+           (isNiceSet == another.isNiceSet) && (nice == another.nice) && (strcmp(name, another.name) == 0);
+}
+
+inline bool ThreadAttributes::operator!=(const ThreadAttributes &another) const
+{
+    return !(*this == another);
+}
+
+inline int ThreadAttributes::applyTo(int threadID) const
+{
+    int result = MIO_GENERAL_OK;
+    if(cpuMask)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for(int cpu = 0; cpu < THREAD_MAX_CPUS; ++cpu)
+        {
+            if(cpuMask & (1ULL << cpu))
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+        if(sched_setaffinity(threadID, sizeof(cpuSet), &cpuSet) != 0)
+        {
+            result = toResult(errno);
+        }
+    }
+    if(policy != THREAD_SCHED_INHERIT)
+    {
+        static const int policies[] = { SCHED_OTHER, SCHED_OTHER, SCHED_BATCH, SCHED_IDLE, SCHED_FIFO, SCHED_RR };
+        struct sched_param param;
+        param.sched_priority = ((policy == THREAD_SCHED_FIFO) || (policy == THREAD_SCHED_RR)) ? priority : 0;
+        if((sched_setscheduler(threadID, policies[policy], &param) != 0) && (result == MIO_GENERAL_OK))
+        {
+            result = toResult(errno);
+        }
+    }
+    // The nice value of a thread (Linux), not of the process.
+    if(isNiceSet && (setpriority(PRIO_PROCESS, threadID, nice) != 0) && (result == MIO_GENERAL_OK))
+    {
+        result = toResult(errno);
+    }
+    if(name[0])
+    {
+        char path[64];
+        snprintf(path, sizeof(path), "/proc/self/task/%d/comm",
+                 threadID ? threadID : Thread::getCurrentThreadID());
+        int fd = open(path, O_WRONLY | O_CLOEXEC);
+        bool isNamed = (fd >= 0) && (write(fd, name, strlen(name)) >= 0);
+        if(fd >= 0)
+        {
+            close(fd);
+        }
+        if(!isNamed && (result == MIO_GENERAL_OK))
+        {
+            result = MIO_ERR_NO_DATA;
+        }
+    }
+    return result;
+}
+
+inline int ThreadAttributes::applyToCurrentThread(void) const
+{
+    return applyTo(0);
+}
+
+inline Thread *ThreadAttributes::newThread(Runnable *runnable) const
+{
+    return newThread(Ref<Runnable>::retain(runnable));
+}
+
+inline Thread *ThreadAttributes::newThread(Ref<Runnable> &&runnable) const
+{
+    _ThreadAttributesBridge *bridge = new _ThreadAttributesBridge(*this, std::move(runnable), 0, 0);
+    return new Thread(adoptRef<Runnable>(bridge));
+}
+
+inline int ThreadAttributes::startThread(int (*threadEntry)(void *), void *context) const
+{
+    _ThreadAttributesBridge *bridge = new _ThreadAttributesBridge(*this, Ref<Runnable>(), threadEntry, context);
+    return Thread::startThread(adoptRef<Runnable>(bridge));
+}
+
+inline int ThreadAttributes::startThread(Runnable *runnable) const
+{
+    return startThread(Ref<Runnable>::retain(runnable));
+}
+
+inline int ThreadAttributes::startThread(Ref<Runnable> &&runnable) const
+{
+    _ThreadAttributesBridge *bridge = new _ThreadAttributesBridge(*this, std::move(runnable), 0, 0);
+    return Thread::startThread(adoptRef<Runnable>(bridge));
+}
+
+inline int ThreadAttributes::query(int threadID, ThreadPlacement *placement)
+{
+    memset(placement, 0, sizeof(*placement));
+    placement->threadID = threadID ? threadID : Thread::getCurrentThreadID();
+    placement->cpu = -1;
+
+    cpu_set_t cpuSet;
+    if(sched_getaffinity(threadID, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        return MIO_ERR_NO_DATA;
+    }
+    for(int cpu = 0; cpu < THREAD_MAX_CPUS; ++cpu)
+    {
+        if(CPU_ISSET(cpu, &cpuSet))
+        {
+            placement->affinityMask |= (1ULL << cpu);
+        }
+    }
+    switch(sched_getscheduler(threadID))
+    {
+        case SCHED_BATCH:
+            placement->policy = THREAD_SCHED_BATCH;
+            break;
+        case SCHED_IDLE:
+            placement->policy = THREAD_SCHED_IDLE;
+            break;
+        case SCHED_FIFO:
+            placement->policy = THREAD_SCHED_FIFO;
+            break;
+        case SCHED_RR:
+            placement->policy = THREAD_SCHED_RR;
+            break;
+        default:
+            placement->policy = THREAD_SCHED_OTHER;
+            break;
+    }
+    struct sched_param param;
+    if(sched_getparam(threadID, &param) == 0)
+    {
+        placement->priority = param.sched_priority;
+    }
+    errno = 0;
+    int nice = getpriority(PRIO_PROCESS, threadID);
+    placement->nice = (errno == 0) ? nice : 0;
+
+    char path[64];
+    char buf[512];
+    snprintf(path, sizeof(path), "/proc/self/task/%d/comm", placement->threadID);
+    FILE *file = fopen(path, "re");
+    if(file)
+    {
+        if(fgets(placement->name, sizeof(placement->name), file))
+        {
+            placement->name[strcspn(placement->name, "\n")] = 0;
+        }
+        fclose(file);
+    }
+    // The 39th field of stat is the CPU, fields after the command (which may have spaces) are counted.
+    snprintf(path, sizeof(path), "/proc/self/task/%d/stat", placement->threadID);
+    file = fopen(path, "re");
+    if(file)
+    {
+        const char *field = fgets(buf, sizeof(buf), file) ? strrchr(buf, ')') : 0;
+        for(int i = 2; field && (i < 39); ++i)
+        {
+            field = strchr(field + 1, ' ');
+        }
+        if(field)
+        {
+            placement->cpu = atoi(field + 1);
+        }
+        fclose(file);
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline int ThreadAttributes::queryAll(List<ThreadPlacement> &placementsHolder)
+{
+    DIR *dir = opendir("/proc/self/task");
+    if(!dir)
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    struct dirent *entry;
+    while((entry = readdir(dir)) != 0)
+    {
+        int threadID = atoi(entry->d_name);
+        ThreadPlacement placement;
+        // Threads may exit meanwhile.
+        if((threadID > 0) && (query(threadID, &placement) == MIO_GENERAL_OK))
+        {
+            placementsHolder.addWithoutCheck(placement);
+        }
+    }
+    closedir(dir);
+    return MIO_GENERAL_OK;
+}
+
+inline int ThreadAttributes::capture(int threadID, ThreadAttributes *attributes)
+{
+    ThreadPlacement placement;
+    int result = query(threadID, &placement);
+    if(result != MIO_GENERAL_OK)
+    {
+        return result;
+    }
+    attributes->setAffinity(placement.affinityMask).setPolicy(placement.policy, placement.priority);
+    attributes->setNice(placement.nice).setName(placement.name);
+    return MIO_GENERAL_OK;
+}
+
+inline int ThreadAttributes::toResult(int err)
+{
+    switch(err)
+    {
+        case EPERM:
+            return MIO_ERR_SYS_LIMITATION;
+        case ESRCH:
+            return MIO_ERR_NO_DATA;
+        default:
+            return MIO_ERR_ILLEGAL_PARAMETERS;
+    }
+}
+
+#endif//_TASK_THREAD_ATTRIBUTES_H
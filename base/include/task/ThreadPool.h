@@ -44,6 +44,8 @@ class ThreadPool
     // 1. The execution is light-weight (except when new pooled thread is created).
     // 2. workItem is ref(), and deref() when end.
     int executeTaskItem(Runnable *workItem);
+    // Same as above, and the reference of workItem is moved in, even on failure.
+    int executeTaskItem(Ref<Runnable> &&workItem);
 
   private:
     int maxPooledThreads;
@@ -92,10 +94,29 @@ class GlobalThreadPool
     // 3. workItem is ref(), and deref() when end.
     // 4. If afterMS <= 0, the task is executed immediately.
     static int executeTaskItem(Runnable *workItem, int afterMS = 0);
+    // Same as above, and the reference of workItem is moved in, even on failure.
+    static int executeTaskItem(Ref<Runnable> &&workItem, int afterMS = 0);
+
+    // Priority lanes (realtime/normal/background) are opt-in, see TaskLanes of task/TaskLaneScheduler.h.
 
   private:
     // Private copy constructor is declared but not defined to prevent object creation.
     GlobalThreadPool(const ThreadPool &);
 };
 
+/* Implementation for the Ref<Runnable> overloads */
+
+inline int ThreadPool::executeTaskItem(Ref<Runnable> &&workItem)
+{
+    // The pool ref() by itself, the moved reference is released after that.
+    Ref<Runnable> item(std::move(workItem));
+    return executeTaskItem(item.get());
+}
+
+inline int GlobalThreadPool::executeTaskItem(Ref<Runnable> &&workItem, int afterMS)
+{
+    Ref<Runnable> item(std::move(workItem));
+    return executeTaskItem(item.get(), afterMS);
+}
+
 #endif//_TASK_THREAD_POOL_H
@@ -0,0 +1,611 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/TimingWheel.h                                                                          *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Hierarchical timing wheel, all timers of the process share one timerfd driven thread.       *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_TIMING_WHEEL_H
+#define _TASK_TIMING_WHEEL_H
+
+// Standard includes
+#include <errno.h>
+#include <stdint.h>
+#include <time.h>
+// POSIX includes
+#include <sys/timerfd.h>
+#include <unistd.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <osal/OsalMutex.h>
+#include <osal/OsalCondVar.h>
+#include <util/SmartMutexLock.h>
+#include <task/Runnable.h>
+#include <task/Thread.h>
+#include <task/ThreadPool.h>
+
+// 1ms ticks, 4 levels of 64 slots cover 64ms, 4s, 4.4m and 4.6h, longer timers are cascaded more than once.
+#define TIMING_WHEEL_SLOT_BITS      6
+#define TIMING_WHEEL_SLOT_COUNT     (1 << TIMING_WHEEL_SLOT_BITS)
+#define TIMING_WHEEL_LEVEL_COUNT    4
+#define TIMING_WHEEL_TICK_NS        1000000LL
+
+class TimingWheel;
+
+// List node of wheel slots, slot heads are nodes without timers.
+struct _TimingWheelLink
+{
+    _TimingWheelLink *prev;
+    _TimingWheelLink *next;
+};
+
+/*!
+ * @brief Timer of TimingWheel, insert and cancel are O(1).
+ *
+ * @remarks
+ *   1. handler(context) is called on the wheel thread, all timers of the process share it, so the handler must
+ *      be short and never block, it normally dispatches the real work to a thread pool, as WheelPeriodicTask
+ *      and TimingWheel::executeTaskItem() do.
+ *   2. The resolution is 1ms, a timer never fires earlier than afterMS.
+ *   3. The handler may schedule(), scheduleNext() or delete its own timer.
+ *   4. The destructor cancels it, and waits for a running handler unless it is on the wheel thread.
+ *   5. With slack, the timer fires at a multiple of the largest power of 2 <= slackMS instead, up to slackMS - 1
+ *      late, so timers with slack tend to expire at the same ticks, by fewer wakeups.
+ */
+class TimingWheelTimer : private _TimingWheelLink
+{
+  public:
+    TimingWheelTimer(int (*handler)(void *), void *context);
+
+    /*!
+     * Destructor.
+     */
+    ~TimingWheelTimer();
+
+    // 1. A pending timer is re-armed.
+    // 2. Return MIO_ERR_IO_GENERAL if the wheel thread cannot be created.
+    int schedule(int afterMS);
+    // 1. Re-arm it periodMS after its previous deadline, instead of now, so periodic timers don't drift.
+    // 2. Missed deadlines (the wheel thread was late by more than periodMS) are skipped, the number of them is
+    //    returned.
+    int scheduleNext(int periodMS);
+    // 1. Let the timer fire up to slackMS late, for fewer wakeups, default is 0.
+    // 2. Applied from the next schedule()/scheduleNext(), deadlines of scheduleNext() are not affected.
+    void setSlack(int slackMS);
+    // CLOCK_MONOTONIC time of the latest deadline, w/o the slack.
+    int64_t getDeadlineNS(void);
+    // Return true if it was pending.
+    bool cancel(void);
+    // 1. Same as cancel(), and wait for the handler if it is running.
+    // 2. It cannot be invoked inside the handler, unless the timer isn't scheduled again.
+    bool cancelAndWait(void);
+    bool isPending(void);
+
+  private:
+    int (*const handler)(void *);
+    void *const context;
+    TimingWheel *const wheel;
+    // Below are protected by the wheel mutex.
+    uint64_t deadlineTick;
+    // Power of 2, 1 for no slack.
+    uint64_t slackTicks;
+    uint64_t expireTick;
+    // TIMING_WHEEL_LEVEL_COUNT when it is in the expired batch, -1 if not pending.
+    int8_t level;
+    uint8_t slot;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    TimingWheelTimer(const TimingWheelTimer &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    TimingWheelTimer &operator=(const TimingWheelTimer &);
+
+    // Called with the wheel mutex locked.
+    int scheduleAt(uint64_t tick);
+
+    friend class TimingWheel;
+};
+
+/*!
+ * @brief Hierarchical timing wheel (Varghese and Lauck), shared by the process.
+ *
+ * @remarks
+ *   1. The wheel thread sleeps on a timerfd, which is armed to the next non-empty slot, so idle and far timers
+ *      don't wake it every tick.
+ *   2. Timers which fall due at the same tick are expired as one batch, by one wakeup.
+ *   3. Delayed work items can be executed by GlobalThreadPool through the wheel, for example:
+ *          TimingWheel::executeTaskItem(_onTimeout, this, 3000);
+ */
+class TimingWheel
+{
+  public:
+    static TimingWheel *getInstance(void);
+
+    // Execute the work item by GlobalThreadPool after afterMS.
+    static int executeTaskItem(int (*workItemEntry)(void *), void *context, int afterMS);
+    // Execute the work item by GlobalThreadPool after afterMS, ref() is called until it is executed.
+    static int executeTaskItem(Runnable *workItem, int afterMS);
+    // Same as above, and the reference of workItem is moved in, even on failure.
+    static int executeTaskItem(Ref<Runnable> &&workItem, int afterMS);
+
+    int getPendingCount(void);
+    // Number of timerfd wakeups, to compare with the number of expired timers.
+    uint64_t getWakeupCount(void);
+    uint64_t getExpiredCount(void);
+
+  private:
+    OsalMutex mutex;
+    OsalCondVar condVarFired;
+    // Below are protected by mutex.
+    _TimingWheelLink slots[TIMING_WHEEL_LEVEL_COUNT][TIMING_WHEEL_SLOT_COUNT];
+    uint64_t occupiedSlots[TIMING_WHEEL_LEVEL_COUNT];
+    _TimingWheelLink expiredBatch;
+    uint64_t currentTick;
+    // UINT64_MAX if the timerfd is disarmed.
+    uint64_t armedTick;
+    int pendingCount;
+    uint64_t wakeupCount;
+    uint64_t expiredCount;
+    TimingWheelTimer *firingTimer;
+    int threadID;
+    int timerFD;
+    int64_t startNS;
+
+    TimingWheel(void);
+    // Never deleted, the wheel thread runs until exit.
+    ~TimingWheel();
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    TimingWheel(const TimingWheel &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    TimingWheel &operator=(const TimingWheel &);
+
+    int add(TimingWheelTimer *timer, uint64_t tick);
+    bool remove(TimingWheelTimer *timer);
+    void waitFired(TimingWheelTimer *timer);
+    // Below are called with mutex locked.
+    void link(TimingWheelTimer *timer);
+    void unlink(TimingWheelTimer *timer);
+    void cascade(int level, int slot);
+    // Move all timers due by nowTick to expiredBatch.
+    void advance(uint64_t nowTick);
+    uint64_t nextEventTick(void);
+    void arm(uint64_t tick);
+    uint64_t nowTick(void);
+
+    static int _threadEntry(void *context);
+    void runWheel(void);
+
+    friend class TimingWheelTimer;
+};
+
+// The delayed part of TimingWheel::executeTaskItem().
+class _TimingWheelDelayedItem
+{
+  public:
+    _TimingWheelDelayedItem(int (*_workItemEntry)(void *), void *_context, Ref<Runnable> &&_workItem) :
+        timer(_fire, this), workItemEntry(_workItemEntry), context(_context), workItem(std::move(_workItem))
+    {
+    }
+
+    TimingWheelTimer timer;
+
+  private:
+    int (*const workItemEntry)(void *);
+    void *const context;
+    // Moved to GlobalThreadPool when it fires.
+    Ref<Runnable> workItem;
+
+    static int _fire(void *context);
+};
+
+inline TimingWheelTimer::TimingWheelTimer(int (*_handler)(void *), void *_context) :
+    handler(_handler), context(_context), wheel(TimingWheel::getInstance()), deadlineTick(0), slackTicks(1),
+    expireTick(0), level(-1), slot(0)
+{
+    prev = next = this;
+}
+
+inline TimingWheelTimer::~TimingWheelTimer()
+{
+    cancelAndWait();
+}
+
+inline int TimingWheelTimer::schedule(int afterMS)
+{
+    SmartMutexLock lock(wheel->mutex);
+    return scheduleAt(wheel->nowTick() + ((afterMS > 0) ? afterMS : 0));
+}
+
+inline int TimingWheelTimer::scheduleNext(int periodMS)
+{
+    if(periodMS <= 0)
+    {
+        return MIO_ERR_OUT_OF_RANGE;
+    }
+    SmartMutexLock lock(wheel->mutex);
+    uint64_t tick = deadlineTick + periodMS;
+    int missed = 0;
+    if(tick <= wheel->currentTick)
+    {
+        missed = (int) ((wheel->currentTick - deadlineTick) / periodMS);
+        tick = deadlineTick + (uint64_t) (missed + 1) * periodMS;
+    }
+    int result = scheduleAt(tick);
+    return (result == MIO_GENERAL_OK) ? missed : result;
+}
+
+inline void TimingWheelTimer::setSlack(int slackMS)
+{
+    uint64_t ticks = 1;
+    while((int64_t) (ticks << 1) <= (int64_t) slackMS * 1000000LL / TIMING_WHEEL_TICK_NS)
+    {
+        ticks <<= 1;
+    }
+    SmartMutexLock lock(wheel->mutex);
+    slackTicks = ticks;
+}
+
+inline int64_t TimingWheelTimer::getDeadlineNS(void)
+{
+    SmartMutexLock lock(wheel->mutex);
+    return wheel->startNS + (int64_t) deadlineTick * TIMING_WHEEL_TICK_NS;
+}
+
+inline int TimingWheelTimer::scheduleAt(uint64_t tick)
+{
+    deadlineTick = tick;
+    // Round up to the slack boundary, timers of the same or larger slack share it.
+    return wheel->add(this, (tick + slackTicks - 1) & ~(slackTicks - 1));
+}
+
+inline bool TimingWheelTimer::cancel(void)
+{
+    return wheel->remove(this);
+}
+
+inline bool TimingWheelTimer::cancelAndWait(void)
+{
+    bool wasPending = wheel->remove(this);
+    wheel->waitFired(this);
+    return wasPending;
+}
+
+inline bool TimingWheelTimer::isPending(void)
+{
+    SmartMutexLock lock(wheel->mutex);
+    return level >= 0;
+}
+
+inline int _TimingWheelDelayedItem::_fire(void *context)
+{
+    _TimingWheelDelayedItem *item = (_TimingWheelDelayedItem *) context;
+    int result = item->workItem ? GlobalThreadPool::executeTaskItem(std::move(item->workItem))
+                                : GlobalThreadPool::executeTaskItem(item->workItemEntry, item->context);
+    delete item;
+    return result;
+}
+
+inline TimingWheel *TimingWheel::getInstance(void)
+{
+    // Never deleted, timers may still be pending at exit.
+    static TimingWheel *wheel = new TimingWheel();
+    return wheel;
+}
+
+inline int TimingWheel::executeTaskItem(int (*workItemEntry)(void *), void *context, int afterMS)
+{
+    _TimingWheelDelayedItem *item = new _TimingWheelDelayedItem(workItemEntry, context, Ref<Runnable>());
+    int result = item->timer.schedule(afterMS);
+    if(result != MIO_GENERAL_OK)
+    {
+        delete item;
+    }
+    return result;
+}
+
+inline int TimingWheel::executeTaskItem(Runnable *workItem, int afterMS)
+{
+    return executeTaskItem(Ref<Runnable>::retain(workItem), afterMS);
+}
+
+inline int TimingWheel::executeTaskItem(Ref<Runnable> &&workItem, int afterMS)
+{
+    _TimingWheelDelayedItem *item = new _TimingWheelDelayedItem(0, 0, std::move(workItem));
+    int result = item->timer.schedule(afterMS);
+    if(result != MIO_GENERAL_OK)
+    {
+        delete item;
+    }
+    return result;
+}
+
+inline int TimingWheel::getPendingCount(void)
+{
+    SmartMutexLock lock(mutex);
+    return pendingCount;
+}
+
+inline uint64_t TimingWheel::getWakeupCount(void)
+{
+    SmartMutexLock lock(mutex);
+    return wakeupCount;
+}
+
+inline uint64_t TimingWheel::getExpiredCount(void)
+{
+    SmartMutexLock lock(mutex);
+    return expiredCount;
+}
+
+inline TimingWheel::TimingWheel(void) :
+    currentTick(0), armedTick(UINT64_MAX), pendingCount(0), wakeupCount(0), expiredCount(0), firingTimer(0),
+    threadID(0), timerFD(timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC))
+{
+    for(int level = 0; level < TIMING_WHEEL_LEVEL_COUNT; ++level)
+    {
+        occupiedSlots[level] = 0;
+        for(int slot = 0; slot < TIMING_WHEEL_SLOT_COUNT; ++slot)
+        {
+            slots[level][slot].prev = slots[level][slot].next = &slots[level][slot];
+        }
+    }
+    expiredBatch.prev = expiredBatch.next = &expiredBatch;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    startNS = now.tv_sec * 1000000000LL + now.tv_nsec;
+    if((timerFD >= 0) && (Thread::startThread(_threadEntry, this) != MIO_GENERAL_OK))
+    {
+        close(timerFD);
+        timerFD = -1;
+    }
+}
+
+inline TimingWheel::~TimingWheel()
+{
+}
+
+inline int TimingWheel::add(TimingWheelTimer *timer, uint64_t tick)
+{
+    if(timerFD < 0)
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    if(timer->level >= 0)
+    {
+        unlink(timer);
+    }
+    // Ticks up to currentTick are expired already.
+    timer->expireTick = (tick > currentTick) ? tick : (currentTick + 1);
+    link(timer);
+    ++pendingCount;
+    if(timer->expireTick < armedTick)
+    {
+        arm(timer->expireTick);
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline bool TimingWheel::remove(TimingWheelTimer *timer)
+{
+    SmartMutexLock lock(mutex);
+    if(timer->level < 0)
+    {
+        return false;
+    }
+    unlink(timer);
+    // The timerfd is left armed, an early wakeup finds nothing to expire and re-arms it.
+    return true;
+}
+
+inline void TimingWheel::waitFired(TimingWheelTimer *timer)
+{
+    SmartMutexLock lock(mutex);
+    if(Thread::getCurrentThreadID() == threadID)
+    {
+        return;
+    }
+    while(firingTimer == timer)
+    {
+        condVarFired.wait(mutex);
+    }
+}
+
+inline void TimingWheel::link(TimingWheelTimer *timer)
+{
+    uint64_t tick = timer->expireTick;
+    uint64_t delta = tick - currentTick;
+    int level = 0;
+    while((level < TIMING_WHEEL_LEVEL_COUNT - 1) && (delta >> ((level + 1) * TIMING_WHEEL_SLOT_BITS)))
+    {
+        ++level;
+    }
+    int shift = level * TIMING_WHEEL_SLOT_BITS;
+    if(delta >> (shift + TIMING_WHEEL_SLOT_BITS))
+    {
+        // Beyond the top level, park it at the farthest slot, it is re-linked when the slot is cascaded.
+        tick = ((currentTick >> shift) + TIMING_WHEEL_SLOT_COUNT - 1) << shift;
+    }
+    int slot = (int) ((tick >> shift) & (TIMING_WHEEL_SLOT_COUNT - 1));
+    _TimingWheelLink *head = &slots[level][slot];
+    timer->prev = head->prev;
+    timer->next = head;
+    head->prev->next = timer;
+    head->prev = timer;
+    occupiedSlots[level] |= (1ULL << slot);
+    timer->level = (int8_t) level;
+    timer->slot = (uint8_t) slot;
+}
+
+inline void TimingWheel::unlink(TimingWheelTimer *timer)
+{
+    timer->prev->next = timer->next;
+    timer->next->prev = timer->prev;
+    if(timer->level < TIMING_WHEEL_LEVEL_COUNT)
+    {
+        _TimingWheelLink *head = &slots[timer->level][timer->slot];
+        if(head->next == head)
+        {
+            occupiedSlots[timer->level] &= ~(1ULL << timer->slot);
+        }
+    }
+    timer->prev = timer->next = timer;
+    timer->level = -1;
+    --pendingCount;
+}
+
+inline void TimingWheel::cascade(int level, int slot)
+{
+    _TimingWheelLink *head = &slots[level][slot];
+    _TimingWheelLink *link = head->next;
+    head->prev = head->next = head;
+    occupiedSlots[level] &= ~(1ULL << slot);
+    while(link != head)
+    {
+        TimingWheelTimer *timer = (TimingWheelTimer *) link;
+        link = link->next;
+        this->link(timer);
+    }
+}
+
+inline void TimingWheel::advance(uint64_t nowTick)
+{
+    while(true)
+    {
+        uint64_t tick = nextEventTick();
+        if(tick > nowTick)
+        {
+            break;
+        }
+        // Jump to the tick directly, ticks in between have nothing to do.
+        currentTick = tick;
+        for(int level = TIMING_WHEEL_LEVEL_COUNT - 1; level > 0; --level)
+        {
+            int shift = level * TIMING_WHEEL_SLOT_BITS;
+            if((tick & ((1ULL << shift) - 1)) == 0)
+            {
+                cascade(level, (int) ((tick >> shift) & (TIMING_WHEEL_SLOT_COUNT - 1)));
+            }
+        }
+        // The whole slot expires at this tick, splice it to the batch.
+        int slot = (int) (tick & (TIMING_WHEEL_SLOT_COUNT - 1));
+        _TimingWheelLink *head = &slots[0][slot];
+        if(head->next != head)
+        {
+            for(_TimingWheelLink *link = head->next; link != head; link = link->next)
+            {
+                ((TimingWheelTimer *) link)->level = TIMING_WHEEL_LEVEL_COUNT;
+            }
+            head->next->prev = expiredBatch.prev;
+            expiredBatch.prev->next = head->next;
+            head->prev->next = &expiredBatch;
+            expiredBatch.prev = head->prev;
+            head->prev = head->next = head;
+            occupiedSlots[0] &= ~(1ULL << slot);
+        }
+    }
+    if(nowTick > currentTick)
+    {
+        currentTick = nowTick;
+    }
+}
+
+inline uint64_t TimingWheel::nextEventTick(void)
+{
+    uint64_t nextTick = UINT64_MAX;
+    for(int level = 0; level < TIMING_WHEEL_LEVEL_COUNT; ++level)
+    {
+        uint64_t occupied = occupiedSlots[level];
+        if(occupied == 0)
+        {
+            continue;
+        }
+        // Slots after the current one first, the current one last (a full round later).
+        int shift = level * TIMING_WHEEL_SLOT_BITS;
+        uint64_t position = currentTick >> shift;
+        int rotation = (int) ((position + 1) & (TIMING_WHEEL_SLOT_COUNT - 1));
+        uint64_t rotated = rotation ? ((occupied >> rotation) | (occupied << (64 - rotation))) : occupied;
+        uint64_t tick = (position + 1 + __builtin_ctzll(rotated)) << shift;
+        if(tick < nextTick)
+        {
+            nextTick = tick;
+        }
+    }
+    return nextTick;
+}
+
+inline void TimingWheel::arm(uint64_t tick)
+{
+    struct itimerspec spec = {};
+    if(tick != UINT64_MAX)
+    {
+        int64_t ns = startNS + (int64_t) tick * TIMING_WHEEL_TICK_NS;
+        spec.it_value.tv_sec = ns / 1000000000LL;
+        spec.it_value.tv_nsec = ns % 1000000000LL;
+    }
+    timerfd_settime(timerFD, TFD_TIMER_ABSTIME, &spec, 0);
+    armedTick = tick;
+}
+
+inline uint64_t TimingWheel::nowTick(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    // Round up, so that a timer never fires earlier than asked.
+    return (uint64_t) ((now.tv_sec * 1000000000LL + now.tv_nsec - startNS + TIMING_WHEEL_TICK_NS - 1) /
+                       TIMING_WHEEL_TICK_NS);
+}
+
+inline int TimingWheel::_threadEntry(void *context)
+{
+    ((TimingWheel *) context)->runWheel();
+    return MIO_GENERAL_OK;
+}
+
+inline void TimingWheel::runWheel(void)
+{
+    mutex.lock();
+    threadID = Thread::getCurrentThreadID();
+    mutex.unlock();
+    while(true)
+    {
+        uint64_t expirations;
+        if((read(timerFD, &expirations, sizeof(expirations)) < 0) && (errno != EINTR))
+        {
+            break;
+        }
+
+        SmartMutexLock lock(mutex);
+        ++wakeupCount;
+        // It is expired, timers added from now on re-arm it if they are earlier than the next event.
+        armedTick = UINT64_MAX;
+        // nowTick() rounds up, the timerfd fires at the tick boundary exactly.
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        advance((uint64_t) ((now.tv_sec * 1000000000LL + now.tv_nsec - startNS) / TIMING_WHEEL_TICK_NS));
+        while(expiredBatch.next != &expiredBatch)
+        {
+            TimingWheelTimer *timer = (TimingWheelTimer *) expiredBatch.next;
+            unlink(timer);
+            ++expiredCount;
+            firingTimer = timer;
+            mutex.unlock();
+            timer->handler(timer->context);
+            mutex.lock();
+            firingTimer = 0;
+            condVarFired.broadcast();
+        }
+        // Handlers may have scheduled timers, which armed the timerfd if they are the earliest already.
+        uint64_t tick = nextEventTick();
+        if(tick != armedTick)
+        {
+            arm(tick);
+        }
+    }
+}
+
+#endif//_TASK_TIMING_WHEEL_H
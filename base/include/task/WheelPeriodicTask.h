@@ -0,0 +1,459 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/WheelPeriodicTask.h                                                                    *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Periodic task on the shared TimingWheel, the same interface as PeriodicTask.                *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_WHEEL_PERIODIC_TASK_H
+#define _TASK_WHEEL_PERIODIC_TASK_H
+
+// Standard includes
+#include <math.h>
+#include <stdint.h>
+#include <time.h>
+// libBase includes
+#include <baseResultCode.h>
+#include <osal/OsalMutex.h>
+#include <osal/OsalCondVar.h>
+#include <util/SmartMutexLock.h>
+#include <task/Runnable.h>
+#include <task/ThreadPool.h>
+#include <task/TimingWheel.h>
+
+// What to do with deadlines which are missed, by a late wheel thread or a call still running.
+enum PeriodicOverrunPolicy
+{
+    // Missed deadlines are dropped, the next call is at the next deadline.
+    PERIODIC_OVERRUN_SKIP,
+    // Missed deadlines are coalesced into the next call, getMissedTicks() in the call tells how many.
+    PERIODIC_OVERRUN_COALESCE,
+    // Each missed deadline gets its own call, run back to back until it catches up.
+    PERIODIC_OVERRUN_CATCH_UP
+};
+
+// Lateness of calls from their deadlines, in microseconds.
+struct PeriodicJitterStats
+{
+    uint64_t count;
+    int64_t minUS;
+    int64_t maxUS;
+    int64_t meanUS;
+    int64_t stdDevUS;
+    int64_t lastUS;
+};
+
+/*!
+ * @brief PeriodicTask without a timer of its own, all of them share the wheel thread of TimingWheel.
+ *
+ * @remarks
+ *   1. The interface and the semantics are the same as PeriodicTask, it can replace PeriodicTask directly.
+ *   2. Deadlines are periodInMS apart from the previous deadline, not from the previous dispatch, so the period
+ *      doesn't drift.  Deadlines missed by a late wheel thread are skipped, and counted as overrun.
+ *   3. A deadline which comes while the previous run is still running is missed as well.  Missed deadlines are
+ *      counted as overrun, and handled by the overrun policy.
+ *   4. Lateness of each call from its deadline (CLOCK_MONOTONIC) is kept as jitter statistics.  Extra calls of
+ *      PERIODIC_OVERRUN_CATCH_UP are not sampled, they are late by design.
+ *   5. Tasks which can be late a little, e.g. telemetry sampling, may set slack, so their timers share wakeups:
+ *          WheelPeriodicTask *sampler = new WheelPeriodicTask(1000, _sample, this);
+ *          sampler->setSlack(50);
+ *          sampler->start();
+ */
+class WheelPeriodicTask : public Runnable
+{
+  public:
+    // runnable->run() is called as a work item.
+    WheelPeriodicTask(int periodInMS, Runnable *runnable);
+    // Same as above, and the reference of runnable is moved in.
+    WheelPeriodicTask(int periodInMS, Ref<Runnable> &&runnable);
+    // timerHandler() is called as a work item.
+    WheelPeriodicTask(int periodInMS, int (*timerHandler)(void *), void *context);
+
+    // 1. If firstRunAfterMS < 0, it assumes that 1st run will occur after periodInMS.
+    // 2. To avoid run() when reference count reach zero, ref() will be called.
+    // 3. Cannot start when singleShot() is working.
+    // 4. MIO_ERR_OUT_OF_RANGE if periodInMS <= 0, as setPeriod().
+    int start(int firstRunAfterMS = -1);
+    // 1. if ms < 0, periodInMS is used.
+    // 2. To avoid run() when reference count reach zero, ref() will be called.
+    // 3. stop()/stopAndJoin() still can be used to cancel unfired singleShot().
+    int singleShot(int ms = -1);
+    // 1. deref() will be called once stopped.
+    // 2. It should be taken care that the timer is triggering and the related running objects are under
+    //    destruction, or deleted.  To prevent this, stopAndJoin() can be used.
+    void stop(void);
+    // 1. deref() will be called once stopped.
+    // 2. It cannot be invoked inside the run call.
+    void stopAndJoin(void);
+    // Overrun will be re-count for new start().
+    int getOverrun(void);
+    int getPeriodInMS(void);
+    // If this task is running, new period will be applied after the next deadline.
+    int setPeriod(int periodInMS);
+    // 1. Default is PERIODIC_OVERRUN_SKIP.
+    // 2. Deadlines missed before are dropped.
+    void setOverrunPolicy(PeriodicOverrunPolicy policy);
+    PeriodicOverrunPolicy getOverrunPolicy(void);
+    // 1. Inside the call of PERIODIC_OVERRUN_COALESCE, the number of deadlines coalesced into it besides its own.
+    // 2. 0 for other policies.
+    int getMissedTicks(void);
+    // 1. Let deadlines be late up to slackMS, for fewer wakeups of the wheel (see TimingWheelTimer), default is 0.
+    // 2. Deadlines don't drift by slack, and lateness by slack is in jitter statistics.
+    void setSlack(int slackMS);
+    // Reset by start() and resetJitterStats().
+    void getJitterStats(PeriodicJitterStats *stats);
+    void resetJitterStats(void);
+
+    // 1. Default do nothing.
+    // 2. This is called as a work item.
+    virtual int run(void);
+
+  protected:
+    WheelPeriodicTask(int periodInMS);
+    virtual ~WheelPeriodicTask();
+
+  private:
+    TimingWheelTimer timer;
+    OsalMutex mutex;
+    OsalCondVar condVarJoin;
+    int periodInMS;
+    Ref<Runnable> runnable;
+    int (*timerHandler)(void *) = 0;
+    void *context = 0;
+    bool started = false;
+    bool singleShotting = false;
+    bool running = false;
+    int overrun = 0;
+    PeriodicOverrunPolicy overrunPolicy = PERIODIC_OVERRUN_SKIP;
+    // Missed deadlines waiting for a call, of PERIODIC_OVERRUN_COALESCE and PERIODIC_OVERRUN_CATCH_UP.
+    int pendingTicks = 0;
+    // Of the running call.
+    int missedTicks = 0;
+    int64_t dispatchDeadlineNS = 0;
+    // meanUS and stdDevUS are calculated by getJitterStats().
+    PeriodicJitterStats jitter = {};
+    int64_t jitterSumUS = 0;
+    double jitterSumSquares = 0;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    WheelPeriodicTask(const WheelPeriodicTask &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    WheelPeriodicTask &operator=(const WheelPeriodicTask &);
+
+    void stop(bool shouldJoin);
+    // Called with mutex locked.
+    void recordJitter(int64_t latenessUS);
+    // On the wheel thread.
+    static int _fire(void *context);
+    // As a work item.
+    static int _dispatch(void *context);
+};
+
+inline WheelPeriodicTask::WheelPeriodicTask(int _periodInMS, Runnable *_runnable) :
+    timer(_fire, this), periodInMS(_periodInMS), runnable(Ref<Runnable>::retain(_runnable))
+{
+}
+
+inline WheelPeriodicTask::WheelPeriodicTask(int _periodInMS, Ref<Runnable> &&_runnable) :
+    timer(_fire, this), periodInMS(_periodInMS), runnable(std::move(_runnable))
+{
+}
+
+inline WheelPeriodicTask::WheelPeriodicTask(int _periodInMS, int (*_timerHandler)(void *), void *_context) :
+    timer(_fire, this), periodInMS(_periodInMS), timerHandler(_timerHandler), context(_context)
+{
+}
+
+inline WheelPeriodicTask::WheelPeriodicTask(int _periodInMS) : timer(_fire, this), periodInMS(_periodInMS)
+{
+}
+
+inline WheelPeriodicTask::~WheelPeriodicTask()
+{
+}
+
+inline int WheelPeriodicTask::start(int firstRunAfterMS)
+{
+    SmartMutexLock lock(mutex);
+    if(started || singleShotting)
+    {
+        return MIO_ERR_INCORRECT_STATUS;
+    }
+    if(periodInMS <= 0)
+    {
+        // The next deadlines could not be scheduled, it would stop silently after the first run.
+        return MIO_ERR_OUT_OF_RANGE;
+    }
+    int result = timer.schedule((firstRunAfterMS < 0) ? periodInMS : firstRunAfterMS);
+    if(result == MIO_GENERAL_OK)
+    {
+        started = true;
+        overrun = 0;
+        pendingTicks = 0;
+        jitter = PeriodicJitterStats();
+        jitterSumUS = 0;
+        jitterSumSquares = 0;
+        ref();
+    }
+    return result;
+}
+
+inline int WheelPeriodicTask::singleShot(int ms)
+{
+    SmartMutexLock lock(mutex);
+    if(started)
+    {
+        return MIO_ERR_INCORRECT_STATUS;
+    }
+    int result = timer.schedule((ms < 0) ? periodInMS : ms);
+    if((result == MIO_GENERAL_OK) && !singleShotting)
+    {
+        singleShotting = true;
+        ref();
+    }
+    return result;
+}
+
+inline void WheelPeriodicTask::stop(void)
+{
+    stop(false);
+}
+
+inline void WheelPeriodicTask::stopAndJoin(void)
+{
+    stop(true);
+}
+
+inline int WheelPeriodicTask::getOverrun(void)
+{
+    SmartMutexLock lock(mutex);
+    return overrun;
+}
+
+inline int WheelPeriodicTask::getPeriodInMS(void)
+{
+    SmartMutexLock lock(mutex);
+    return periodInMS;
+}
+
+inline int WheelPeriodicTask::setPeriod(int _periodInMS)
+{
+    if(_periodInMS <= 0)
+    {
+        return MIO_ERR_OUT_OF_RANGE;
+    }
+    SmartMutexLock lock(mutex);
+    periodInMS = _periodInMS;
+    return MIO_GENERAL_OK;
+}
+
+inline void WheelPeriodicTask::setOverrunPolicy(PeriodicOverrunPolicy policy)
+{
+    SmartMutexLock lock(mutex);
+    overrunPolicy = policy;
+    pendingTicks = 0;
+}
+
+inline PeriodicOverrunPolicy WheelPeriodicTask::getOverrunPolicy(void)
+{
+    SmartMutexLock lock(mutex);
+    return overrunPolicy;
+}
+
+inline int WheelPeriodicTask::getMissedTicks(void)
+{
+    SmartMutexLock lock(mutex);
+    return missedTicks;
+}
+
+inline void WheelPeriodicTask::setSlack(int slackMS)
+{
+    timer.setSlack(slackMS);
+}
+
+inline void WheelPeriodicTask::getJitterStats(PeriodicJitterStats *stats)
+{
+    SmartMutexLock lock(mutex);
+    *stats = jitter;
+    if(jitter.count > 0)
+    {
+        double mean = (double) jitterSumUS / jitter.count;
+        double variance = jitterSumSquares / jitter.count - mean * mean;
+        stats->meanUS = (int64_t) mean;
+        stats->stdDevUS = (variance > 0) ? (int64_t) sqrt(variance) : 0;
+    }
+}
+
+inline void WheelPeriodicTask::resetJitterStats(void)
+{
+    SmartMutexLock lock(mutex);
+    jitter = PeriodicJitterStats();
+    jitterSumUS = 0;
+    jitterSumSquares = 0;
+}
+
+inline int WheelPeriodicTask::run(void)
+{
+    return MIO_GENERAL_OK;
+}
+
+inline void WheelPeriodicTask::recordJitter(int64_t latenessUS)
+{
+    if((jitter.count == 0) || (latenessUS < jitter.minUS))
+    {
+        jitter.minUS = latenessUS;
+    }
+    if((jitter.count == 0) || (latenessUS > jitter.maxUS))
+    {
+        jitter.maxUS = latenessUS;
+    }
+    jitterSumUS += latenessUS;
+    jitterSumSquares += (double) latenessUS * latenessUS;
+    jitter.lastUS = latenessUS;
+    ++jitter.count;
+}
+
+inline void WheelPeriodicTask::stop(bool shouldJoin)
+{
+    bool wasActive;
+    {
+        SmartMutexLock lock(mutex);
+        wasActive = started || singleShotting;
+        started = singleShotting = false;
+    }
+    // A firing _fire() sees the flags cleared, and it is waited for, so this can be deleted by deref().
+    timer.cancelAndWait();
+    if(shouldJoin)
+    {
+        SmartMutexLock lock(mutex);
+        while(running)
+        {
+            condVarJoin.wait(mutex);
+        }
+    }
+    if(wasActive)
+    {
+        deref();
+    }
+}
+
+inline int WheelPeriodicTask::_fire(void *context)
+{
+    WheelPeriodicTask *task = (WheelPeriodicTask *) context;
+    bool shouldDispatch = false;
+    bool shouldDeref = false;
+    task->mutex.lock();
+    // The deadline which fires, before scheduleNext() moves it.
+    int64_t deadlineNS = task->timer.getDeadlineNS();
+    int missed = 0;
+    if(task->started)
+    {
+        missed = task->timer.scheduleNext(task->periodInMS);
+        if(missed < 0)
+        {
+            missed = 0;
+        }
+    }
+    if(task->started || task->singleShotting)
+    {
+        if(task->running)
+        {
+            ++missed;
+        }
+        else
+        {
+            task->running = true;
+            task->dispatchDeadlineNS = deadlineNS;
+            shouldDispatch = true;
+        }
+        task->overrun += missed;
+        if(task->overrunPolicy != PERIODIC_OVERRUN_SKIP)
+        {
+            task->pendingTicks += missed;
+        }
+        // The reference of singleShot() is passed to the work item, or dropped.
+        if(task->singleShotting)
+        {
+            task->singleShotting = false;
+            shouldDeref = !shouldDispatch;
+        }
+        else if(shouldDispatch)
+        {
+            task->ref();
+        }
+    }
+    task->mutex.unlock();
+
+    int result = MIO_GENERAL_OK;
+    if(shouldDispatch)
+    {
+        result = GlobalThreadPool::executeTaskItem(_dispatch, task);
+        if(result != MIO_GENERAL_OK)
+        {
+            task->mutex.lock();
+            task->running = false;
+            task->condVarJoin.broadcast();
+            task->mutex.unlock();
+            shouldDeref = true;
+        }
+    }
+    // It may be deleted here, which is fine on the wheel thread.
+    if(shouldDeref)
+    {
+        task->deref();
+    }
+    return result;
+}
+
+inline int WheelPeriodicTask::_dispatch(void *context)
+{
+    WheelPeriodicTask *task = (WheelPeriodicTask *) context;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    task->mutex.lock();
+    task->recordJitter((now.tv_sec * 1000000000LL + now.tv_nsec - task->dispatchDeadlineNS) / 1000);
+    if(task->overrunPolicy == PERIODIC_OVERRUN_COALESCE)
+    {
+        task->missedTicks = task->pendingTicks;
+        task->pendingTicks = 0;
+    }
+    task->mutex.unlock();
+
+    int result;
+    while(true)
+    {
+        if(task->runnable)
+        {
+            result = task->runnable->run();
+        }
+        else if(task->timerHandler)
+        {
+            result = task->timerHandler(task->context);
+        }
+        else
+        {
+            result = task->run();
+        }
+        SmartMutexLock lock(task->mutex);
+        // Missed deadlines are run on this pooled thread back to back, until stopped or caught up.
+        if(task->started && (task->overrunPolicy == PERIODIC_OVERRUN_CATCH_UP) && (task->pendingTicks > 0))
+        {
+            --task->pendingTicks;
+            continue;
+        }
+        task->running = false;
+        task->missedTicks = 0;
+        task->condVarJoin.broadcast();
+        break;
+    }
+    task->deref();
+    return result;
+}
+
+#endif//_TASK_WHEEL_PERIODIC_TASK_H
@@ -0,0 +1,473 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  task/WorkStealingThreadPool.h                                                               *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Work-stealing executor, per-worker Chase-Lev deques and a sharded injection queue, the same *
+ *                executeTaskItem() interface as ThreadPool.                                                  *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _TASK_WORK_STEALING_THREAD_POOL_H
+#define _TASK_WORK_STEALING_THREAD_POOL_H
+
+// Standard includes
+#include <stdint.h>
+#include <atomic>
+// libBase includes
+#include <baseResultCode.h>
+#include <container/ChaseLevDeque.h>
+#include <container/List.h>
+#include <container/MpmcRing.h>
+#include <osal/OsalCondVar.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+#include <task/Runnable.h>
+#include <task/RunnableBridge.h>
+#include <task/TaskInstrumentation.h>
+#include <task/Thread.h>
+#include <task/ThreadAttributes.h>
+
+// Lock-free part of each injection shard, more items go to the shard's overflow list.
+#define WORK_STEALING_SHARD_CAPACITY    1024
+// Max sleep of an idle worker before it looks for work again, it bounds the latency of any missed wake-up.
+#define WORK_STEALING_IDLE_MS           100
+
+class WorkStealingThreadPool;
+
+// A pooled thread and its deque.
+struct _WorkStealingWorker
+{
+    WorkStealingThreadPool *pool;
+    int ndx;
+    uint32_t randomState;
+    Thread *thread;
+    // 0 until the thread runs, protected by the pool's attributesMutex.
+    int threadID;
+    ChaseLevDeque<Runnable *> deque;
+};
+
+// Submissions from non-worker threads, a thread sticks to one shard.
+struct _WorkStealingShard
+{
+    MpmcRing<Runnable *> ring;
+    OsalMutex overflowMutex;
+    List<Runnable *> overflowItems;
+    std::atomic<int> overflowCount;
+
+    _WorkStealingShard(void) : ring(WORK_STEALING_SHARD_CAPACITY), overflowCount(0)
+    {
+    }
+};
+
+/*!
+ * @brief Fixed-size thread pool, where threads don't contend on one lock for every work item.
+ *
+ * @remarks
+ *   1. Each pooled thread owns a lock-free Chase-Lev deque.  Work items submitted by pooled threads (of this
+ *      pool) are pushed to their own deques, and run LIFO by the owner.  Idle pooled threads steal from others'
+ *      deques FIFO.
+ *   2. Work items submitted by other threads go to a sharded injection queue, each submitting thread sticks to
+ *      one shard (a lock-free MpmcRing, with a locked overflow list when it is full).
+ *   3. There is no order among work items.  Work items are not bounded by the pool, and all submitted work items
+ *      are run before the destructor returns.
+ *   4. Pooled threads sleep on a condition variable only when no work is found, submissions signal it only if
+ *      some pooled threads are sleeping.
+ *   5. Prefer ThreadPool for blocking work items (I/O waits), this pool has no extra threads, and a blocked
+ *      pooled thread holds its deque until it returns (others still steal from it).
+ */
+class WorkStealingThreadPool
+{
+  public:
+    // 1. injectionShards is 0 for the same number as threadCount.
+    // 2. Pooled threads apply attributes before they take work items.
+    // 3. If any pooled thread fails to start, the started ones are stopped, see getStartResult().
+    WorkStealingThreadPool(int threadCount, int injectionShards = 0,
+                           const ThreadAttributes &attributes = ThreadAttributes());
+    // Run all queued work items, and then pooled threads are joined.
+    ~WorkStealingThreadPool();
+
+    int getThreadCount(void) const;
+    // MIO_GENERAL_OK, or the failure of starting pooled threads, then executeTaskItem() always returns error
+    // MIO_ERR_INCORRECT_STATUS.
+    int getStartResult(void) const;
+    int maxRunningWorkItems(void);
+    int maxQueuedWorkItems(void);
+    // Work items taken from other pooled threads' deques.
+    uint64_t stolenWorkItems(void);
+
+    // 1. Lock-free, except the allocation of the bridge.
+    // 2. If the pool is destructing, it will return error MIO_ERR_INCORRECT_STATUS.
+    int executeTaskItem(int (*taskEntry)(void *), void *context);
+    // 1. Lock-free, except when the injection shard overflows.
+    // 2. workItem is ref(), and deref() when end.
+    // 3. If the pool is destructing, it will return error MIO_ERR_INCORRECT_STATUS.
+    int executeTaskItem(Runnable *workItem);
+    // Same as above, and the reference of workItem is moved in, even on failure, w/o ref() and deref().
+    int executeTaskItem(Ref<Runnable> &&workItem);
+
+    // Applied to all pooled threads immediately, the first failure is returned.
+    int setAttributes(const ThreadAttributes &attributes);
+    ThreadAttributes getAttributes(void);
+    int queryPlacements(List<ThreadPlacement> &placementsHolder);
+
+  private:
+    const int threadCount;
+    const int shardCount;
+    _WorkStealingWorker *workers;
+    _WorkStealingShard *shards;
+    std::atomic<bool> destructing;
+    int startResult;
+    // Submitted but not taken by pooled threads yet.
+    std::atomic<int> queuedCount;
+    std::atomic<int> runningCount;
+    std::atomic<int> _maxRunningWorkItems;
+    std::atomic<int> _maxQueuedWorkItems;
+    std::atomic<uint64_t> stolenCount;
+    std::atomic<int> nextShard;
+    std::atomic<int> sleepingCount;
+    OsalMutex sleepMutex;
+    OsalCondVar sleepCondVar;
+    OsalMutex attributesMutex;
+    ThreadAttributes attributes;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    WorkStealingThreadPool(const WorkStealingThreadPool &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    WorkStealingThreadPool &operator=(const WorkStealingThreadPool &);
+
+    static _WorkStealingWorker *&currentWorker(void);
+    static int _workerEntry(void *context);
+    void runWorker(_WorkStealingWorker *worker);
+    bool findWorkItem(_WorkStealingWorker *worker, Runnable *&workItem);
+    bool takeFromShard(_WorkStealingShard *shard, Runnable *&workItem);
+    bool stealWorkItem(_WorkStealingWorker *worker, Runnable *&workItem);
+    // Pooled threads run all queued work items, and then they are joined.
+    void stopWorkers(void);
+    void runWorkItem(Runnable *workItem);
+    // The reference of workItem is moved in, and deref() by the pooled thread which runs it.
+    int submit(Ref<Runnable> &&workItem);
+    void wakeUpWorker(void);
+    static void updateMax(std::atomic<int> &maxValue, int value);
+};
+
+inline WorkStealingThreadPool::WorkStealingThreadPool(int _threadCount, int injectionShards,
+                                                      const ThreadAttributes &_attributes) :
+    threadCount((_threadCount > 0) ? _threadCount : 1),
+    shardCount((injectionShards > 0) ? injectionShards : ((_threadCount > 0) ? _threadCount : 1)),
+    destructing(false), startResult(MIO_GENERAL_OK), queuedCount(0), runningCount(0), _maxRunningWorkItems(0),
+    _maxQueuedWorkItems(0), stolenCount(0), nextShard(0), sleepingCount(0), attributes(_attributes)
+{
+    workers = new _WorkStealingWorker[threadCount];
+    shards = new _WorkStealingShard[shardCount];
+    for(int i = 0; i < threadCount; ++i)
+    {
+        workers[i].pool = this;
+        workers[i].ndx = i;
+        workers[i].randomState = 2654435761u * (i + 1);
+        workers[i].threadID = 0;
+        RunnableBridge *bridge = new RunnableBridge(_workerEntry, &workers[i]);
+        workers[i].thread = new Thread(bridge);
+        bridge->deref();
+    }
+    // Started after all workers are set, they steal from each other.
+    for(int i = 0; i < threadCount; ++i)
+    {
+        int result = workers[i].thread->start();
+        if(result < 0)
+        {
+            startResult = result;
+            stopWorkers();
+            break;
+        }
+    }
+}
+
+inline WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    stopWorkers();
+    for(int i = 0; i < threadCount; ++i)
+    {
+        workers[i].thread->deref();
+    }
+    delete[] workers;
+    delete[] shards;
+}
+
+inline int WorkStealingThreadPool::getThreadCount(void) const
+{
+    return threadCount;
+}
+
+inline int WorkStealingThreadPool::getStartResult(void) const
+{
+    return startResult;
+}
+
+inline int WorkStealingThreadPool::maxRunningWorkItems(void)
+{
+    return _maxRunningWorkItems.load(std::memory_order_relaxed);
+}
+
+inline int WorkStealingThreadPool::maxQueuedWorkItems(void)
+{
+    return _maxQueuedWorkItems.load(std::memory_order_relaxed);
+}
+
+inline uint64_t WorkStealingThreadPool::stolenWorkItems(void)
+{
+    return stolenCount.load(std::memory_order_relaxed);
+}
+
+inline int WorkStealingThreadPool::setAttributes(const ThreadAttributes &_attributes)
+{
+    SmartMutexLock lock(attributesMutex);
+    attributes = _attributes;
+    int result = MIO_GENERAL_OK;
+    for(int i = 0; i < threadCount; ++i)
+    {
+        // Threads not running yet apply it when they start.
+        int applyResult = workers[i].threadID ? attributes.applyTo(workers[i].threadID) : MIO_GENERAL_OK;
+        if(result == MIO_GENERAL_OK)
+        {
+            result = applyResult;
+        }
+    }
+    return result;
+}
+
+inline ThreadAttributes WorkStealingThreadPool::getAttributes(void)
+{
+    SmartMutexLock lock(attributesMutex);
+    return attributes;
+}
+
+inline int WorkStealingThreadPool::queryPlacements(List<ThreadPlacement> &placementsHolder)
+{
+    SmartMutexLock lock(attributesMutex);
+    for(int i = 0; i < threadCount; ++i)
+    {
+        ThreadPlacement placement;
+        if(workers[i].threadID && (ThreadAttributes::query(workers[i].threadID, &placement) == MIO_GENERAL_OK))
+        {
+            placementsHolder.addWithoutCheck(placement);
+        }
+    }
+    return MIO_GENERAL_OK;
+}
+
+inline int WorkStealingThreadPool::executeTaskItem(int (*taskEntry)(void *), void *context)
+{
+    return submit(adoptRef(TaskInstrumentation::wrap(taskEntry, context)));
+}
+
+inline int WorkStealingThreadPool::executeTaskItem(Runnable *workItem)
+{
+    if(!TaskInstrumentation::isEnabled())
+    {
+        return submit(Ref<Runnable>::retain(workItem));
+    }
+    return submit(adoptRef(TaskInstrumentation::wrap(workItem)));
+}
+
+inline int WorkStealingThreadPool::executeTaskItem(Ref<Runnable> &&workItem)
+{
+    if(!TaskInstrumentation::isEnabled())
+    {
+        return submit(std::move(workItem));
+    }
+    Ref<Runnable> item(std::move(workItem));
+    return submit(adoptRef(TaskInstrumentation::wrap(item.get())));
+}
+
+inline int WorkStealingThreadPool::submit(Ref<Runnable> &&_workItem)
+{
+    Ref<Runnable> item(std::move(_workItem));
+    if(destructing.load(std::memory_order_relaxed))
+    {
+        return MIO_ERR_INCORRECT_STATUS;
+    }
+    Runnable *workItem = item.release();
+    // Counted before it is visible, so it never goes negative.
+    updateMax(_maxQueuedWorkItems, queuedCount.fetch_add(1) + 1);
+    _WorkStealingWorker *worker = currentWorker();
+    if(worker && (worker->pool == this))
+    {
+        worker->deque.push(workItem);
+    }
+    else
+    {
+        static __thread int shardHint = -1;
+        if(shardHint < 0)
+        {
+            shardHint = nextShard.fetch_add(1, std::memory_order_relaxed) & 0x7FFFFFFF;
+        }
+        _WorkStealingShard &shard = shards[shardHint % shardCount];
+        if(!shard.ring.tryPush(workItem))
+        {
+            SmartMutexLock lock(shard.overflowMutex);
+            shard.overflowItems.addWithoutCheck(workItem);
+            shard.overflowCount.fetch_add(1);
+        }
+    }
+    wakeUpWorker();
+    return MIO_GENERAL_OK;
+}
+
+inline _WorkStealingWorker *&WorkStealingThreadPool::currentWorker(void)
+{
+    static __thread _WorkStealingWorker *worker = 0;
+    return worker;
+}
+
+inline int WorkStealingThreadPool::_workerEntry(void *context)
+{
+    _WorkStealingWorker *worker = (_WorkStealingWorker *) context;
+    worker->pool->runWorker(worker);
+    return MIO_GENERAL_OK;
+}
+
+inline void WorkStealingThreadPool::runWorker(_WorkStealingWorker *worker)
+{
+    currentWorker() = worker;
+    attributesMutex.lock();
+    worker->threadID = Thread::getCurrentThreadID();
+    attributes.applyToCurrentThread();
+    attributesMutex.unlock();
+    while(true)
+    {
+        Runnable *workItem;
+        if(findWorkItem(worker, workItem))
+        {
+            runWorkItem(workItem);
+            continue;
+        }
+        SmartMutexLock lock(sleepMutex);
+        if(queuedCount.load() > 0)
+        {
+            // Being pushed, or lost a steal race.
+            continue;
+        }
+        if(destructing.load())
+        {
+            break;
+        }
+        // Dekker-style with executeTaskItem(), sleepingCount is increased before queuedCount is checked, and
+        // submitters increase queuedCount before sleepingCount is checked.
+        sleepingCount.fetch_add(1);
+        if(queuedCount.load() == 0)
+        {
+            sleepCondVar.wait(sleepMutex, WORK_STEALING_IDLE_MS);
+        }
+        sleepingCount.fetch_sub(1);
+    }
+    currentWorker() = 0;
+}
+
+inline bool WorkStealingThreadPool::findWorkItem(_WorkStealingWorker *worker, Runnable *&workItem)
+{
+    if(worker->deque.pop(workItem))
+    {
+        return true;
+    }
+    for(int i = 0; i < shardCount; ++i)
+    {
+        if(takeFromShard(&shards[(worker->ndx + i) % shardCount], workItem))
+        {
+            return true;
+        }
+    }
+    return stealWorkItem(worker, workItem);
+}
+
+inline bool WorkStealingThreadPool::takeFromShard(_WorkStealingShard *shard, Runnable *&workItem)
+{
+    if(shard->ring.tryPop(workItem))
+    {
+        return true;
+    }
+    if(shard->overflowCount.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+    SmartMutexLock lock(shard->overflowMutex);
+    if(shard->overflowItems.size() == 0)
+    {
+        return false;
+    }
+    workItem = shard->overflowItems.get(0);
+    shard->overflowItems.removeByIndex(0);
+    shard->overflowCount.fetch_sub(1);
+    return true;
+}
+
+inline bool WorkStealingThreadPool::stealWorkItem(_WorkStealingWorker *worker, Runnable *&workItem)
+{
+    if(threadCount == 1)
+    {
+        return false;
+    }
+    // xorshift32, a random victim to start with, so stealers spread out.
+    uint32_t x = worker->randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    worker->randomState = x;
+    int start = (int) (x % threadCount);
+    for(int i = 0; i < threadCount; ++i)
+    {
+        _WorkStealingWorker *victim = &workers[(start + i) % threadCount];
+        if((victim != worker) && victim->deque.steal(workItem))
+        {
+            stolenCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void WorkStealingThreadPool::stopWorkers(void)
+{
+    destructing.store(true);
+    {
+        SmartMutexLock lock(sleepMutex);
+        sleepCondVar.broadcast();
+    }
+    for(int i = 0; i < threadCount; ++i)
+    {
+        // It returns immediately if the thread is not started, or joined already.
+        workers[i].thread->join();
+    }
+}
+
+inline void WorkStealingThreadPool::runWorkItem(Runnable *workItem)
+{
+    queuedCount.fetch_sub(1);
+    updateMax(_maxRunningWorkItems, runningCount.fetch_add(1, std::memory_order_relaxed) + 1);
+    workItem->run();
+    workItem->deref();
+    runningCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void WorkStealingThreadPool::wakeUpWorker(void)
+{
+    if(sleepingCount.load() > 0)
+    {
+        SmartMutexLock lock(sleepMutex);
+        sleepCondVar.signal();
+    }
+}
+
+inline void WorkStealingThreadPool::updateMax(std::atomic<int> &maxValue, int value)
+{
+    int current = maxValue.load(std::memory_order_relaxed);
+    while((value > current) && !maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+#endif//_TASK_WORK_STEALING_THREAD_POOL_H
@@ -0,0 +1,416 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  util/FlatPropertySet.h                                                                      *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  1. SimplePropertySet on a flat open-addressing table, hashed over the full key.             *
+ *                2. Interned keys, whose lookups compare pointers instead of strcmp().                       *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _UTIL_FLAT_PROPERTY_SET_H
+#define _UTIL_FLAT_PROPERTY_SET_H
+
+// Standard includes
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+// libBase includes
+#include <container/HashTable.h>
+#include <osal/OsalMutex.h>
+#include <util/SmartMutexLock.h>
+
+// Key of property tables, hashed once.
+struct _PropertyKey
+{
+    const char *name;
+    uint32_t hash;
+    // name is got from PropertyKeys::intern().
+    bool isInterned;
+};
+
+// 1. The same pointer is the same key, w/o strcmp().
+// 2. Different interned pointers are different keys, w/o strcmp() either.
+static inline bool operator==(const _PropertyKey &stored, const _PropertyKey &key)
+{
+    if(stored.name == key.name)
+    {
+        return true;
+    }
+    if(stored.isInterned && key.isInterned)
+    {
+        return false;
+    }
+    return strcmp(stored.name, key.name) == 0;
+}
+
+struct _PropertyKeyHash
+{
+    uint32_t operator()(const _PropertyKey &key) const
+    {
+        return key.hash;
+    }
+};
+
+/*!
+ * @brief Interned property keys, one copy of each key string for the process, w/ its hash.
+ *
+ * @remarks
+ *   1. Intern keys once, e.g. to static members, and use them w/ getInterned()/setInterned() of FlatPropertySet
+ *      on hot paths, which neither hash nor strcmp().
+ *   2. Interned keys are never freed, keys should be a bounded set, e.g. field names, not values.
+ *   3. Interned keys are stored in arenas of the registry, not allocated one by one, so isInterned() tells them
+ *      by address, w/o taking the mutex, and they are never passed to free().
+ *   4. Multi-thread-safe.
+ */
+class PropertyKeys
+{
+  public:
+    // Return the interned copy of name, the same pointer for the same string.
+    static const char *intern(const char *name);
+    // FNV-1a over the full string, mixed by hashMix().
+    static uint32_t hash(const char *name);
+    // The hash kept w/ an interned key, name should be got from intern().
+    static uint32_t hashOfInterned(const char *internedName);
+    // Return true if name is got from intern(), it should not be free().
+    static bool isInterned(const char *name);
+
+  private:
+    static const size_t ARENA_SIZE = 4096;
+
+    // Interned keys are allocated from it, each as its hash followed by the string.
+    struct Arena
+    {
+        Arena *next;
+        uintptr_t begin;
+        uintptr_t end;
+    };
+
+    struct Entry
+    {
+        _PropertyKey key;
+
+        Entry(const _PropertyKey &_key, bool) : key(_key)
+        {
+        }
+    };
+
+    struct KeyOf
+    {
+        static const _PropertyKey &key(const Entry &entry)
+        {
+            return entry.key;
+        }
+    };
+
+    // Pushed under mutex, and walked w/o it by isInterned().  Arenas are never freed.
+    std::atomic<Arena *> arenas;
+    OsalMutex mutex;
+    // Below are protected by mutex.
+    _HashTable<Entry, _PropertyKey, KeyOf, _PropertyKeyHash> keys;
+    // Free space of the newest arena.
+    uintptr_t cursor;
+    uintptr_t limit;
+
+    PropertyKeys(void);
+    static PropertyKeys *getInstance(void);
+    // Return space of size bytes, aligned for the hash, w/ mutex locked.
+    void *allocate(size_t size);
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    PropertyKeys(const PropertyKeys &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    PropertyKeys &operator=(const PropertyKeys &);
+};
+
+/*!
+ * @brief SimplePropertySet w/ the same methods, on a flat open-addressing table.
+ *
+ * @remarks
+ *   1. Keys are hashed over the whole string, so keys sharing a prefix, e.g. "cameraConfig1"/"cameraConfig2",
+ *      don't collide like CStringHash of SimplePropertySet, which sums the first 10 characters only.
+ *   2. Entries (key, hash and value) are in one array, w/o a node allocation for each property.  A lookup
+ *      probes adjacent slots, and compares keys only on equal hashes.
+ *   3. Keys got from PropertyKeys::intern() can be used by getInterned()/setInterned(), which take the hash
+ *      kept w/ the key, and compare pointers only against other interned keys.  They can be mixed w/ plain
+ *      keys of the same strings in get()/set(), and also passed to get()/set() themselves.
+ *   4. All key and value's lifetime should be managed by clients well, the same as SimplePropertySet.
+ *   5. Entries move on set()/remove(), enumerate() should not change the set.
+ */
+class FlatPropertySet
+{
+  public:
+    FlatPropertySet(void);
+
+    int size(void);
+    void *get(const char *name);
+    void set(const char *name, void *value);
+    // orgNameHolder gets 0 if the key is interned, so it's always free()-able.
+    bool remove(const char *name, char **orgNameHolder = 0, void **valueHolder = 0);
+    // Nothing is free().
+    void reset(void);
+    // free() is used, so, all values should be generated by alloc(), malloc(), strdup(), or whatever
+    // free()-able functions.
+    void freeAllValuesAndReset(void);
+    // 1. free() is used, so, all keys and values should be generated by alloc(), malloc(), strdup(), or
+    //    whatever free()-able functions.
+    // 2. Interned keys are not free(), even if they are set by set().
+    void freeAllKeysAndValuesAndReset(void);
+
+    // internedName should be got from PropertyKeys::intern().
+    void *getInterned(const char *internedName);
+    void setInterned(const char *internedName, void *value);
+
+    // visitor is called for each property, in no particular order.
+    void enumerate(void (*visitor)(void *context, const char *name, void *value), void *context);
+
+  private:
+    struct Entry
+    {
+        _PropertyKey key;
+        void *value;
+
+        Entry(const _PropertyKey &_key, void *_value) : key(_key), value(_value)
+        {
+        }
+    };
+
+    struct KeyOf
+    {
+        static const _PropertyKey &key(const Entry &entry)
+        {
+            return entry.key;
+        }
+    };
+
+    _HashTable<Entry, _PropertyKey, KeyOf, _PropertyKeyHash> table;
+
+    // Declared as private to disallow the access.
+    FlatPropertySet(FlatPropertySet &src);
+    FlatPropertySet &operator=(FlatPropertySet &src);
+
+    static _PropertyKey plainKey(const char *name);
+    static _PropertyKey internedKey(const char *internedName);
+    void *getByKey(const _PropertyKey &key);
+    void setByKey(const _PropertyKey &key, void *value);
+};
+
+/* Implementation for PropertyKeys */
+
+inline PropertyKeys::PropertyKeys(void) : arenas(0), cursor(0), limit(0)
+{
+}
+
+inline PropertyKeys *PropertyKeys::getInstance(void)
+{
+    // Never deleted, interned keys live as long as the process.
+    static PropertyKeys *propertyKeys = new PropertyKeys();
+    return propertyKeys;
+}
+
+inline uint32_t PropertyKeys::hash(const char *name)
+{
+    uint64_t value = 0xcbf29ce484222325ULL;
+    for(const unsigned char *ptr = (const unsigned char *) name; *ptr; ++ptr)
+    {
+        value = (value ^ *ptr) * 0x100000001b3ULL;
+    }
+    return hashMix(value);
+}
+
+inline uint32_t PropertyKeys::hashOfInterned(const char *internedName)
+{
+    // The hash is stored right before the string, see intern().
+    return ((const uint32_t *) internedName)[-1];
+}
+
+inline bool PropertyKeys::isInterned(const char *name)
+{
+    uintptr_t address = (uintptr_t) name;
+    for(Arena *arena = getInstance()->arenas.load(std::memory_order_acquire); arena; arena = arena->next)
+    {
+        if((address >= arena->begin) && (address < arena->end))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void *PropertyKeys::allocate(size_t size)
+{
+    cursor = (cursor + sizeof(uint32_t) - 1) & ~(uintptr_t) (sizeof(uint32_t) - 1);
+    if(cursor + size > limit)
+    {
+        // Keys longer than an arena get an arena of their own.
+        size_t arenaSize = (size > ARENA_SIZE) ? size : ARENA_SIZE;
+        Arena *arena = (Arena *) malloc(sizeof(Arena) + arenaSize);
+        arena->begin = (uintptr_t) (arena + 1);
+        arena->end = arena->begin + arenaSize;
+        arena->next = arenas.load(std::memory_order_relaxed);
+        arenas.store(arena, std::memory_order_release);
+        cursor = arena->begin;
+        limit = arena->end;
+    }
+    void *space = (void *) cursor;
+    cursor += size;
+    return space;
+}
+
+inline const char *PropertyKeys::intern(const char *name)
+{
+    PropertyKeys *propertyKeys = getInstance();
+    _PropertyKey key = { name, hash(name), false };
+    SmartMutexLock lock(propertyKeys->mutex);
+    int slot = propertyKeys->keys.find(key);
+    if(slot >= 0)
+    {
+        return propertyKeys->keys.at(slot).key.name;
+    }
+    size_t len = strlen(name);
+    uint32_t *block = (uint32_t *) propertyKeys->allocate(sizeof(uint32_t) + len + 1);
+    block[0] = key.hash;
+    char *internedName = (char *) (block + 1);
+    memcpy(internedName, name, len + 1);
+    key.name = internedName;
+    key.isInterned = true;
+    bool isAdded;
+    propertyKeys->keys.findOrAdd(key, true, isAdded);
+    return internedName;
+}
+
+/* Implementation for FlatPropertySet */
+
+inline FlatPropertySet::FlatPropertySet(void)
+{
+}
+
+inline _PropertyKey FlatPropertySet::plainKey(const char *name)
+{
+    _PropertyKey key = { name, PropertyKeys::hash(name), false };
+    return key;
+}
+
+inline _PropertyKey FlatPropertySet::internedKey(const char *internedName)
+{
+    _PropertyKey key = { internedName, PropertyKeys::hashOfInterned(internedName), true };
+    return key;
+}
+
+inline int FlatPropertySet::size(void)
+{
+    return table.size();
+}
+
+inline void *FlatPropertySet::getByKey(const _PropertyKey &key)
+{
+    int slot = table.find(key);
+    return (slot < 0) ? 0 : table.at(slot).value;
+}
+
+inline void FlatPropertySet::setByKey(const _PropertyKey &key, void *value)
+{
+    bool isAdded;
+    int slot = table.findOrAdd(key, value, isAdded);
+    if(!isAdded)
+    {
+        // The original key is kept, the same as SimplePropertySet.
+        table.at(slot).value = value;
+    }
+}
+
+inline void *FlatPropertySet::get(const char *name)
+{
+    return getByKey(plainKey(name));
+}
+
+inline void FlatPropertySet::set(const char *name, void *value)
+{
+    setByKey(plainKey(name), value);
+}
+
+inline void *FlatPropertySet::getInterned(const char *internedName)
+{
+    return getByKey(internedKey(internedName));
+}
+
+inline void FlatPropertySet::setInterned(const char *internedName, void *value)
+{
+    setByKey(internedKey(internedName), value);
+}
+
+inline bool FlatPropertySet::remove(const char *name, char **orgNameHolder, void **valueHolder)
+{
+    int slot = table.find(plainKey(name));
+    if(slot < 0)
+    {
+        return false;
+    }
+    if(orgNameHolder)
+    {
+        const char *orgName = table.at(slot).key.name;
+        *orgNameHolder = PropertyKeys::isInterned(orgName) ? 0 : (char *) orgName;
+    }
+    if(valueHolder)
+    {
+        *valueHolder = table.at(slot).value;
+    }
+    table.removeAt(slot);
+    return true;
+}
+
+inline void FlatPropertySet::reset(void)
+{
+    table.clear();
+}
+
+inline void FlatPropertySet::freeAllValuesAndReset(void)
+{
+    int capacity = table.capacity();
+    for(int slot = 0; slot < capacity; ++slot)
+    {
+        if(table.isUsed(slot))
+        {
+            free(table.at(slot).value);
+        }
+    }
+    table.clear();
+}
+
+inline void FlatPropertySet::freeAllKeysAndValuesAndReset(void)
+{
+    int capacity = table.capacity();
+    for(int slot = 0; slot < capacity; ++slot)
+    {
+        if(table.isUsed(slot))
+        {
+            Entry &entry = table.at(slot);
+            if(!entry.key.isInterned && !PropertyKeys::isInterned(entry.key.name))
+            {
+                free((void *) entry.key.name);
+            }
+            free(entry.value);
+        }
+    }
+    table.clear();
+}
+
+inline void FlatPropertySet::enumerate(void (*visitor)(void *context, const char *name, void *value),
+                                       void *context)
+{
+    int capacity = table.capacity();
+    for(int slot = 0; slot < capacity; ++slot)
+    {
+        if(table.isUsed(slot))
+        {
+            visitor(context, table.at(slot).key.name, table.at(slot).value);
+        }
+    }
+}
+
+#endif //_UTIL_FLAT_PROPERTY_SET_H
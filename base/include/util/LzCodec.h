@@ -0,0 +1,392 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  util/LzCodec.h                                                                              *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Fast LZ77 codec (LZ4 styled sequences) for logs, by independent blocks, so files are        *
+ *                compressed/decompressed incrementally with bounded memory.  No dependency to libBase binary.*
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _UTIL_LZ_CODEC_H
+#define _UTIL_LZ_CODEC_H
+
+// Standard includes
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+// libBase includes
+#include <baseResultCode.h>
+
+/*
+.lz file layout:
+1. LZ_FILE_MAGIC.
+2. Blocks, each is uint32_t rawSize (LZ_BLOCK_STORED flag if data is not compressed), uint32_t dataSize, then
+   dataSize bytes.  Little endian.
+3. End block, rawSize and dataSize are both 0.  Files w/o it are truncated.
+*/
+#define LZ_FILE_MAGIC               "EVOLZ001"
+#define LZ_FILE_MAGIC_SIZE          8
+// Uncompressed bytes per block, offsets are 16 bits, so it cannot exceed 64K.
+#define LZ_BLOCK_SIZE               (64 * 1024)
+#define LZ_BLOCK_STORED             0x80000000u
+
+class LzCodec
+{
+  public:
+    // Max compressed size of srcSize bytes.
+    static int compressBound(int srcSize);
+    // 1. srcSize <= LZ_BLOCK_SIZE.  Return the compressed size, or MIO_ERR_OUT_OF_RANGE if dstCapacity is not
+    //    enough (compressBound() is always enough).
+    // 2. hashTable is LzCodec::HASH_TABLE_SIZE entries, it is overwritten.
+    static int compressBlock(const void *src, int srcSize, void *dst, int dstCapacity, uint16_t *hashTable);
+    // Return the decompressed size, or MIO_ERR_INVALID_DATA if src is corrupted or dstCapacity is not enough.
+    static int decompressBlock(const void *src, int srcSize, void *dst, int dstCapacity);
+
+    // 1. Compress/decompress whole files block by block, memory usage is about 3 blocks.
+    // 2. Return MIO_GENERAL_OK, MIO_ERR_IO_GENERAL, MIO_ERR_OUT_OF_MEMORY, or MIO_ERR_INVALID_DATA
+    //    (decompressFile() only, data decoded before the error is still written).
+    // 3. dstFile is created or truncated.
+    static int compressFile(const char *srcFilePath, const char *dstFilePath);
+    static int decompressFile(const char *srcFilePath, const char *dstFilePath);
+    // dst is written from the current position, and not closed.
+    static int decompressFile(FILE *src, FILE *dst);
+
+    enum
+    {
+        HASH_TABLE_BITS = 12,
+        HASH_TABLE_SIZE = 1 << HASH_TABLE_BITS,
+        MIN_MATCH = 4
+    };
+
+  private:
+    static uint32_t read32(const uint8_t *ptr);
+    static uint8_t *writeLength(uint8_t *op, int len);
+    static bool writeUInt32s(FILE *fp, uint32_t value1, uint32_t value2);
+    static bool readUInt32s(FILE *fp, uint32_t *value1, uint32_t *value2);
+};
+
+inline int LzCodec::compressBound(int srcSize)
+{
+    return srcSize + srcSize / 255 + 16;
+}
+
+inline uint32_t LzCodec::read32(const uint8_t *ptr)
+{
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+inline uint8_t *LzCodec::writeLength(uint8_t *op, int len)
+{
+    for(; len >= 255; len -= 255)
+    {
+        *op++ = 255;
+    }
+    *op++ = (uint8_t) len;
+    return op;
+}
+
+inline int LzCodec::compressBlock(const void *_src, int srcSize, void *_dst, int dstCapacity,
+                                                                                            uint16_t *hashTable)
+{
+    const uint8_t *src = (const uint8_t *) _src;
+    uint8_t *dst = (uint8_t *) _dst;
+    uint8_t *op = dst;
+    // Worst case of one sequence: token + length bytes + literals + offset + match length bytes.
+    uint8_t *opLimit = dst + dstCapacity;
+    int ip = 0;
+    int anchor = 0;
+    memset(hashTable, 0, HASH_TABLE_SIZE * sizeof(uint16_t));
+
+    while(ip + MIN_MATCH <= srcSize)
+    {
+        uint32_t sequence = read32(src + ip);
+        uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_TABLE_BITS);
+        int ref = hashTable[hash];
+        hashTable[hash] = (uint16_t) ip;
+        if((ref >= ip) || (read32(src + ref) != sequence))
+        {
+            // Skip faster in incompressible data.
+            ip += 1 + ((ip - anchor) >> 6);
+            continue;
+        }
+        int matchLen = MIN_MATCH;
+        while((ip + matchLen < srcSize) && (src[ref + matchLen] == src[ip + matchLen]))
+        {
+            ++matchLen;
+        }
+
+        int literalLen = ip - anchor;
+        if(op + 1 + literalLen / 255 + 1 + literalLen + 2 + (matchLen - MIN_MATCH) / 255 + 1 > opLimit)
+        {
+            return MIO_ERR_OUT_OF_RANGE;
+        }
+        uint8_t *token = op++;
+        *token = (uint8_t) (((literalLen < 15) ? literalLen : 15) << 4);
+        if(literalLen >= 15)
+        {
+            op = writeLength(op, literalLen - 15);
+        }
+        memcpy(op, src + anchor, literalLen);
+        op += literalLen;
+        int offset = ip - ref;
+        *op++ = (uint8_t) offset;
+        *op++ = (uint8_t) (offset >> 8);
+        int extraLen = matchLen - MIN_MATCH;
+        *token |= (uint8_t) ((extraLen < 15) ? extraLen : 15);
+        if(extraLen >= 15)
+        {
+            op = writeLength(op, extraLen - 15);
+        }
+        ip += matchLen;
+        anchor = ip;
+    }
+
+    // Last literals, w/o match.
+    int literalLen = srcSize - anchor;
+    if(op + 1 + literalLen / 255 + 1 + literalLen > opLimit)
+    {
+        return MIO_ERR_OUT_OF_RANGE;
+    }
+    *op++ = (uint8_t) (((literalLen < 15) ? literalLen : 15) << 4);
+    if(literalLen >= 15)
+    {
+        op = writeLength(op, literalLen - 15);
+    }
+    memcpy(op, src + anchor, literalLen);
+    op += literalLen;
+    return (int) (op - dst);
+}
+
+inline int LzCodec::decompressBlock(const void *_src, int srcSize, void *_dst, int dstCapacity)
+{
+    const uint8_t *ip = (const uint8_t *) _src;
+    const uint8_t *ipEnd = ip + srcSize;
+    uint8_t *dst = (uint8_t *) _dst;
+    uint8_t *op = dst;
+    uint8_t *opEnd = dst + dstCapacity;
+
+    while(ip < ipEnd)
+    {
+        int token = *ip++;
+        int literalLen = token >> 4;
+        if(literalLen == 15)
+        {
+            int value;
+            do
+            {
+                if(ip >= ipEnd)
+                {
+                    return MIO_ERR_INVALID_DATA;
+                }
+                value = *ip++;
+                literalLen += value;
+            } while(value == 255);
+        }
+        if((literalLen > ipEnd - ip) || (literalLen > opEnd - op))
+        {
+            return MIO_ERR_INVALID_DATA;
+        }
+        memcpy(op, ip, literalLen);
+        ip += literalLen;
+        op += literalLen;
+        if(ip == ipEnd)
+        {
+            // The last sequence has literals only.
+            break;
+        }
+
+        if(ipEnd - ip < 2)
+        {
+            return MIO_ERR_INVALID_DATA;
+        }
+        int offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        int matchLen = (token & 15) + MIN_MATCH;
+        if((token & 15) == 15)
+        {
+            int value;
+            do
+            {
+                if(ip >= ipEnd)
+                {
+                    return MIO_ERR_INVALID_DATA;
+                }
+                value = *ip++;
+                matchLen += value;
+            } while(value == 255);
+        }
+        if((offset == 0) || (offset > op - dst) || (matchLen > opEnd - op))
+        {
+            return MIO_ERR_INVALID_DATA;
+        }
+        // Byte by byte, the match may overlap the output.
+        const uint8_t *ref = op - offset;
+        for(int i = 0; i < matchLen; ++i)
+        {
+            op[i] = ref[i];
+        }
+        op += matchLen;
+    }
+    return (int) (op - dst);
+}
+
+inline bool LzCodec::writeUInt32s(FILE *fp, uint32_t value1, uint32_t value2)
+{
+    uint8_t bytes[8];
+    for(int i = 0; i < 4; ++i)
+    {
+        bytes[i] = (uint8_t) (value1 >> (i * 8));
+        bytes[4 + i] = (uint8_t) (value2 >> (i * 8));
+    }
+    return fwrite(bytes, 1, sizeof(bytes), fp) == sizeof(bytes);
+}
+
+inline bool LzCodec::readUInt32s(FILE *fp, uint32_t *value1, uint32_t *value2)
+{
+    uint8_t bytes[8];
+    if(fread(bytes, 1, sizeof(bytes), fp) != sizeof(bytes))
+    {
+        return false;
+    }
+    *value1 = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+    *value2 = bytes[4] | (bytes[5] << 8) | (bytes[6] << 16) | ((uint32_t) bytes[7] << 24);
+    return true;
+}
+
+inline int LzCodec::compressFile(const char *srcFilePath, const char *dstFilePath)
+{
+    FILE *src = fopen(srcFilePath, "rb");
+    if(!src)
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    FILE *dst = fopen(dstFilePath, "wb");
+    if(!dst)
+    {
+        fclose(src);
+        return MIO_ERR_IO_GENERAL;
+    }
+    uint8_t *rawBuf = (uint8_t *) malloc(LZ_BLOCK_SIZE);
+    uint8_t *compressedBuf = (uint8_t *) malloc(compressBound(LZ_BLOCK_SIZE));
+    uint16_t *hashTable = (uint16_t *) malloc(HASH_TABLE_SIZE * sizeof(uint16_t));
+    int result = MIO_GENERAL_OK;
+    if(!rawBuf || !compressedBuf || !hashTable)
+    {
+        result = MIO_ERR_OUT_OF_MEMORY;
+    }
+    else if(fwrite(LZ_FILE_MAGIC, 1, LZ_FILE_MAGIC_SIZE, dst) != LZ_FILE_MAGIC_SIZE)
+    {
+        result = MIO_ERR_IO_GENERAL;
+    }
+    while(result == MIO_GENERAL_OK)
+    {
+        int rawSize = (int) fread(rawBuf, 1, LZ_BLOCK_SIZE, src);
+        if(rawSize <= 0)
+        {
+            result = (ferror(src) || !writeUInt32s(dst, 0, 0)) ? MIO_ERR_IO_GENERAL : MIO_GENERAL_OK;
+            break;
+        }
+        int size = compressBlock(rawBuf, rawSize, compressedBuf, compressBound(LZ_BLOCK_SIZE), hashTable);
+        bool isStored = (size < 0) || (size >= rawSize);
+        if(!writeUInt32s(dst, rawSize | (isStored ? LZ_BLOCK_STORED : 0), isStored ? rawSize : size) ||
+           (fwrite(isStored ? rawBuf : compressedBuf, 1, isStored ? rawSize : size, dst) !=
+                                                                            (size_t) (isStored ? rawSize : size)))
+        {
+            result = MIO_ERR_IO_GENERAL;
+        }
+    }
+    free(rawBuf);
+    free(compressedBuf);
+    free(hashTable);
+    fclose(src);
+    if(fclose(dst) != 0)
+    {
+        result = MIO_ERR_IO_GENERAL;
+    }
+    return result;
+}
+
+inline int LzCodec::decompressFile(const char *srcFilePath, const char *dstFilePath)
+{
+    FILE *src = fopen(srcFilePath, "rb");
+    if(!src)
+    {
+        return MIO_ERR_IO_GENERAL;
+    }
+    FILE *dst = fopen(dstFilePath, "wb");
+    if(!dst)
+    {
+        fclose(src);
+        return MIO_ERR_IO_GENERAL;
+    }
+    int result = decompressFile(src, dst);
+    fclose(src);
+    if((fclose(dst) != 0) && (result == MIO_GENERAL_OK))
+    {
+        result = MIO_ERR_IO_GENERAL;
+    }
+    return result;
+}
+
+inline int LzCodec::decompressFile(FILE *src, FILE *dst)
+{
+    char magic[LZ_FILE_MAGIC_SIZE];
+    if((fread(magic, 1, sizeof(magic), src) != sizeof(magic)) ||
+       (memcmp(magic, LZ_FILE_MAGIC, LZ_FILE_MAGIC_SIZE) != 0))
+    {
+        return MIO_ERR_INVALID_DATA;
+    }
+    uint8_t *rawBuf = (uint8_t *) malloc(LZ_BLOCK_SIZE);
+    uint8_t *compressedBuf = (uint8_t *) malloc(compressBound(LZ_BLOCK_SIZE));
+    int result = (rawBuf && compressedBuf) ? MIO_GENERAL_OK : MIO_ERR_OUT_OF_MEMORY;
+    while(result == MIO_GENERAL_OK)
+    {
+        uint32_t rawSize;
+        uint32_t dataSize;
+        if(!readUInt32s(src, &rawSize, &dataSize))
+        {
+            // Truncated, w/o the end block.
+            result = MIO_ERR_INVALID_DATA;
+            break;
+        }
+        if((rawSize == 0) && (dataSize == 0))
+        {
+            break;
+        }
+        bool isStored = (rawSize & LZ_BLOCK_STORED) != 0;
+        rawSize &= ~LZ_BLOCK_STORED;
+        if((rawSize > LZ_BLOCK_SIZE) || (dataSize > (uint32_t) compressBound(LZ_BLOCK_SIZE)) ||
+           (isStored && (dataSize != rawSize)) || (fread(compressedBuf, 1, dataSize, src) != dataSize))
+        {
+            result = MIO_ERR_INVALID_DATA;
+            break;
+        }
+        const uint8_t *data = compressedBuf;
+        if(!isStored)
+        {
+            if(decompressBlock(compressedBuf, dataSize, rawBuf, rawSize) != (int) rawSize)
+            {
+                result = MIO_ERR_INVALID_DATA;
+                break;
+            }
+            data = rawBuf;
+        }
+        if(fwrite(data, 1, rawSize, dst) != rawSize)
+        {
+            result = MIO_ERR_IO_GENERAL;
+        }
+    }
+    free(rawBuf);
+    free(compressedBuf);
+    return result;
+}
+
+#endif//_UTIL_LZ_CODEC_H
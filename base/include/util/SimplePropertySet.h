@@ -11,7 +11,7 @@
  * DESCRIPTION :  Offer very simple property object, usually for objects' client data support.                *
  *------------------------------------------------------------------------------------------------------------*/
 
-// TODO: add enumeration with function pointer.
+// TODO: add enumeration with function pointer (FlatPropertySet has enumerate()).
 
 #ifndef _UTIL_SIMPLE_PROPERTY_SET_H
 #define _UTIL_SIMPLE_PROPERTY_SET_H
@@ -45,6 +45,10 @@ struct CStringHashEqual
 
 // All key and value's lifetime should be managed by clients well.  And usually, keys (name) are usually
 // constant string literals, and cannot be deleted or free(), so, it's not a problem for keys.
+//
+// CStringHash and the layout are kept as they are, for objects built in libBase, e.g. SimpleJsonObj.  New codes
+// should use FlatPropertySet (util/FlatPropertySet.h), w/ the same methods, hashed over the full key, and
+// enumerate().
 class SimplePropertySet
 {
   public:
@@ -0,0 +1,68 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  libBase                                                                                     *
+ * FILE NAME   :  util/SmartLock.h                                                                            *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  SmartMutexLock of any lock class, e.g. OsalAdaptiveMutex and OsalRwLock.                    *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#ifndef _UTIL_SMART_LOCK_H
+#define _UTIL_SMART_LOCK_H
+
+/*!
+ * @brief Smart lock, which will lock() the embedded lock when constructing, and unlock() it when destructing.
+ */
+template <class L>
+class SmartLock
+{
+  public:
+    SmartLock(L &lock) : _lock(lock)
+    {
+        _lock.lock();
+    }
+    ~SmartLock()
+    {
+        _lock.unlock();
+    }
+
+  private:
+    L &_lock;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    SmartLock(SmartLock &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    SmartLock &operator=(SmartLock &);
+};
+
+/*!
+ * @brief Smart shared lock, which will lockShared() the embedded lock when constructing, and unlockShared() it
+ *        when destructing.
+ */
+template <class L>
+class SmartSharedLock
+{
+  public:
+    SmartSharedLock(L &lock) : _lock(lock)
+    {
+        _lock.lockShared();
+    }
+    ~SmartSharedLock()
+    {
+        _lock.unlockShared();
+    }
+
+  private:
+    L &_lock;
+
+    // Private copy constructor is declared but not defined to prevent accident copy.
+    SmartSharedLock(SmartSharedLock &);
+    // Private assignment operator is declared but not defined to prevent accident assignment.
+    SmartSharedLock &operator=(SmartSharedLock &);
+};
+
+#endif//_UTIL_SMART_LOCK_H
@@ -0,0 +1,338 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  CoroutineBenchmark                                                                          *
+ * FILE NAME   :  CoroutineBenchmark.cpp                                                                      *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Context switch and concurrent flow costs of coroutine tasks vs threads, as JSON lines.      *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <osal/OsalCondVar.h>
+#include <osal/OsalMutex.h>
+#include <task/Future.h>
+#include <task/Task.h>
+#include <task/Thread.h>
+#include <task/ThreadPool.h>
+#include <util/SmartMutexLock.h>
+
+struct BenchConfig
+{
+    int rounds;
+    int maxFlows;
+    int steps;
+    int sleepMS;
+    FILE *output;
+};
+
+static inline uint64_t nowNS(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+// A field of /proc/self/status, in its unit (kB for memory).
+static long readStatus(const char *field)
+{
+    FILE *file = fopen("/proc/self/status", "r");
+    if(!file)
+    {
+        return -1;
+    }
+    char line[256];
+    long value = -1;
+    size_t fieldLen = strlen(field);
+    while(fgets(line, sizeof(line), file))
+    {
+        if((strncmp(line, field, fieldLen) == 0) && (line[fieldLen] == ':'))
+        {
+            value = atol(line + fieldLen + 1);
+            break;
+        }
+    }
+    fclose(file);
+    return value;
+}
+
+/* Ping-pong, main and its partner hand a turn to each other, 2 switches per round */
+
+struct ThreadPingPong
+{
+    OsalMutex mutex;
+    OsalCondVar condVarPartner;
+    OsalCondVar condVarMain;
+    bool isPartnerTurn;
+    int rounds;
+};
+
+static void threadPartner(ThreadPingPong *pingPong)
+{
+    SmartMutexLock lock(pingPong->mutex);
+    for(int i = 0; i < pingPong->rounds; ++i)
+    {
+        while(!pingPong->isPartnerTurn)
+        {
+            pingPong->condVarPartner.wait(pingPong->mutex);
+        }
+        pingPong->isPartnerTurn = false;
+        pingPong->condVarMain.signal();
+    }
+}
+
+static double runThreadPingPong(int rounds)
+{
+    ThreadPingPong pingPong;
+    pingPong.isPartnerTurn = false;
+    pingPong.rounds = rounds;
+    std::thread partner(threadPartner, &pingPong);
+    uint64_t beginNS = nowNS();
+    {
+        SmartMutexLock lock(pingPong.mutex);
+        for(int i = 0; i < rounds; ++i)
+        {
+            pingPong.isPartnerTurn = true;
+            pingPong.condVarPartner.signal();
+            while(pingPong.isPartnerTurn)
+            {
+                pingPong.condVarMain.wait(pingPong.mutex);
+            }
+        }
+    }
+    uint64_t endNS = nowNS();
+    partner.join();
+    return endNS - beginNS;
+}
+
+// Resumed inline by TaskEvent::set() of main, and suspended again before set() returns.
+static Task<> coroutinePartner(TaskEvent *event, const bool *shouldStop, int *count)
+{
+    for(;;)
+    {
+        co_await *event;
+        event->reset();
+        if(*shouldStop)
+        {
+            break;
+        }
+        ++*count;
+    }
+}
+
+static double runCoroutinePingPong(int rounds)
+{
+    TaskEvent event;
+    bool shouldStop = false;
+    int count = 0;
+    Future<int> done = coroutinePartner(&event, &shouldStop, &count).start();
+    uint64_t beginNS = nowNS();
+    for(int i = 0; i < rounds; ++i)
+    {
+        event.set();
+    }
+    uint64_t endNS = nowNS();
+    shouldStop = true;
+    event.set();
+    done.wait();
+    if(count != rounds)
+    {
+        fprintf(stderr, "Coroutine ping-pong ran %d of %d rounds\n", count, rounds);
+    }
+    return endNS - beginNS;
+}
+
+// Hops between pooled threads, each hop is a work item of GlobalThreadPool.
+static Task<int> coroutineHops(int hops)
+{
+    for(int i = 0; i < hops; ++i)
+    {
+        int result = co_await Tasks::resumeOn(FutureExecutor::globalPool());
+        if(result != MIO_GENERAL_OK)
+        {
+            co_return result;
+        }
+    }
+    co_return MIO_GENERAL_OK;
+}
+
+static double runCoroutineHops(int hops)
+{
+    uint64_t beginNS = nowNS();
+    int result = MIO_GENERAL_OK;
+    int getResult = coroutineHops(hops).start().get(&result);
+    uint64_t endNS = nowNS();
+    if(getResult != MIO_GENERAL_OK)
+    {
+        result = getResult;
+    }
+    if(result != MIO_GENERAL_OK)
+    {
+        fprintf(stderr, "Coroutine hops failed, %d\n", result);
+    }
+    return endNS - beginNS;
+}
+
+static void reportSwitches(const BenchConfig &config, const char *impl, int switches, double wallNS)
+{
+    fprintf(config.output, "{\"case\":\"switch\",\"impl\":\"%s\",\"switches\":%d,\"nsPerSwitch\":%.1f,"
+            "\"wallMS\":%.1f}\n", impl, switches, wallNS / switches, wallNS / 1e6);
+    fflush(config.output);
+}
+
+/* Flows, each one waits steps times for sleepMS, as a thread or as a task */
+
+struct FlowSample
+{
+    long rssKB;
+    long threads;
+};
+
+static void threadFlow(int steps, int sleepMS)
+{
+    for(int i = 0; i < steps; ++i)
+    {
+        Thread::msleep(sleepMS);
+    }
+}
+
+static Task<> coroutineFlow(int steps, int sleepMS)
+{
+    for(int i = 0; i < steps; ++i)
+    {
+        co_await Tasks::sleep(sleepMS);
+    }
+}
+
+static double runThreadFlows(int flows, int steps, int sleepMS, FlowSample *sample)
+{
+    uint64_t beginNS = nowNS();
+    std::vector<std::thread> threads;
+    threads.reserve(flows);
+    for(int i = 0; i < flows; ++i)
+    {
+        threads.push_back(std::thread(threadFlow, steps, sleepMS));
+    }
+    sample->rssKB = readStatus("VmRSS");
+    sample->threads = readStatus("Threads");
+    for(int i = 0; i < flows; ++i)
+    {
+        threads[i].join();
+    }
+    return nowNS() - beginNS;
+}
+
+static double runCoroutineFlows(int flows, int steps, int sleepMS, FlowSample *sample)
+{
+    uint64_t beginNS = nowNS();
+    std::vector<Future<int> > dones;
+    dones.reserve(flows);
+    for(int i = 0; i < flows; ++i)
+    {
+        dones.push_back(coroutineFlow(steps, sleepMS).start());
+    }
+    sample->rssKB = readStatus("VmRSS");
+    sample->threads = readStatus("Threads");
+    for(int i = 0; i < flows; ++i)
+    {
+        dones[i].wait();
+    }
+    return nowNS() - beginNS;
+}
+
+static void reportFlows(const BenchConfig &config, const char *impl, int flows, long baseRssKB, double wallNS,
+                        const FlowSample &sample)
+{
+    double idealNS = (double) config.steps * config.sleepMS * 1e6;
+    fprintf(config.output, "{\"case\":\"flows\",\"impl\":\"%s\",\"flows\":%d,\"steps\":%d,\"sleepMS\":%d,"
+            "\"wallMS\":%.1f,\"overheadMS\":%.1f,\"rssKB\":%ld,\"kbPerFlow\":%.2f,\"threads\":%ld}\n",
+            impl, flows, config.steps, config.sleepMS, wallNS / 1e6, (wallNS - idealNS) / 1e6, sample.rssKB,
+            (double) (sample.rssKB - baseRssKB) / flows, sample.threads);
+    fflush(config.output);
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-n rounds] [-f maxFlows] [-k steps] [-s sleepMS] [-o output.jsonl]\n", name);
+    fprintf(stderr, "  -n  Ping-pong rounds and pool hops (default 100000).\n");
+    fprintf(stderr, "  -f  Max concurrent flows, runs are 16, 64, 256, ... up to it (default 1024).\n");
+    fprintf(stderr, "  -k  Waits per flow (default 20).\n");
+    fprintf(stderr, "  -s  Milliseconds per wait (default 5).\n");
+    fprintf(stderr, "  -o  Write JSON lines to the file instead of stdout.\n");
+}
+
+int main(int argc, char *argv[])
+{
+    BenchConfig config = { 100000, 1024, 20, 5, stdout };
+    int opt;
+    while((opt = getopt(argc, argv, "n:f:k:s:o:h")) != -1)
+    {
+        switch(opt)
+        {
+            case 'n':
+                config.rounds = atoi(optarg);
+                break;
+            case 'f':
+                config.maxFlows = atoi(optarg);
+                break;
+            case 'k':
+                config.steps = atoi(optarg);
+                break;
+            case 's':
+                config.sleepMS = atoi(optarg);
+                break;
+            case 'o':
+                config.output = fopen(optarg, "w");
+                if(!config.output)
+                {
+                    fprintf(stderr, "Cannot open %s\n", optarg);
+                    return 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if((config.rounds <= 0) || (config.maxFlows <= 0) || (config.steps <= 0) || (config.sleepMS <= 0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    fprintf(stderr, "Ping-pong, %d rounds\n", config.rounds);
+    reportSwitches(config, "thread", config.rounds * 2, runThreadPingPong(config.rounds));
+    reportSwitches(config, "coroutine", config.rounds * 2, runCoroutinePingPong(config.rounds));
+    fprintf(stderr, "Pool hops, %d hops\n", config.rounds);
+    reportSwitches(config, "coroutine-pool", config.rounds, runCoroutineHops(config.rounds));
+
+    // The wheel and the pool are up after the runs above, so they are in the base.
+    long baseRssKB = readStatus("VmRSS");
+    for(int flows = 16; flows <= config.maxFlows; flows *= 4)
+    {
+        FlowSample sample;
+        fprintf(stderr, "Flows, %d threads\n", flows);
+        double wallNS = runThreadFlows(flows, config.steps, config.sleepMS, &sample);
+        reportFlows(config, "thread", flows, baseRssKB, wallNS, sample);
+        fprintf(stderr, "Flows, %d coroutines\n", flows);
+        wallNS = runCoroutineFlows(flows, config.steps, config.sleepMS, &sample);
+        reportFlows(config, "coroutine", flows, baseRssKB, wallNS, sample);
+    }
+    if(config.output != stdout)
+    {
+        fclose(config.output);
+    }
+    return 0;
+}
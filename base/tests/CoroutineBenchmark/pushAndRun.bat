@@ -0,0 +1,5 @@
+adb root
+adb shell mkdir /data/test
+adb push project/CoroutineBenchmark /data/test
+adb shell "cd /data/test;chmod a+x CoroutineBenchmark;./CoroutineBenchmark -o /data/test/CoroutineBenchmark.jsonl"
+adb pull /data/test/CoroutineBenchmark.jsonl
\ No newline at end of file
@@ -0,0 +1,541 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  LogBenchmark                                                                                *
+ * FILE NAME   :  LogBenchmark.cpp                                                                            *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Logging throughput/latency benchmark of LogSystem and the loggers, results are JSON lines.  *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <log/AsyncLogger.h>
+#include <log/AutoSerialFileLogger.h>
+#include <log/FileBasedLogger.h>
+#include <log/LogSystem.h>
+#include <log/PreallocatedFileLogger.h>
+#include <log/RingBufferLogger.h>
+#include <log/StringBufferLogger.h>
+#include <log/logMacros.h>
+
+#define BENCH_TAG               "bench"
+#define BENCH_BASE_NAME         "LogBenchmark"
+#define BENCH_FIFO_NAME         "LogBenchmark.fifo"
+#define BENCH_PAYLOAD           "0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+
+enum BenchMode
+{
+    // LogSystem::d() below the threshold, filtered inside LogSystem.
+    BENCH_FILTERED_CALL,
+    // LOG_D() below the threshold, filtered by the macro.
+    BENCH_FILTERED_MACRO,
+    // LogSystem::i(), written by the logger.
+    BENCH_EMITTED
+};
+
+static const char *modeNames[] = { "filtered-call", "filtered-macro", "emitted" };
+
+/* Latency histogram, 16 linear sub-buckets per power of 2 (about 6% precision) */
+
+#define HISTOGRAM_SUB_BITS      4
+#define HISTOGRAM_SUB_COUNT     (1 << HISTOGRAM_SUB_BITS)
+#define HISTOGRAM_BUCKETS       (64 * HISTOGRAM_SUB_COUNT)
+
+struct LatencyHistogram
+{
+    uint64_t counts[HISTOGRAM_BUCKETS];
+    uint64_t total;
+    uint64_t sumNS;
+
+    LatencyHistogram(void) : total(0), sumNS(0)
+    {
+        memset(counts, 0, sizeof(counts));
+    }
+
+    static int bucketOf(uint64_t ns)
+    {
+        if(ns < HISTOGRAM_SUB_COUNT)
+        {
+            return (int) ns;
+        }
+        int msb = 63 - __builtin_clzll(ns);
+        int sub = (int) (ns >> (msb - HISTOGRAM_SUB_BITS)) & (HISTOGRAM_SUB_COUNT - 1);
+        return (msb - HISTOGRAM_SUB_BITS + 1) * HISTOGRAM_SUB_COUNT + sub;
+    }
+
+    // Upper bound of the bucket.
+    static uint64_t valueOf(int bucket)
+    {
+        if(bucket < HISTOGRAM_SUB_COUNT)
+        {
+            return bucket;
+        }
+        int msb = bucket / HISTOGRAM_SUB_COUNT + HISTOGRAM_SUB_BITS - 1;
+        uint64_t sub = bucket % HISTOGRAM_SUB_COUNT;
+        return ((HISTOGRAM_SUB_COUNT + sub + 1) << (msb - HISTOGRAM_SUB_BITS)) - 1;
+    }
+
+    void add(uint64_t ns)
+    {
+        ++counts[bucketOf(ns)];
+        ++total;
+        sumNS += ns;
+    }
+
+    void merge(const LatencyHistogram &other)
+    {
+        for(int i = 0; i < HISTOGRAM_BUCKETS; ++i)
+        {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        sumNS += other.sumNS;
+    }
+
+    uint64_t percentile(double ratio) const
+    {
+        uint64_t rank = (uint64_t) (total * ratio);
+        uint64_t seen = 0;
+        for(int i = 0; i < HISTOGRAM_BUCKETS; ++i)
+        {
+            seen += counts[i];
+            if(seen > rank)
+            {
+                return valueOf(i);
+            }
+        }
+        return 0;
+    }
+};
+
+static inline uint64_t nowNS(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+/* Loggers */
+
+// FileBasedLogger with a fixed filename, FileBasedLogger itself is abstract.
+class BenchFileLogger : public FileBasedLogger
+{
+  public:
+    BenchFileLogger(const char *fullLogDirPath, const char *_filename) :
+        FileBasedLogger(fullLogDirPath), filename(_filename)
+    {
+    }
+
+  protected:
+    virtual std::string generateNextFilename(void)
+    {
+        return filename;
+    }
+
+  private:
+    const std::string filename;
+};
+
+// Writes to the throttled FIFO instead of a new file, if fifoName is not empty.
+template <class T>
+class FifoRedirect : public T
+{
+  public:
+    FifoRedirect(const char *fullLogDirPath, const char *fifoName) : T(fullLogDirPath, BENCH_BASE_NAME),
+        fifoName(fifoName)
+    {
+    }
+
+  protected:
+    virtual std::string generateNextFilename(void)
+    {
+        return fifoName.empty() ? T::generateNextFilename() : fifoName;
+    }
+
+  private:
+    const std::string fifoName;
+};
+
+// Only LogSystem costs, messages are formatted and dropped.
+class NullLogger : public SysLogger
+{
+  public:
+    NullLogger(void) : SysLogger(4096)
+    {
+    }
+
+  protected:
+    virtual void log(const char *, LogLevel, const char *)
+    {
+    }
+};
+
+struct BenchLogger
+{
+    SysLogger *logger;
+    // Owned targets of decorators.
+    SysLogger *target;
+
+    void release(void)
+    {
+        delete logger;
+        delete target;
+    }
+};
+
+static const char *loggerNames[] = { "Null", "StringBuffer", "RingBuffer", "FileBased", "AutoSerial",
+                                     "Preallocated", "Async+AutoSerial" };
+#define BENCH_LOGGER_COUNT      ((int) (sizeof(loggerNames) / sizeof(loggerNames[0])))
+
+static bool isFileLogger(int loggerNdx)
+{
+    return loggerNdx >= 3;
+}
+
+static BenchLogger createLogger(int loggerNdx, const char *dir, const char *fifoName)
+{
+    BenchLogger bench = { 0, 0 };
+    std::string filename = fifoName[0] ? fifoName : BENCH_BASE_NAME ".log";
+    switch(loggerNdx)
+    {
+        case 0:
+            bench.logger = new NullLogger();
+            break;
+        case 1:
+            bench.logger = new StringBufferLogger();
+            break;
+        case 2:
+            bench.logger = new RingBufferLogger(256 * 1024);
+            break;
+        case 3:
+            bench.logger = new BenchFileLogger(dir, filename.c_str());
+            break;
+        case 4:
+            bench.logger = new FifoRedirect<AutoSerialFileLogger>(dir, fifoName);
+            break;
+        case 5:
+        {
+            FifoRedirect<PreallocatedFileLogger> *logger = new FifoRedirect<PreallocatedFileLogger>(dir, fifoName);
+            logger->enablePreallocation(64 * 1024 * 1024);
+            bench.logger = logger;
+            break;
+        }
+        default:
+            bench.target = new FifoRedirect<AutoSerialFileLogger>(dir, fifoName);
+            bench.logger = new AsyncLogger(bench.target, 4096, ASYNC_LOG_DROP_NEWEST);
+            break;
+    }
+    return bench;
+}
+
+/* Throttled target, a FIFO drained at a fixed rate to simulate slow media */
+
+struct FifoDrain
+{
+    int fd;
+    int64_t bytesPerSecond;
+    std::atomic<bool> stopping;
+    std::thread thread;
+
+    FifoDrain(void) : fd(-1), bytesPerSecond(0), stopping(false)
+    {
+    }
+
+    bool start(const std::string &path, int64_t _bytesPerSecond)
+    {
+        bytesPerSecond = _bytesPerSecond;
+        unlink(path.c_str());
+        if(mkfifo(path.c_str(), 0644) != 0)
+        {
+            fprintf(stderr, "mkfifo %s failed, errno %d\n", path.c_str(), errno);
+            return false;
+        }
+        // Opened before the logger, so the logger's open doesn't block.
+        fd = open(path.c_str(), O_RDONLY | O_NONBLOCK);
+        if(fd < 0)
+        {
+            return false;
+        }
+        stopping = false;
+        thread = std::thread([this] { run(); });
+        return true;
+    }
+
+    void run(void)
+    {
+        char buf[4096];
+        uint64_t startNS = nowNS();
+        int64_t total = 0;
+        while(true)
+        {
+            ssize_t len = read(fd, buf, sizeof(buf));
+            if(len > 0)
+            {
+                total += len;
+                // Sleep until the rate allows the bytes read so far.
+                uint64_t dueNS = startNS + (uint64_t) (total * 1000000000LL / bytesPerSecond);
+                uint64_t now = nowNS();
+                if(dueNS > now)
+                {
+                    usleep((useconds_t) ((dueNS - now) / 1000));
+                }
+            }
+            else if((len == 0) && stopping)
+            {
+                // The logger is stopped (the writer is closed), and all written bytes are drained.
+                break;
+            }
+            else
+            {
+                // No writer yet, or nothing to read.
+                usleep(1000);
+            }
+        }
+    }
+
+    void stop(const std::string &path)
+    {
+        stopping = true;
+        thread.join();
+        close(fd);
+        unlink(path.c_str());
+    }
+};
+
+/* Runs */
+
+struct BenchConfig
+{
+    const char *dir;
+    const char *slowDir;
+    int64_t throttleBytesPerSecond;
+    int maxThreads;
+    int messagesPerRun;
+    FILE *output;
+    double timerNS;
+};
+
+static void producer(BenchMode mode, int threadNdx, int count, std::atomic<int> *ready, std::atomic<bool> *go,
+                                                                                   LatencyHistogram *histogram)
+{
+    ready->fetch_add(1);
+    while(!go->load(std::memory_order_acquire))
+    {
+    }
+    for(int i = 0; i < count; ++i)
+    {
+        uint64_t begin = nowNS();
+        switch(mode)
+        {
+            case BENCH_FILTERED_CALL:
+                LogSystem::d(BENCH_TAG, "message %d of thread %d, payload %s", i, threadNdx, BENCH_PAYLOAD);
+                break;
+            case BENCH_FILTERED_MACRO:
+                LOG_D(BENCH_TAG, "message %d of thread %d, payload %s", i, threadNdx, BENCH_PAYLOAD);
+                break;
+            default:
+                LogSystem::i(BENCH_TAG, "message %d of thread %d, payload %s", i, threadNdx, BENCH_PAYLOAD);
+                break;
+        }
+        histogram->add(nowNS() - begin);
+    }
+}
+
+static void runOne(const BenchConfig &config, int loggerNdx, const char *target, const char *dir, bool isThrottled,
+                                                                                      BenchMode mode, int threads)
+{
+    FifoDrain drain;
+    std::string fifoPath = std::string(dir) + "/" + BENCH_FIFO_NAME;
+    if(isThrottled && !drain.start(fifoPath, config.throttleBytesPerSecond))
+    {
+        return;
+    }
+    BenchLogger bench = createLogger(loggerNdx, dir, isThrottled ? BENCH_FIFO_NAME : "");
+    LogSystem *logSystem = LogSystem::getSysLogSystem();
+    logSystem->setLogLevel(LOG_INFO);
+    logSystem->setLogger(bench.logger);
+    logSystem->startLog();
+
+    int count = config.messagesPerRun / threads;
+    std::vector<LatencyHistogram> histograms(threads);
+    std::vector<std::thread> producers;
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    for(int i = 0; i < threads; ++i)
+    {
+        producers.push_back(std::thread(producer, mode, i, count, &ready, &go, &histograms[i]));
+    }
+    while(ready.load() < threads)
+    {
+        usleep(100);
+    }
+    uint64_t beginNS = nowNS();
+    go.store(true, std::memory_order_release);
+    for(int i = 0; i < threads; ++i)
+    {
+        producers[i].join();
+    }
+    uint64_t callsEndNS = nowNS();
+    // Sustained rate includes writing out everything queued or buffered.
+    logSystem->stopLog();
+    uint64_t endNS = nowNS();
+    if(isThrottled)
+    {
+        drain.stop(fifoPath);
+    }
+    uint64_t dropped = (loggerNdx == 6) ? ((AsyncLogger *) bench.logger)->totalDroppedRecords() : 0;
+    logSystem->setLogger(0);
+    bench.release();
+
+    LatencyHistogram merged;
+    for(int i = 0; i < threads; ++i)
+    {
+        merged.merge(histograms[i]);
+    }
+    uint64_t calls = (uint64_t) count * threads;
+    char sample[512];
+    int lineLen = formatLogLinePrefix(sample, sizeof(sample), 0, LOG_INFO, 0, BENCH_TAG) +
+                  snprintf(sample, sizeof(sample), "message %d of thread %d, payload %s", count, threads,
+                           BENCH_PAYLOAD) + 1;
+    double bytes = (mode == BENCH_EMITTED) ? (double) lineLen * (calls - dropped) : 0;
+    double callsSeconds = (callsEndNS - beginNS) / 1e9;
+    double totalSeconds = (endNS - beginNS) / 1e9;
+    fprintf(config.output, "{\"logger\":\"%s\",\"target\":\"%s\",\"mode\":\"%s\",\"threads\":%d,"
+            "\"calls\":%llu,\"dropped\":%llu,\"nsPerCall\":%.1f,\"p50NS\":%llu,\"p99NS\":%llu,\"p999NS\":%llu,"
+            "\"callsPerSec\":%.0f,\"mbPerSec\":%.3f,\"wallMS\":%.1f,\"timerNS\":%.1f}\n",
+            loggerNames[loggerNdx], target, modeNames[mode], threads, (unsigned long long) calls,
+            (unsigned long long) dropped, (double) merged.sumNS / merged.total,
+            (unsigned long long) merged.percentile(0.5), (unsigned long long) merged.percentile(0.99),
+            (unsigned long long) merged.percentile(0.999), calls / callsSeconds, bytes / totalSeconds / 1e6,
+            totalSeconds * 1e3, config.timerNS);
+    fflush(config.output);
+    // Remove what the run wrote, so runs don't accumulate files.
+    if(!isThrottled && isFileLogger(loggerNdx))
+    {
+        std::string cmd = std::string("rm -f '") + dir + "'/" BENCH_BASE_NAME "*.log";
+        if(system(cmd.c_str()) != 0)
+        {
+            fprintf(stderr, "Cleanup of %s failed\n", dir);
+        }
+    }
+}
+
+static double measureTimerNS(void)
+{
+    const int loops = 1000000;
+    uint64_t begin = nowNS();
+    for(int i = 0; i < loops; ++i)
+    {
+        nowNS();
+    }
+    return (double) (nowNS() - begin) / loops;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [-d tmpfsDir] [-s slowDir] [-r throttleKBps] [-t maxThreads] [-n messagesPerRun] "
+            "[-o output.jsonl]\n", name);
+    fprintf(stderr, "  -d  Directory for file loggers, it should be tmpfs (default /tmp).\n");
+    fprintf(stderr, "  -s  Directory for the throttled FIFO target (default tmpfsDir), \"-\" to skip it.\n");
+    fprintf(stderr, "  -r  Throttled target rate in KB/s (default 2048).\n");
+    fprintf(stderr, "  -t  Max producer threads, runs are 1, 2, 4, ... up to it (default 16).\n");
+    fprintf(stderr, "  -n  Messages per run, split among producer threads (default 100000).\n");
+    fprintf(stderr, "  -o  Write JSON lines to the file instead of stdout.\n");
+}
+
+int main(int argc, char *argv[])
+{
+    BenchConfig config = { "/tmp", 0, 2048 * 1024, 16, 100000, stdout, 0 };
+    int opt;
+    while((opt = getopt(argc, argv, "d:s:r:t:n:o:h")) != -1)
+    {
+        switch(opt)
+        {
+            case 'd':
+                config.dir = optarg;
+                break;
+            case 's':
+                config.slowDir = optarg;
+                break;
+            case 'r':
+                config.throttleBytesPerSecond = atoll(optarg) * 1024;
+                break;
+            case 't':
+                config.maxThreads = atoi(optarg);
+                break;
+            case 'n':
+                config.messagesPerRun = atoi(optarg);
+                break;
+            case 'o':
+                config.output = fopen(optarg, "w");
+                if(!config.output)
+                {
+                    fprintf(stderr, "Cannot open %s\n", optarg);
+                    return 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if((config.maxThreads <= 0) || (config.messagesPerRun <= 0) || (config.throttleBytesPerSecond <= 0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    if(!config.slowDir)
+    {
+        config.slowDir = config.dir;
+    }
+    config.timerNS = measureTimerNS();
+
+    for(int loggerNdx = 0; loggerNdx < BENCH_LOGGER_COUNT; ++loggerNdx)
+    {
+        for(int mode = BENCH_FILTERED_CALL; mode <= BENCH_EMITTED; ++mode)
+        {
+            for(int threads = 1; threads <= config.maxThreads; threads *= 2)
+            {
+                fprintf(stderr, "%s, tmpfs, %s, %d threads\n", loggerNames[loggerNdx], modeNames[mode], threads);
+                runOne(config, loggerNdx, "tmpfs", config.dir, false, (BenchMode) mode, threads);
+            }
+        }
+    }
+    if(strcmp(config.slowDir, "-") != 0)
+    {
+        // Only emitted messages reach the target.
+        for(int loggerNdx = 0; loggerNdx < BENCH_LOGGER_COUNT; ++loggerNdx)
+        {
+            if(!isFileLogger(loggerNdx))
+            {
+                continue;
+            }
+            for(int threads = 1; threads <= config.maxThreads; threads *= 2)
+            {
+                fprintf(stderr, "%s, throttled, emitted, %d threads\n", loggerNames[loggerNdx], threads);
+                runOne(config, loggerNdx, "throttled", config.slowDir, true, BENCH_EMITTED, threads);
+            }
+        }
+    }
+    if(config.output != stdout)
+    {
+        fclose(config.output);
+    }
+    return 0;
+}
@@ -0,0 +1,5 @@
+adb root
+adb shell mkdir /data/test
+adb push project/LogBenchmark /data/test
+adb shell "cd /data/test;chmod a+x LogBenchmark;./LogBenchmark -d /dev/shm -o /data/test/LogBenchmark.jsonl"
+adb pull /data/test/LogBenchmark.jsonl
\ No newline at end of file
@@ -0,0 +1,156 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  PropertySetTest                                                                             *
+ * FILE NAME   :  PropertySetTest.cpp                                                                         *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Checks of FlatPropertySet and PropertyKeys against SimplePropertySet.                       *
+ *------------------------------------------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include <util/FlatPropertySet.h>
+#include <util/SimplePropertySet.h>
+
+#define KEY_COUNT               2000
+#define OP_COUNT                200000
+
+static int failures = 0;
+
+#define CHECK(cond)                                                                                           \
+    do                                                                                                        \
+    {                                                                                                         \
+        if(!(cond))                                                                                           \
+        {                                                                                                     \
+            printf("FAILED: %s (line %d)\n", #cond, __LINE__);                                                \
+            ++failures;                                                                                       \
+        }                                                                                                     \
+    } while(0)
+
+static void countVisitor(void *context, const char *name, void *value)
+{
+    SimplePropertySet *reference = (SimplePropertySet *) context;
+    CHECK(reference->get(name) == value);
+    reference->remove(name);
+}
+
+// Random set()/get()/remove() of keys sharing a prefix, compared w/ SimplePropertySet.
+static void testAgainstSimplePropertySet(void)
+{
+    char *keys[KEY_COUNT];
+    for(int i = 0; i < KEY_COUNT; ++i)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "cameraConfig%d", i);
+        keys[i] = strdup(name);
+    }
+    FlatPropertySet flat;
+    SimplePropertySet reference;
+    srand(1);
+    for(int i = 0; i < OP_COUNT; ++i)
+    {
+        int ndx = rand() % KEY_COUNT;
+        // A copy, so keys are compared by strings, not by pointers.
+        std::string name(keys[ndx]);
+        void *value = (void *) (intptr_t) (i + 1);
+        switch(rand() % 3)
+        {
+            case 0:
+                flat.set(keys[ndx], value);
+                reference.set(keys[ndx], value);
+                break;
+            case 1:
+                CHECK(flat.get(name.c_str()) == reference.get(name.c_str()));
+                break;
+            default:
+            {
+                char *orgName = 0;
+                void *orgValue = 0;
+                void *referenceValue = reference.get(name.c_str());
+                bool isRemoved = flat.remove(name.c_str(), &orgName, &orgValue);
+                CHECK(isRemoved == reference.remove(name.c_str()));
+                if(isRemoved)
+                {
+                    CHECK(orgName == keys[ndx]);
+                    CHECK(orgValue == referenceValue);
+                }
+                break;
+            }
+        }
+        CHECK(flat.size() == reference.size());
+    }
+    flat.enumerate(countVisitor, &reference);
+    CHECK(reference.size() == 0);
+    for(int i = 0; i < KEY_COUNT; ++i)
+    {
+        free(keys[i]);
+    }
+}
+
+static void testInternedKeys(void)
+{
+    const char *width = PropertyKeys::intern("width");
+    std::string copy("width");
+    CHECK(PropertyKeys::intern(copy.c_str()) == width);
+    CHECK(strcmp(width, "width") == 0);
+    CHECK(PropertyKeys::hashOfInterned(width) == PropertyKeys::hash("width"));
+    CHECK(PropertyKeys::isInterned(width));
+    CHECK(!PropertyKeys::isInterned(copy.c_str()));
+
+    // Interned and plain keys of the same string are the same key.
+    FlatPropertySet properties;
+    const char *height = PropertyKeys::intern("height");
+    properties.setInterned(width, (void *) 1);
+    properties.setInterned(height, (void *) 2);
+    CHECK(properties.get("width") == (void *) 1);
+    properties.set(copy.c_str(), (void *) 3);
+    CHECK(properties.getInterned(width) == (void *) 3);
+    CHECK(properties.size() == 2);
+    properties.reset();
+
+    // Keys longer than an arena.
+    std::string longName(10000, 'k');
+    const char *longKey = PropertyKeys::intern(longName.c_str());
+    CHECK(PropertyKeys::isInterned(longKey));
+    CHECK(longName == longKey);
+    CHECK(PropertyKeys::hashOfInterned(longKey) == PropertyKeys::hash(longName.c_str()));
+    CHECK(PropertyKeys::intern(width) == width);
+}
+
+// Interned keys are never free(), even if they are set by set() instead of setInterned().
+static void testInternedKeysNotFreed(void)
+{
+    const char *width = PropertyKeys::intern("width");
+    FlatPropertySet properties;
+    properties.set(width, strdup("1"));
+    properties.set(strdup("depth"), strdup("2"));
+    properties.setInterned(PropertyKeys::intern("height"), strdup("3"));
+    properties.freeAllKeysAndValuesAndReset();
+    CHECK(properties.size() == 0);
+
+    properties.set(width, (void *) 4);
+    char *orgName = (char *) 1;
+    void *value = 0;
+    CHECK(properties.remove("width", &orgName, &value));
+    CHECK(orgName == 0);
+    CHECK(value == (void *) 4);
+    free(orgName);
+    CHECK(strcmp(PropertyKeys::intern("width"), "width") == 0);
+}
+
+int main(int argc, char *argv[])
+{
+    testAgainstSimplePropertySet();
+    testInternedKeys();
+    testInternedKeysNotFreed();
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,4 @@
+adb root
+adb shell mkdir /data/test
+adb push project/PropertySetTest /data/test
+adb shell "cd /data/test;chmod a+x PropertySetTest;./PropertySetTest"
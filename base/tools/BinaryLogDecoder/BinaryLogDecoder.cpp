@@ -0,0 +1,213 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  BinaryLogDecoder                                                                            *
+ * FILE NAME   :  BinaryLogDecoder.cpp                                                                        *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Offline decoder of BinaryFileLogger files, output the same lines as FileBasedLogger.  It is  *
+ *                built for the host, and doesn't link libBase.                                               *
+ *------------------------------------------------------------------------------------------------------------*/
+
+// Standard includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+// libBase includes
+#include <log/BinaryLogRecord.h>
+#include <log/logLineFormat.h>
+
+#define LINE_BUFFER_SIZE    (BINARY_LOG_MAX_ARGS_SIZE * 8)
+
+struct DecodeContext
+{
+    std::map<uint16_t, std::string> formats;
+    std::map<uint16_t, std::string> tags;
+    unsigned long long entries;
+    unsigned long long errors;
+};
+
+static void printUsage(const char *programName)
+{
+    fprintf(stderr, "Usage: %s [-o outputFile] logFile...\n", programName);
+    fprintf(stderr, "  Decode files of BinaryFileLogger (text log files are copied as is).\n");
+}
+
+static const char *lookupString(const std::map<uint16_t, std::string> &dictionary, uint16_t id)
+{
+    std::map<uint16_t, std::string>::const_iterator it = dictionary.find(id);
+    return (it == dictionary.end()) ? NULL : it->second.c_str();
+}
+
+static void outputEntry(FILE *output, DecodeContext &context, const BinaryLogRecordHeader &header,
+                                                                        const char *payload, const char *fileName)
+{
+    if(header.payloadSize < sizeof(BinaryLogEntry))
+    {
+        ++context.errors;
+        return;
+    }
+    BinaryLogEntry entry;
+    memcpy(&entry, payload, sizeof(entry));
+    const char *data = payload + sizeof(entry);
+    int dataSize = header.payloadSize - (int) sizeof(entry);
+    const char *tag = lookupString(context.tags, entry.tagID);
+
+    static char line[LINE_BUFFER_SIZE];
+    int len = formatLogLinePrefix(line, sizeof(line), entry.timestampMS, (LogLevel) header.logLevel,
+                                  (int) entry.threadID, tag ? tag : "?");
+    fwrite(line, 1, len, output);
+    if(header.type == BINARY_LOG_RECORD_TEXT)
+    {
+        fwrite(data, 1, dataSize, output);
+    }
+    else
+    {
+        const char *formatStr = lookupString(context.formats, entry.formatID);
+        if(!formatStr || (BinaryLogRecord::formatArgs(line, sizeof(line), formatStr, data, dataSize) < 0))
+        {
+            fprintf(output, "(%s: undecodable entry, format ID %u)", fileName, entry.formatID);
+            ++context.errors;
+        }
+        else
+        {
+            fputs(line, output);
+        }
+    }
+    fputc('\n', output);
+    ++context.entries;
+}
+
+// Return false if the file is corrupted (truncated at power loss, for example), decoded entries are kept.
+static bool decodeRecords(FILE *input, FILE *output, DecodeContext &context, const char *fileName)
+{
+    static char payload[0x10000];
+    BinaryLogRecordHeader header;
+    char magic[BINARY_LOG_FILE_MAGIC_SIZE];
+    while(fread(&header, sizeof(header), 1, input) == 1)
+    {
+        if(memcmp(&header, BINARY_LOG_FILE_MAGIC, sizeof(header)) == 0)
+        {
+            // Restarted by a new file, which is concatenated to this one.
+            if((fread(magic, 1, sizeof(magic) - sizeof(header), input) != sizeof(magic) - sizeof(header)) ||
+               (memcmp(magic, BINARY_LOG_FILE_MAGIC + sizeof(header), sizeof(magic) - sizeof(header)) != 0))
+            {
+                return false;
+            }
+            context.formats.clear();
+            context.tags.clear();
+            continue;
+        }
+        if(fread(payload, 1, header.payloadSize, input) != header.payloadSize)
+        {
+            return false;
+        }
+        switch(header.type)
+        {
+            case BINARY_LOG_RECORD_TAG:
+            case BINARY_LOG_RECORD_FORMAT:
+            {
+                if(header.payloadSize < sizeof(BinaryLogDefinition))
+                {
+                    return false;
+                }
+                BinaryLogDefinition definition;
+                memcpy(&definition, payload, sizeof(definition));
+                std::map<uint16_t, std::string> &dictionary =
+                                        (header.type == BINARY_LOG_RECORD_TAG) ? context.tags : context.formats;
+                dictionary[definition.id].assign(payload + sizeof(definition),
+                                                 header.payloadSize - sizeof(definition));
+                break;
+            }
+            case BINARY_LOG_RECORD_ENTRY:
+            case BINARY_LOG_RECORD_TEXT:
+                outputEntry(output, context, header, payload, fileName);
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+static int decodeFile(const char *fileName, FILE *output)
+{
+    FILE *input = fopen(fileName, "rb");
+    if(!input)
+    {
+        fprintf(stderr, "Cannot open %s\n", fileName);
+        return -1;
+    }
+    char magic[BINARY_LOG_FILE_MAGIC_SIZE];
+    size_t size = fread(magic, 1, sizeof(magic), input);
+    int result = 0;
+    if((size == sizeof(magic)) && (memcmp(magic, BINARY_LOG_FILE_MAGIC, sizeof(magic)) == 0))
+    {
+        DecodeContext context;
+        context.entries = 0;
+        context.errors = 0;
+        if(!decodeRecords(input, output, context, fileName))
+        {
+            fprintf(stderr, "%s: corrupted at offset %ld, the rest is ignored\n", fileName, ftell(input));
+            result = -1;
+        }
+        if(context.errors > 0)
+        {
+            fprintf(stderr, "%s: %llu of %llu entries cannot be decoded\n", fileName, context.errors,
+                    context.entries);
+            result = -1;
+        }
+    }
+    else
+    {
+        // Not a binary log file, copy it.
+        char buffer[4096];
+        fwrite(magic, 1, size, output);
+        while((size = fread(buffer, 1, sizeof(buffer), input)) > 0)
+        {
+            fwrite(buffer, 1, size, output);
+        }
+    }
+    fclose(input);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *output = stdout;
+    int argIndex = 1;
+    if((argIndex + 1 < argc) && (strcmp(argv[argIndex], "-o") == 0))
+    {
+        output = fopen(argv[argIndex + 1], "w");
+        if(!output)
+        {
+            fprintf(stderr, "Cannot create %s\n", argv[argIndex + 1]);
+            return 1;
+        }
+        argIndex += 2;
+    }
+    if(argIndex >= argc)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    int result = 0;
+    for(; argIndex < argc; ++argIndex)
+    {
+        if(decodeFile(argv[argIndex], output) != 0)
+        {
+            result = 2;
+        }
+    }
+    if(output != stdout)
+    {
+        fclose(output);
+    }
+    return result;
+}
@@ -0,0 +1,79 @@
+/*------------------------------------------------------------------------------------------------------------*
+ *                                                                                                            *
+ * Copyright      2026 MiTAC International Corp.                                                              *
+ *                                                                                                            *
+ *------------------------------------------------------------------------------------------------------------*
+ * PROJECT     :  Common Framework                                                                            *
+ * BINARY NAME :  LzDecompress                                                                                *
+ * FILE NAME   :  LzDecompress.cpp                                                                            *
+ * CREATED BY  :  Huah Tu <huah.tu@mic.com.tw>                                                                *
+ * CREATED DATE:  10/17/26 (MM/DD/YY)                                                                         *
+ * DESCRIPTION :  Decompress ".lz" files (compressed log files of CompressingFileLogger).  It is built for    *
+ *                the host or the device, and doesn't link libBase.                                           *
+ *------------------------------------------------------------------------------------------------------------*/
+
+// Standard includes
+#include <stdio.h>
+#include <string.h>
+#include <string>
+// libBase includes
+#include <util/LzCodec.h>
+
+static void printUsage(const char *programName)
+{
+    fprintf(stderr, "Usage: %s [-c] file.lz...\n", programName);
+    fprintf(stderr, "  Decompress each file.lz to file, or to stdout with -c.\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int argIndex = 1;
+    bool isToStdout = false;
+    if((argIndex < argc) && (strcmp(argv[argIndex], "-c") == 0))
+    {
+        isToStdout = true;
+        ++argIndex;
+    }
+    if(argIndex >= argc)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    int result = 0;
+    for(; argIndex < argc; ++argIndex)
+    {
+        const char *srcPath = argv[argIndex];
+        int decodeResult;
+        if(isToStdout)
+        {
+            FILE *src = fopen(srcPath, "rb");
+            decodeResult = src ? LzCodec::decompressFile(src, stdout) : MIO_ERR_IO_GENERAL;
+            if(src)
+            {
+                fclose(src);
+            }
+        }
+        else
+        {
+            std::string dstPath = srcPath;
+            size_t extLen = strlen(".lz");
+            if((dstPath.size() > extLen) && (dstPath.compare(dstPath.size() - extLen, extLen, ".lz") == 0))
+            {
+                dstPath.resize(dstPath.size() - extLen);
+            }
+            else
+            {
+                dstPath += ".out";
+            }
+            decodeResult = LzCodec::decompressFile(srcPath, dstPath.c_str());
+        }
+        if(decodeResult != MIO_GENERAL_OK)
+        {
+            fprintf(stderr, "%s: %s\n", srcPath,
+                    (decodeResult == MIO_ERR_INVALID_DATA) ? "corrupted or truncated" : "I/O error");
+            result = 2;
+        }
+    }
+    return result;
+}